@@ -0,0 +1,220 @@
+// LedController for the benchmark build: keeps the per-zone state the real
+// controller keeps (targets, framebuffers, dirty ranges) and counts every
+// write, but never touches LEDC or FastLED. Any GPIO and zone count is accepted.
+
+#include "hardware/LedController.h"
+#include "BenchLedSink.h"
+
+namespace {
+bench::LedCallCounts counts = {};
+}
+
+namespace bench {
+LedCallCounts& ledCalls() { return counts; }
+}
+
+namespace BattleAura {
+
+LedController::LedController() : stripsChanged(false), lastUpdateMs(0), stats{} {
+    zones.reserve(256);
+    rebuildZoneIndex();
+}
+
+LedController::~LedController() {
+}
+
+bool LedController::begin() {
+    return true;
+}
+
+void LedController::addZone(const Zone& zone) {
+    if (findZone(zone.id) != nullptr) {
+        removeZone(zone.id);
+    }
+    if (!zone.enabled) return;
+    
+    zones.emplace_back(zone);
+    ZoneState& zoneState = zones.back();
+    if (zone.type == ZoneType::WS2812B && zone.ledCount > 0) {
+        zoneState.leds = new CRGB[zone.ledCount];
+        zoneState.pixels = new CRGB[zone.ledCount];
+    }
+    zoneIndex[zone.id] = zones.size() - 1;
+}
+
+void LedController::removeZone(uint8_t zoneId) {
+    zones.erase(
+        std::remove_if(zones.begin(), zones.end(),
+            [zoneId](const ZoneState& zs) { return zs.zone.id == zoneId; }),
+        zones.end()
+    );
+    rebuildZoneIndex();
+}
+
+void LedController::setZoneBrightness(uint8_t zoneId, uint8_t brightness) {
+    counts.zoneCalls++;
+    ZoneState* zoneState = findZone(zoneId);
+    if (!zoneState) return;
+    
+    zoneState->pixelMode = false;
+    zoneState->targetBrightness = (uint8_t)((brightness * zoneState->userBrightness) / 255);
+    zoneState->needsUpdate = true;
+}
+
+void LedController::setZoneColor(uint8_t zoneId, CRGB color) {
+    counts.zoneCalls++;
+    ZoneState* zoneState = findZone(zoneId);
+    if (!zoneState || zoneState->zone.type != ZoneType::WS2812B) return;
+    
+    zoneState->pixelMode = false;
+    zoneState->targetColor = color;
+    zoneState->needsUpdate = true;
+}
+
+void LedController::setZoneColorAndBrightness(uint8_t zoneId, CRGB color, uint8_t brightness) {
+    counts.zoneCalls++;
+    ZoneState* zoneState = findZone(zoneId);
+    if (!zoneState) return;
+    
+    zoneState->pixelMode = false;
+    zoneState->targetBrightness = (uint8_t)((brightness * zoneState->userBrightness) / 255);
+    zoneState->targetColor = color;
+    zoneState->needsUpdate = true;
+}
+
+uint8_t LedController::getZoneBrightness(uint8_t zoneId) const {
+    const ZoneState* zoneState = findZone(zoneId);
+    return zoneState ? zoneState->currentBrightness : 0;
+}
+
+CRGB LedController::getZoneColor(uint8_t zoneId) const {
+    const ZoneState* zoneState = findZone(zoneId);
+    return zoneState ? zoneState->currentColor : CRGB::Black;
+}
+
+void LedController::setUserBrightness(uint8_t zoneId, uint8_t brightness) {
+    ZoneState* zoneState = findZone(zoneId);
+    if (zoneState) zoneState->userBrightness = brightness;
+}
+
+uint8_t LedController::getUserBrightness(uint8_t zoneId) const {
+    const ZoneState* zoneState = findZone(zoneId);
+    return zoneState ? zoneState->userBrightness : 255;
+}
+
+uint16_t LedController::getZonePixelCount(uint8_t zoneId) const {
+    const ZoneState* zoneState = findZone(zoneId);
+    return (zoneState && zoneState->pixels) ? zoneState->zone.ledCount : 0;
+}
+
+void LedController::setPixel(uint8_t zoneId, uint16_t index, CRGB color) {
+    counts.pixelCalls++;
+    ZoneState* zoneState = beginPixelWrite(zoneId);
+    if (!zoneState || index >= zoneState->zone.ledCount) return;
+    
+    zoneState->pixels[index] = color;
+    markPixelsDirty(*zoneState, index, index + 1);
+}
+
+void LedController::fillPixels(uint8_t zoneId, uint16_t start, uint16_t count, CRGB color) {
+    counts.pixelCalls++;
+    ZoneState* zoneState = beginPixelWrite(zoneId);
+    if (!zoneState || start >= zoneState->zone.ledCount) return;
+    
+    uint16_t end = min<uint16_t>(start + count, zoneState->zone.ledCount);
+    for (uint16_t i = start; i < end; i++) {
+        zoneState->pixels[i] = color;
+    }
+    markPixelsDirty(*zoneState, start, end);
+}
+
+void LedController::blitPixels(uint8_t zoneId, uint16_t start, const CRGB* colors, uint16_t count) {
+    counts.pixelCalls++;
+    ZoneState* zoneState = beginPixelWrite(zoneId);
+    if (!zoneState || !colors || start >= zoneState->zone.ledCount) return;
+    
+    uint16_t end = min<uint16_t>(start + count, zoneState->zone.ledCount);
+    for (uint16_t i = start; i < end; i++) {
+        zoneState->pixels[i] = colors[i - start];
+    }
+    markPixelsDirty(*zoneState, start, end);
+}
+
+void LedController::startTransition(uint8_t zoneId, uint16_t durationMs, Easing easing) {
+    counts.zoneCalls++;
+    ZoneState* zoneState = findZone(zoneId);
+    if (!zoneState) return;
+    
+    zoneState->stage.fadeMs = durationMs;
+    zoneState->stage.fadeEasing = easing;
+}
+
+void LedController::setZoneSmoothing(uint8_t zoneId, uint16_t timeConstantMs) {
+    counts.zoneCalls++;
+    ZoneState* zoneState = findZone(zoneId);
+    if (zoneState) zoneState->stage.smoothingMs = timeConstantMs;
+}
+
+void LedController::update(uint32_t now) {
+    lastUpdateMs = now;
+    for (ZoneState& zoneState : zones) {
+        if (zoneState.needsUpdate) {
+            zoneState.currentBrightness = zoneState.targetBrightness;
+            zoneState.currentColor = zoneState.targetColor;
+            zoneState.needsUpdate = false;
+        }
+        zoneState.dirtyStart = 0;
+        zoneState.dirtyEnd = 0;
+    }
+}
+
+bool LedController::isZoneConfigured(uint8_t zoneId) const {
+    return findZone(zoneId) != nullptr;
+}
+
+void LedController::printStatus() const {
+    Serial.printf("LedController (bench): %d zones\n", zones.size());
+}
+
+void LedController::rebuildZoneIndex() {
+    memset(zoneIndex, NO_ZONE, sizeof(zoneIndex));
+    for (size_t i = 0; i < zones.size(); i++) {
+        zoneIndex[zones[i].zone.id] = i;
+    }
+}
+
+LedController::ZoneState* LedController::findZone(uint8_t zoneId) {
+    uint8_t index = zoneIndex[zoneId];
+    return index != NO_ZONE ? &zones[index] : nullptr;
+}
+
+const LedController::ZoneState* LedController::findZone(uint8_t zoneId) const {
+    uint8_t index = zoneIndex[zoneId];
+    return index != NO_ZONE ? &zones[index] : nullptr;
+}
+
+LedController::ZoneState* LedController::beginPixelWrite(uint8_t zoneId) {
+    ZoneState* zoneState = findZone(zoneId);
+    if (!zoneState || !zoneState->pixels) return nullptr;
+    
+    if (!zoneState->pixelMode) {
+        zoneState->pixelMode = true;
+        for (uint16_t i = 0; i < zoneState->zone.ledCount; i++) {
+            zoneState->pixels[i] = CRGB::Black;
+        }
+        markPixelsDirty(*zoneState, 0, zoneState->zone.ledCount);
+    }
+    return zoneState;
+}
+
+void LedController::markPixelsDirty(ZoneState& zoneState, uint16_t start, uint16_t end) {
+    if (zoneState.dirtyEnd <= zoneState.dirtyStart) {
+        zoneState.dirtyStart = start;
+        zoneState.dirtyEnd = end;
+        return;
+    }
+    if (start < zoneState.dirtyStart) zoneState.dirtyStart = start;
+    if (end > zoneState.dirtyEnd) zoneState.dirtyEnd = end;
+}
+
+} // namespace BattleAura
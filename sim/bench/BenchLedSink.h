@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+namespace bench {
+
+// Calls made into the bench LedController since the last reset. The bench
+// build links BenchLedController.cpp in place of the hardware LedController,
+// so effects can be driven on any number of zones without GPIO/RMT limits.
+struct LedCallCounts {
+    uint32_t zoneCalls;     // setZoneColor/setZoneBrightness/setZoneColorAndBrightness
+    uint32_t pixelCalls;    // setPixel/fillPixels/blitPixels
+};
+
+LedCallCounts& ledCalls();
+
+} // namespace bench
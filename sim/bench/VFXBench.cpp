@@ -0,0 +1,351 @@
+// Frame benchmark for the VFX library (native bench build).
+//
+// Drives every effect on 1, 8, 32 and 128 zones with a seeded random() and
+// virtual time, and reports per-frame cost (effect update plus compositing),
+// heap allocations and LedController calls. Timed effects are re-triggered as
+// soon as they stop so every measured frame renders. The VFXMath kernels are
+// timed against the libm/Arduino calls they replace. Results go to a JSON file
+// for comparison across builds.
+//
+//   battleaura_bench [--out FILE] [--frames N] [--warmup N] [--seed N] [--only VFX]
+
+#include <Arduino.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include "config/Configuration.h"
+#include "hardware/LedController.h"
+#include "core/AllocCounter.h"
+#include "vfx/Compositor.h"
+#include "vfx/VFXMath.h"
+#include "vfx/library/CandleVFX.h"
+#include "vfx/library/EngineIdleVFX.h"
+#include "vfx/library/WeaponFireVFX.h"
+#include "vfx/library/DamageVFX.h"
+#include "vfx/library/FlamethrowerVFX.h"
+#include "vfx/library/EngineRevVFX.h"
+#include "vfx/library/DestroyedVFX.h"
+#include "vfx/library/RocketLauncherVFX.h"
+#include "vfx/library/VictoryVFX.h"
+#include "vfx/library/ScriptVFX.h"
+#include "BenchLedSink.h"
+
+using namespace BattleAura;
+
+Configuration BattleAura::config;
+
+namespace {
+
+const uint8_t FRAME_RATE = 50;
+const uint32_t FRAME_PERIOD_US = 1000000UL / FRAME_RATE;
+const uint8_t STRIP_LENGTH = 16;
+const size_t ZONE_COUNTS[] = {1, 8, 32, 128};
+const char* const GROUP_NAMES[] = {"Engines", "Weapons", "Candles", "Console"};
+const uint32_t KERNEL_ITERATIONS = 1000000;
+
+struct EffectCase {
+    const char* name;
+    uint32_t triggerDuration;    // 0 = continuous
+    std::unique_ptr<BaseVFX> (*create)(Compositor& compositor, Configuration& config);
+};
+
+template <typename T>
+std::unique_ptr<BaseVFX> makeEffect(Compositor& compositor, Configuration& config) {
+    return std::unique_ptr<BaseVFX>(new T(compositor, config));
+}
+
+// tools/effects/plasma.fx as built by tools/effect_compiler.py, so the VM is
+// measured on a realistic per-pixel program
+const uint8_t PLASMA_PROGRAM[] = {
+    0x42, 0x46, 0x58, 0x31, 0x22, 0x00, 0x0b, 0x00, 0x50, 0x6c, 0x61, 0x73, 0x6d, 0x61, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+    0xaa, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x05, 0x0c, 0x00, 0x0d, 0x00, 0x0f, 0x01, 0x00,
+    0x04, 0x0e, 0x01, 0x0f, 0x02, 0x0b, 0x0c, 0x0e, 0x14, 0x0a, 0x0b, 0x00, 0x00, 0x0f, 0x02, 0x00,
+    0x04, 0x0e, 0x01, 0x0f, 0x03, 0x0d, 0x00, 0x0e, 0x00, 0x11, 0x03, 0x00, 0x04, 0x10, 0x03, 0x11,
+    0x02, 0x0c, 0x0d, 0x10, 0x14, 0x0b, 0x0c, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x05, 0x0d, 0x00, 0x0e,
+    0x02, 0x0c, 0x0a, 0x0d, 0x12, 0x06, 0x0c, 0x00, 0x02, 0x0d, 0x0a, 0x0b, 0x00, 0x0e, 0x05, 0x00,
+    0x02, 0x0c, 0x0d, 0x0e, 0x12, 0x07, 0x0c, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x02, 0x0d, 0x0b, 0x0e,
+    0x00, 0x10, 0x07, 0x00, 0x05, 0x0f, 0x00, 0x10, 0x03, 0x0c, 0x0d, 0x0f, 0x12, 0x08, 0x0c, 0x00,
+    0x00, 0x0c, 0x08, 0x00, 0x16, 0x0f, 0x0a, 0x00, 0x00, 0x10, 0x09, 0x00, 0x04, 0x0e, 0x0f, 0x10,
+    0x00, 0x11, 0x0a, 0x00, 0x05, 0x0d, 0x0e, 0x11, 0x02, 0x09, 0x0c, 0x0d,
+};
+
+std::unique_ptr<BaseVFX> makeScript(Compositor& compositor, Configuration& config) {
+    // Shared by every case, as VFXManager shares a slot's program
+    static EffectProgram plasma;
+    if (!plasma.isLoaded()) {
+        String error;
+        plasma.parse(PLASMA_PROGRAM, sizeof(PLASMA_PROGRAM), error);
+    }
+
+    ScriptVFX* script = new ScriptVFX(compositor, config, 1);
+    script->setProgram(&plasma);
+    return std::unique_ptr<BaseVFX>(script);
+}
+
+// Durations are each effect's own trigger() default
+const EffectCase EFFECTS[] = {
+    {"CandleFlicker", 0, makeEffect<CandleVFX>},
+    {"EngineIdle", 0, makeEffect<EngineIdleVFX>},
+    {"MachineGun", 1500, makeEffect<WeaponFireVFX>},
+    {"Damage", 2000, makeEffect<DamageVFX>},
+    {"Flamethrower", 3000, makeEffect<FlamethrowerVFX>},
+    {"EngineRev", 4000, makeEffect<EngineRevVFX>},
+    {"Destroyed", 8000, makeEffect<DestroyedVFX>},
+    {"RocketLauncher", 2000, makeEffect<RocketLauncherVFX>},
+    {"Victory", 5000, makeEffect<VictoryVFX>},
+    {"Script", 0, makeScript},
+};
+
+struct Options {
+    std::string outPath = "bench_results.json";
+    uint32_t frames = 1000;
+    uint32_t warmup = 50;
+    unsigned long seed = 1;
+    std::string only;
+};
+
+struct Result {
+    const char* name;
+    size_t zones;
+    double nsPerFrame;
+    uint64_t p95Ns;
+    uint64_t maxNs;
+    double allocsPerFrame;
+    uint32_t allocatingFrames;
+    double zoneCallsPerFrame;
+    double pixelCallsPerFrame;
+    uint32_t triggers;
+};
+
+struct KernelResult {
+    const char* name;
+    double nsPerCall;
+};
+
+// Keeps kernel results alive so the compiler can't drop the loops
+volatile int32_t kernelSink;
+
+template <typename Fn>
+KernelResult timeKernel(const char* name, Fn fn) {
+    int32_t sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < KERNEL_ITERATIONS; i++) {
+        sum += fn(i);
+    }
+    uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    kernelSink = sum;
+    return {name, (double)ns / KERNEL_ITERATIONS};
+}
+
+// Each VFXMath kernel next to the call it replaced in the effects
+std::vector<KernelResult> runKernels() {
+    VFXMath::Rng rng;
+    rng.seed(1);
+
+    std::vector<KernelResult> results;
+    results.push_back(timeKernel("sin(double)", [](uint32_t i) {
+        return (int32_t)(sin(i * 0.01) * 32767);
+    }));
+    results.push_back(timeKernel("VFXMath::sin16", [](uint32_t i) {
+        return (int32_t)VFXMath::sin16(i * VFXMath::toAngle(0.01));
+    }));
+    results.push_back(timeKernel("random(lo, hi)", [](uint32_t) {
+        return (int32_t)random(100, 200);
+    }));
+    results.push_back(timeKernel("Rng::range", [&rng](uint32_t) {
+        return (int32_t)rng.range(100, 200);
+    }));
+    results.push_back(timeKernel("map()", [](uint32_t i) {
+        return (int32_t)map(i % 1000, 0, 1000, 200, 80);
+    }));
+    results.push_back(timeKernel("VFXMath::ramp", [](uint32_t i) {
+        return VFXMath::ramp(i % 1000, 1000, 200, 80);
+    }));
+    return results;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) return false;
+
+        if (arg == "--out") options.outPath = argv[++i];
+        else if (arg == "--frames") options.frames = max(1UL, strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--warmup") options.warmup = strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--seed") options.seed = strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--only") options.only = argv[++i];
+        else return false;
+    }
+    return true;
+}
+
+// Zones alternate PWM and WS2812B and rotate through four groups, roughly a
+// scaled-up model build
+void configureZones(size_t count, LedController& leds) {
+    std::vector<uint8_t> ids;
+    for (Zone* zone : config.getAllZones()) ids.push_back(zone->id);
+    for (uint8_t id : ids) config.removeZone(id);
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t id = (uint8_t)(i + 1);
+        bool strip = (i % 2) == 1;
+        Zone zone(id, String("Zone ") + String((int)id), id,
+                  strip ? ZoneType::WS2812B : ZoneType::PWM, strip ? STRIP_LENGTH : 1,
+                  GROUP_NAMES[i % 4]);
+        config.addZone(zone);
+        leds.addZone(zone);
+    }
+}
+
+Result runCase(const EffectCase& effect, size_t zoneCount, const Options& options) {
+    LedController leds;
+    configureZones(zoneCount, leds);
+    Compositor compositor(config);
+    compositor.begin();
+
+    sim::setMicros(0);
+    randomSeed(options.seed);
+
+    std::unique_ptr<BaseVFX> vfx = effect.create(compositor, config);
+    vfx->begin();
+    vfx->trigger(effect.triggerDuration);
+
+    Result result = {};
+    result.name = effect.name;
+    result.zones = zoneCount;
+    result.triggers = 1;
+
+    std::vector<uint64_t> frameNs;
+    frameNs.reserve(options.frames);
+    uint64_t totalNs = 0;
+    uint64_t totalAllocs = 0;
+    uint64_t totalZoneCalls = 0;
+    uint64_t totalPixelCalls = 0;
+
+    for (uint32_t frame = 0; frame < options.warmup + options.frames; frame++) {
+        sim::setMicros((uint64_t)frame * FRAME_PERIOD_US);
+        uint32_t now = millis();
+
+        if (!vfx->isEnabled()) {
+            vfx->trigger(effect.triggerDuration);
+            result.triggers++;
+        }
+        ScriptVFX::resetFrameBudget();
+
+        bench::LedCallCounts& calls = bench::ledCalls();
+        calls = {};
+        uint32_t allocsBefore = AllocCounter::getAllocationCount();
+        auto start = std::chrono::steady_clock::now();
+
+        vfx->update(now);
+        compositor.compose(leds);
+
+        uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        uint32_t allocs = AllocCounter::getAllocationCount() - allocsBefore;
+
+        leds.update(now);
+
+        if (frame < options.warmup) continue;
+
+        frameNs.push_back(ns);
+        totalNs += ns;
+        totalAllocs += allocs;
+        if (allocs > 0) result.allocatingFrames++;
+        totalZoneCalls += calls.zoneCalls;
+        totalPixelCalls += calls.pixelCalls;
+    }
+
+    std::sort(frameNs.begin(), frameNs.end());
+    double frames = (double)options.frames;
+    result.nsPerFrame = totalNs / frames;
+    result.p95Ns = frameNs[(frameNs.size() * 95) / 100];
+    result.maxNs = frameNs.back();
+    result.allocsPerFrame = totalAllocs / frames;
+    result.zoneCallsPerFrame = totalZoneCalls / frames;
+    result.pixelCallsPerFrame = totalPixelCalls / frames;
+    return result;
+}
+
+bool writeResults(const std::vector<Result>& results, const std::vector<KernelResult>& kernels,
+                  const Options& options) {
+    FILE* out = fopen(options.outPath.c_str(), "w");
+    if (!out) return false;
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"seed\": %lu,\n", options.seed);
+    fprintf(out, "  \"fps\": %u,\n", FRAME_RATE);
+    fprintf(out, "  \"warmupFrames\": %u,\n", options.warmup);
+    fprintf(out, "  \"frames\": %u,\n", options.frames);
+    fprintf(out, "  \"allocTracking\": %s,\n", AllocCounter::isEnabled() ? "true" : "false");
+    fprintf(out, "  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        fprintf(out,
+                "    {\"vfx\": \"%s\", \"zones\": %u, \"nsPerFrame\": %.1f, \"p95Ns\": %llu, "
+                "\"maxNs\": %llu, \"allocsPerFrame\": %.3f, \"allocatingFrames\": %u, "
+                "\"zoneCallsPerFrame\": %.2f, \"pixelCallsPerFrame\": %.2f, \"triggers\": %u}%s\n",
+                r.name, (unsigned)r.zones, r.nsPerFrame, (unsigned long long)r.p95Ns,
+                (unsigned long long)r.maxNs, r.allocsPerFrame, r.allocatingFrames,
+                r.zoneCallsPerFrame, r.pixelCallsPerFrame, r.triggers,
+                i + 1 < results.size() ? "," : "");
+    }
+    fprintf(out, "  ],\n");
+    fprintf(out, "  \"kernels\": [\n");
+    for (size_t i = 0; i < kernels.size(); i++) {
+        fprintf(out, "    {\"kernel\": \"%s\", \"nsPerCall\": %.2f}%s\n",
+                kernels[i].name, kernels[i].nsPerCall, i + 1 < kernels.size() ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+    fclose(out);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printf("Usage: battleaura_bench [--out FILE] [--frames N] [--warmup N] [--seed N] [--only VFX]\n");
+        return 2;
+    }
+
+    // Zones are configured in memory per case; nothing is loaded from LittleFS
+    sim::setConsoleEcho(false);
+    AllocCounter::trackCurrentTask();
+
+    std::vector<Result> results;
+    printf("%-16s %6s %12s %10s %10s %12s %12s\n",
+           "vfx", "zones", "ns/frame", "p95 ns", "allocs/f", "zoneCalls/f", "pixelCalls/f");
+
+    for (const EffectCase& effect : EFFECTS) {
+        if (!options.only.empty() && options.only != effect.name) continue;
+
+        for (size_t zoneCount : ZONE_COUNTS) {
+            Result r = runCase(effect, zoneCount, options);
+            results.push_back(r);
+            printf("%-16s %6u %12.1f %10llu %10.3f %12.2f %12.2f\n",
+                   r.name, (unsigned)r.zones, r.nsPerFrame, (unsigned long long)r.p95Ns,
+                   r.allocsPerFrame, r.zoneCallsPerFrame, r.pixelCallsPerFrame);
+        }
+    }
+
+    std::vector<KernelResult> kernels = runKernels();
+    printf("\n%-16s %10s\n", "kernel", "ns/call");
+    for (const KernelResult& kernel : kernels) {
+        printf("%-16s %10.2f\n", kernel.name, kernel.nsPerCall);
+    }
+
+    if (!writeResults(results, kernels, options)) {
+        printf("Cannot write %s\n", options.outPath.c_str());
+        return 1;
+    }
+    printf("Results written to %s\n", options.outPath.c_str());
+    return 0;
+}
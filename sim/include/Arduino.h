@@ -0,0 +1,48 @@
+#pragma once
+
+// Host build of the Arduino core surface used by BattleAura's core sources.
+// Time is virtual (see SimClock.h) and random() is a seeded, repeatable PRNG.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "HardwareSerial.h"
+#include "SimClock.h"
+
+#define PROGMEM
+#define F(str) (str)
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::abs;
+using std::max;
+using std::min;
+using std::round;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+// LEDC (esp32-hal-ledc) - recorded by the virtual PWM sink
+double ledcSetup(uint8_t channel, double freq, uint8_t resolutionBits);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcWrite(uint8_t channel, uint32_t duty);
+
+namespace sim {
+uint32_t getPwmDuty(uint8_t channel);
+// Duty of the LEDC channel attached to a GPIO; false if none is attached
+bool getPwmDutyForPin(uint8_t pin, uint32_t& duty);
+}
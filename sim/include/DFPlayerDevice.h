@@ -0,0 +1,30 @@
+#pragma once
+
+// Host build: emulated DFPlayer Mini on a virtual UART. It decodes the frames
+// the firmware writes, appends every command to sim::audioLog() with its
+// virtual timestamp, and answers the way the module does: ACKs, status
+// replies, the storage-online frame after a reset and track-finished frames.
+
+#include <vector>
+#include "HardwareSerial.h"
+
+namespace sim {
+
+struct AudioCommand {
+    uint32_t timeMs;
+    const char* command;
+    int argument;
+};
+
+std::vector<AudioCommand>& audioLog();
+
+// Connect the emulated player to a UART (the firmware uses Serial1)
+void attachAudioPlayer(HardwareSerial& serial);
+
+// Whether the player answers at all; false behaves like an unplugged module
+void setAudioPlayerPresent(bool present);
+
+// Play time of every non-looping track, after which it reports finished
+void setAudioTrackLength(uint32_t ms);
+
+} // namespace sim
@@ -0,0 +1,58 @@
+#pragma once
+
+// Host build: LittleFS backed by a plain directory (see sim::setFilesystemRoot).
+
+#include <cstdio>
+#include <memory>
+#include "Stream.h"
+
+namespace fs {
+
+class File : public Stream {
+public:
+    File() {}
+    File(FILE* handle, const String& path);
+
+    explicit operator bool() const { return handle != nullptr; }
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override;
+
+    size_t read(uint8_t* buffer, size_t size);
+    bool seek(uint32_t position);
+    size_t position() const;
+    size_t size() const;
+    const char* path() const { return filePath.c_str(); }
+    void close();
+
+private:
+    std::shared_ptr<FILE> handle;
+    String filePath;
+};
+
+class FS {
+public:
+    File open(const char* path, const char* mode = "r");
+    File open(const String& path, const char* mode = "r") { return open(path.c_str(), mode); }
+    bool exists(const char* path);
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool remove(const String& path) { return remove(path.c_str()); }
+    bool mkdir(const char* path);
+    bool mkdir(const String& path) { return mkdir(path.c_str()); }
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+namespace sim {
+void setFilesystemRoot(const char* directory);
+const char* getFilesystemRoot();
+}
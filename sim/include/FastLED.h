@@ -0,0 +1,153 @@
+#pragma once
+
+// Host build: the slice of FastLED that BattleAura uses. Strips registered with
+// addLeds() are kept in memory and every show() is counted by the frame sink.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+inline uint8_t scale8(uint8_t i, uint8_t scale) {
+    return (uint8_t)(((uint16_t)i * (1 + (uint16_t)scale)) >> 8);
+}
+
+inline uint8_t scale8_video(uint8_t i, uint8_t scale) {
+    return (uint8_t)((((uint16_t)i * (uint16_t)scale) >> 8) + ((i && scale) ? 1 : 0));
+}
+
+inline uint8_t qadd8(uint8_t i, uint8_t j) {
+    unsigned int t = i + j;
+    return t > 255 ? 255 : (uint8_t)t;
+}
+
+inline uint8_t qsub8(uint8_t i, uint8_t j) {
+    return i > j ? (uint8_t)(i - j) : 0;
+}
+
+struct CRGB {
+    union {
+        struct {
+            uint8_t r;
+            uint8_t g;
+            uint8_t b;
+        };
+        uint8_t raw[3];
+    };
+
+    enum HTMLColorCode : uint32_t {
+        Black = 0x000000,
+        White = 0xFFFFFF,
+        Red = 0xFF0000,
+        Green = 0x008000,
+        Blue = 0x0000FF,
+        Orange = 0xFFA500,
+        Yellow = 0xFFFF00,
+        Gold = 0xFFD700,
+    };
+
+    CRGB() : r(0), g(0), b(0) {}
+    CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    CRGB(HTMLColorCode code) : r((code >> 16) & 0xFF), g((code >> 8) & 0xFF), b(code & 0xFF) {}
+    CRGB(uint32_t code) : r((code >> 16) & 0xFF), g((code >> 8) & 0xFF), b(code & 0xFF) {}
+
+    uint8_t& operator[](uint8_t i) { return raw[i]; }
+    const uint8_t& operator[](uint8_t i) const { return raw[i]; }
+
+    CRGB& nscale8(uint8_t scale) {
+        r = scale8(r, scale);
+        g = scale8(g, scale);
+        b = scale8(b, scale);
+        return *this;
+    }
+
+    CRGB& nscale8_video(uint8_t scale) {
+        r = scale8_video(r, scale);
+        g = scale8_video(g, scale);
+        b = scale8_video(b, scale);
+        return *this;
+    }
+
+    CRGB& fadeToBlackBy(uint8_t amount) { return nscale8(255 - amount); }
+
+    CRGB& operator+=(const CRGB& rhs) {
+        r = qadd8(r, rhs.r);
+        g = qadd8(g, rhs.g);
+        b = qadd8(b, rhs.b);
+        return *this;
+    }
+
+    CRGB& operator|=(const CRGB& rhs) {
+        if (rhs.r > r) r = rhs.r;
+        if (rhs.g > g) g = rhs.g;
+        if (rhs.b > b) b = rhs.b;
+        return *this;
+    }
+
+    uint8_t getAverageLight() const { return (uint8_t)(((uint16_t)r + g + b) / 3); }
+
+    explicit operator bool() const { return r || g || b; }
+};
+
+inline bool operator==(const CRGB& a, const CRGB& b) { return a.r == b.r && a.g == b.g && a.b == b.b; }
+inline bool operator!=(const CRGB& a, const CRGB& b) { return !(a == b); }
+
+enum EOrder { RGB = 0012, GRB = 0102 };
+
+template <uint8_t DATA_PIN, EOrder RGB_ORDER>
+class WS2812B {};
+
+class CLEDController {
+public:
+    CLEDController(uint8_t pin, CRGB* data, int count) : pin(pin), ledData(data), ledCount(count) {}
+
+    CLEDController& setLeds(CRGB* data, int count) {
+        ledData = data;
+        ledCount = count;
+        return *this;
+    }
+
+    void showLeds(uint8_t brightness = 255);
+
+    CRGB* leds() { return ledData; }
+    int size() const { return ledCount; }
+    uint8_t getPin() const { return pin; }
+
+    // Host-side copy of the last transmitted frame for this strip
+    const std::vector<CRGB>& lastFrame() const { return frame; }
+
+private:
+    uint8_t pin;
+    CRGB* ledData;
+    int ledCount;
+    std::vector<CRGB> frame;
+};
+
+class CFastLED {
+public:
+    template <template <uint8_t DATA_PIN, EOrder RGB_ORDER> class CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+    CLEDController& addLeds(CRGB* data, int count, int offset = 0) {
+        return registerController(DATA_PIN, data + offset, count);
+    }
+
+    void show();
+    void show(uint8_t brightness);
+
+    void setBrightness(uint8_t scale) { brightness = scale; }
+    uint8_t getBrightness() const { return brightness; }
+
+    int count() const { return (int)controllers.size(); }
+    CLEDController& operator[](int index) { return *controllers[index]; }
+
+    // Host-side frame sink statistics
+    uint32_t getShowCount() const { return showCount; }
+    void reset();
+
+private:
+    CLEDController& registerController(uint8_t pin, CRGB* data, int count);
+
+    std::vector<CLEDController*> controllers;
+    uint8_t brightness = 255;
+    uint32_t showCount = 0;
+};
+
+extern CFastLED FastLED;
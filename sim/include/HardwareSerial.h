@@ -0,0 +1,69 @@
+#pragma once
+
+#include <deque>
+#include "Stream.h"
+
+#define SERIAL_8N1 0x800001c
+
+namespace sim {
+
+// Host-side peer of a virtual UART: sees every byte the firmware writes.
+class SerialDevice {
+public:
+    virtual ~SerialDevice() = default;
+    virtual void onHostWrite(const uint8_t* data, size_t len) = 0;
+    // Called before the firmware reads, to deliver replies that are due
+    virtual void onHostPoll() {}
+};
+
+// Console echo for Serial (UART0); benchmarks turn it off.
+void setConsoleEcho(bool enabled);
+bool isConsoleEchoEnabled();
+
+} // namespace sim
+
+class HardwareSerial : public Stream {
+public:
+    explicit HardwareSerial(int uartNum) : uartNum(uartNum) {}
+
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1) {
+        this->baud = baud;
+        (void)config; (void)rxPin; (void)txPin;
+    }
+    void end() { rxBuffer.clear(); }
+    operator bool() const { return true; }
+
+    int available() override {
+        if (device) device->onHostPoll();
+        return (int)rxBuffer.size();
+    }
+    int read() override {
+        if (device) device->onHostPoll();
+        if (rxBuffer.empty()) return -1;
+        uint8_t c = rxBuffer.front();
+        rxBuffer.pop_front();
+        return c;
+    }
+    int peek() override {
+        if (device) device->onHostPoll();
+        return rxBuffer.empty() ? -1 : rxBuffer.front();
+    }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+    // Host-side hooks
+    void attachDevice(sim::SerialDevice* device) { this->device = device; }
+    void inject(const uint8_t* data, size_t len) { rxBuffer.insert(rxBuffer.end(), data, data + len); }
+    unsigned long getBaudRate() const { return baud; }
+
+private:
+    int uartNum;
+    unsigned long baud = 0;
+    std::deque<uint8_t> rxBuffer;
+    sim::SerialDevice* device = nullptr;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace sim {
+
+// Virtual time base behind millis()/micros()/delay() in the host build.
+// Time only moves when the simulation advances it, so runs are repeatable.
+void setMicros(uint64_t now);
+void advanceMicros(uint64_t delta);
+inline void advanceMillis(uint32_t delta) { advanceMicros((uint64_t)delta * 1000); }
+uint64_t nowMicros();
+
+// Switch to real time, for runs that talk to other processes (sync groups):
+// the clock follows the host's monotonic clock from this call, shifted
+// by offsetUs and running driftPpm fast or slow like a real crystal, and
+// delay() sleeps. Thread-safe once switched.
+void useWallClock(int64_t offsetUs = 0, int32_t driftPpm = 0);
+
+} // namespace sim
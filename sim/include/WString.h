@@ -0,0 +1,126 @@
+#pragma once
+
+// Host build: std::string-backed subset of the Arduino String API used by the
+// core sources (config, vfx, hardware, audio).
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define DEC 10
+#define HEX 16
+
+class String {
+public:
+    String() {}
+    String(const char* s) : str(s ? s : "") {}
+    String(const char* s, size_t len) : str(s ? std::string(s, len) : std::string()) {}
+    String(const std::string& s) : str(s) {}
+    String(char c) : str(1, c) {}
+    String(int value, unsigned char base = DEC) : str(format(value, base)) {}
+    String(unsigned int value, unsigned char base = DEC) : str(formatUnsigned(value, base)) {}
+    String(long value, unsigned char base = DEC) : str(format(value, base)) {}
+    String(unsigned long value, unsigned char base = DEC) : str(formatUnsigned(value, base)) {}
+    String(float value, unsigned int decimals = 2) : str(formatFloat(value, decimals)) {}
+    String(double value, unsigned int decimals = 2) : str(formatFloat(value, decimals)) {}
+
+    const char* c_str() const { return str.c_str(); }
+    unsigned int length() const { return (unsigned int)str.length(); }
+    bool isEmpty() const { return str.empty(); }
+    bool reserve(unsigned int size) { str.reserve(size); return true; }
+
+    char charAt(unsigned int index) const { return index < str.length() ? str[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+
+    bool concat(const String& s) { str += s.str; return true; }
+    bool concat(const char* s) { if (!s) return false; str += s; return true; }
+    bool concat(const char* s, unsigned int len) { if (!s) return false; str.append(s, len); return true; }
+    bool concat(char c) { str += c; return true; }
+
+    String& operator+=(const String& s) { str += s.str; return *this; }
+    String& operator+=(const char* s) { if (s) str += s; return *this; }
+    String& operator+=(char c) { str += c; return *this; }
+
+    bool operator==(const String& s) const { return str == s.str; }
+    bool operator==(const char* s) const { return str == (s ? s : ""); }
+    bool operator!=(const String& s) const { return str != s.str; }
+    bool operator!=(const char* s) const { return !(*this == s); }
+    bool operator<(const String& s) const { return str < s.str; }
+    bool equals(const String& s) const { return str == s.str; }
+
+    int indexOf(char c, unsigned int from = 0) const {
+        size_t pos = str.find(c, from);
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+    int indexOf(const String& s, unsigned int from = 0) const {
+        size_t pos = str.find(s.str, from);
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+    bool startsWith(const String& prefix) const { return str.compare(0, prefix.str.length(), prefix.str) == 0; }
+    bool endsWith(const String& suffix) const {
+        return str.length() >= suffix.str.length() &&
+               str.compare(str.length() - suffix.str.length(), suffix.str.length(), suffix.str) == 0;
+    }
+
+    String substring(unsigned int from) const { return from < str.length() ? String(str.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from >= str.length() || to <= from) return String();
+        return String(str.substr(from, to - from));
+    }
+
+    long toInt() const { return strtol(str.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(str.c_str(), nullptr); }
+
+    void toLowerCase() { for (char& c : str) if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a'; }
+    void toUpperCase() { for (char& c : str) if (c >= 'a' && c <= 'z') c = c - 'a' + 'A'; }
+    void trim() {
+        size_t start = str.find_first_not_of(" \t\r\n");
+        size_t end = str.find_last_not_of(" \t\r\n");
+        str = (start == std::string::npos) ? std::string() : str.substr(start, end - start + 1);
+    }
+    void replace(const String& find, const String& replacement) {
+        if (find.str.empty()) return;
+        size_t pos = 0;
+        while ((pos = str.find(find.str, pos)) != std::string::npos) {
+            str.replace(pos, find.str.length(), replacement.str);
+            pos += replacement.str.length();
+        }
+    }
+
+    const std::string& std() const { return str; }
+
+    friend String operator+(const String& a, const String& b) { return String(a.str + b.str); }
+    friend String operator+(const String& a, const char* b) { return String(a.str + (b ? b : "")); }
+    friend String operator+(const char* a, const String& b) { return String((a ? a : "") + b.str); }
+    friend String operator+(const String& a, char b) { return String(a.str + b); }
+    friend String operator+(const String& a, int b) { return a + String(b); }
+    friend String operator+(const String& a, unsigned int b) { return a + String(b); }
+    friend String operator+(const String& a, long b) { return a + String(b); }
+    friend String operator+(const String& a, unsigned long b) { return a + String(b); }
+
+private:
+    std::string str;
+
+    static std::string format(long value, unsigned char base) {
+        if (base == DEC) return std::to_string(value);
+        return formatUnsigned((unsigned long)value, base);
+    }
+
+    static std::string formatUnsigned(unsigned long value, unsigned char base) {
+        if (base == DEC) return std::to_string(value);
+        static const char digits[] = "0123456789abcdef";
+        std::string out;
+        do {
+            out.insert(out.begin(), digits[value % base]);
+            value /= base;
+        } while (value);
+        return out;
+    }
+
+    static std::string formatFloat(double value, unsigned int decimals) {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, value);
+        return buffer;
+    }
+};
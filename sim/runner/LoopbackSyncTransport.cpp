@@ -0,0 +1,71 @@
+#include "LoopbackSyncTransport.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace BattleAura {
+
+namespace {
+
+sockaddr_in loopbackAddress(uint16_t port) {
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    return address;
+}
+
+} // namespace
+
+LoopbackSyncTransport::LoopbackSyncTransport(SyncGroup& group, uint8_t index) : group(group), index(index) {
+}
+
+LoopbackSyncTransport::~LoopbackSyncTransport() {
+    running = false;
+    if (receiver.joinable()) receiver.join();
+    if (socketFd >= 0) close(socketFd);
+}
+
+bool LoopbackSyncTransport::begin() {
+    socketFd = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in address = loopbackAddress(SyncGroup::PORT + index);
+    if (socketFd < 0 || bind(socketFd, (const sockaddr*)&address, sizeof(address)) != 0) {
+        printf("Cannot bind sync port %d (another instance with --sync %d?)\n", SyncGroup::PORT + index, index);
+        return false;
+    }
+
+    running = true;
+    receiver = std::thread(&LoopbackSyncTransport::receiveLoop, this);
+    return true;
+}
+
+bool LoopbackSyncTransport::send(const uint8_t* data, size_t length) {
+    bool sent = false;
+    for (uint8_t i = 0; i < SyncGroup::MAX_MEMBERS; i++) {
+        if (i == index) continue;
+        sockaddr_in address = loopbackAddress(SyncGroup::PORT + i);
+        if (sendto(socketFd, data, length, 0, (const sockaddr*)&address, sizeof(address)) == (ssize_t)length) {
+            sent = true;
+        }
+    }
+    return sent;
+}
+
+void LoopbackSyncTransport::receiveLoop() {
+    uint8_t buffer[SyncGroup::MAX_MESSAGE_SIZE + 1];
+    pollfd waitFor = {socketFd, POLLIN, 0};
+
+    while (running) {
+        // Wake now and then to notice shutdown
+        if (poll(&waitFor, 1, 100) <= 0) continue;
+
+        ssize_t length = recv(socketFd, buffer, sizeof(buffer), 0);
+        if (length > 0) {
+            group.receive(buffer, (size_t)length, micros());
+        }
+    }
+}
+
+} // namespace BattleAura
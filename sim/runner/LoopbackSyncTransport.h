@@ -0,0 +1,31 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include "sync/SyncGroup.h"
+
+namespace BattleAura {
+
+// Sync group transport for several simulator instances on one machine.
+// Instance n listens on 127.0.0.1:PORT+n and sends each message to the ports
+// of all MAX_MEMBERS possible instances, which is what multicast does on the
+// device. A receive thread stands in for the network task.
+class LoopbackSyncTransport : public SyncTransport {
+public:
+    LoopbackSyncTransport(SyncGroup& group, uint8_t index);
+    ~LoopbackSyncTransport() override;
+
+    bool begin();
+    bool send(const uint8_t* data, size_t length) override;
+
+private:
+    SyncGroup& group;
+    const uint8_t index;
+    int socketFd = -1;
+    std::thread receiver;
+    std::atomic<bool> running{false};
+
+    void receiveLoop();
+};
+
+} // namespace BattleAura
@@ -0,0 +1,525 @@
+// Host simulation runner for the native build.
+//
+// Runs the firmware's render loop (VFXManager -> LedController) on virtual
+// time, replays a scenario script and writes every rendered frame to a text
+// capture that can be diffed between builds.
+//
+//   battleaura_sim [--data DIR] [--script FILE] [--frames FILE]
+//                  [--duration MS] [--fps N] [--seed N] [--verbose]
+//                  [--sync N [--clock-offset MS] [--clock-drift PPM]]
+//
+// --sync N makes this instance device N (0-7) of a sync group on localhost:
+// time becomes real, paced by FrameScheduler, the local clock is shifted and
+// skewed by --clock-offset/--clock-drift, and sync messages go between
+// instances over UDP. Start several with their own --data directories; each
+// prints the host time every sync trigger ran at, to check the skew the group
+// reports against the truth:
+//
+//   for n in 0 1 2; do
+//     battleaura_sim --sync $n --data sim_data$n --clock-offset $((n * 7777)) --script sim/scenarios/sync.txt --duration 9000 &
+//   done
+//
+// Scenario scripts hold one command per line; '#' starts a comment.
+// Setup commands (no timestamp) are applied before the first frame:
+//
+//   zone <id> <gpio> <pwm|ws2812b> <ledCount> <group> [name]
+//   scene <vfx> <ambient|active|global> <group[,group...]> [audioFile]
+//   cue <scene> <atMs> audio <file>
+//   cue <scene> <atMs> trigger <vfx> [durationMs]
+//   cue <scene> <atMs> color <RRGGBB>
+//   cue <scene> <atMs> intensity <0-255>
+//   reactive <scene>          (follows <data>/envelopes/NNNN.env of its audio)
+//   param <scene> <name> <value>
+//
+// Timed commands run at the first frame at or after <ms>:
+//
+//   <ms> trigger <vfx> [durationMs] [group]   (group overrides the scene's)
+//   <ms> enable <vfx>
+//   <ms> disable <vfx>
+//   <ms> stop <all|active|global>
+//   <ms> brightness <zoneId> <0-255>
+//   <ms> sync-trigger <vfx> [durationMs] [N]  (from sync instance N, default 0,
+//                                              run on every device in the group)
+
+#include <Arduino.h>
+#include <DFPlayerDevice.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "config/Configuration.h"
+#include "hardware/LedController.h"
+#include "vfx/VFXManager.h"
+#include "audio/AudioController.h"
+#include "core/AllocCounter.h"
+#include "core/FrameScheduler.h"
+#include "sync/SyncGroup.h"
+#include "LoopbackSyncTransport.h"
+
+using namespace BattleAura;
+
+Configuration BattleAura::config;
+
+namespace {
+
+struct Options {
+    std::string dataDir = "sim_data";
+    std::string scriptPath;
+    std::string framesPath;
+    uint32_t durationMs = 10000;
+    uint8_t fps = 50;
+    unsigned long seed = 1;
+    bool verbose = false;
+    int syncIndex = -1;             // Sync group instance, -1 = virtual time, no group
+    int32_t clockOffsetMs = 0;
+    int32_t clockDriftPpm = 0;
+};
+
+struct TimedCommand {
+    uint32_t timeMs;
+    std::vector<std::string> args;
+    int line;
+};
+
+struct RenderStats {
+    uint32_t frames = 0;
+    uint64_t totalNs = 0;
+    uint64_t maxNs = 0;
+    uint32_t allocatingFrames = 0;
+    uint32_t maxAllocs = 0;
+};
+
+void printUsage() {
+    printf("Usage: battleaura_sim [--data DIR] [--script FILE] [--frames FILE]\n"
+           "                      [--duration MS] [--fps N] [--seed N] [--verbose]\n"
+           "                      [--sync N [--clock-offset MS] [--clock-drift PPM]]\n");
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--verbose") {
+            options.verbose = true;
+        } else if (arg == "--help" || arg == "-h") {
+            return false;
+        } else if (!hasValue) {
+            printf("Missing value for %s\n", arg.c_str());
+            return false;
+        } else if (arg == "--data") {
+            options.dataDir = argv[++i];
+        } else if (arg == "--script") {
+            options.scriptPath = argv[++i];
+        } else if (arg == "--frames") {
+            options.framesPath = argv[++i];
+        } else if (arg == "--duration") {
+            options.durationMs = strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--fps") {
+            options.fps = (uint8_t)constrain(strtoul(argv[++i], nullptr, 10), 1UL, 250UL);
+        } else if (arg == "--seed") {
+            options.seed = strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--sync") {
+            options.syncIndex = (int)strtol(argv[++i], nullptr, 10);
+            if (options.syncIndex < 0 || options.syncIndex >= SyncGroup::MAX_MEMBERS) {
+                printf("--sync takes 0-%d\n", SyncGroup::MAX_MEMBERS - 1);
+                return false;
+            }
+        } else if (arg == "--clock-offset") {
+            options.clockOffsetMs = (int32_t)strtol(argv[++i], nullptr, 10);
+        } else if (arg == "--clock-drift") {
+            options.clockDriftPpm = (int32_t)strtol(argv[++i], nullptr, 10);
+        } else {
+            printf("Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::string> splitWords(const std::string& text, char separator = ' ') {
+    std::vector<std::string> words;
+    if (separator == ' ') {
+        std::istringstream stream(text);
+        std::string word;
+        while (stream >> word) words.push_back(word);
+    } else {
+        std::string word;
+        std::istringstream stream(text);
+        while (std::getline(stream, word, separator)) {
+            if (!word.empty()) words.push_back(word);
+        }
+    }
+    return words;
+}
+
+bool applyZone(const std::vector<std::string>& args, LedController& leds) {
+    // zone <id> <gpio> <pwm|ws2812b> <ledCount> <group> [name]
+    if (args.size() < 6) return false;
+
+    Zone zone;
+    zone.id = (uint8_t)strtoul(args[1].c_str(), nullptr, 10);
+    zone.gpio = (uint8_t)strtoul(args[2].c_str(), nullptr, 10);
+    zone.type = (args[3] == "ws2812b") ? ZoneType::WS2812B : ZoneType::PWM;
+    zone.ledCount = (uint8_t)strtoul(args[4].c_str(), nullptr, 10);
+    zone.groupName = args[5].c_str();
+    zone.name = args.size() > 6 ? String(args[6].c_str()) : String("Zone ") + String((int)zone.id);
+    zone.brightness = 255;
+    zone.enabled = true;
+
+    if (!config.addZone(zone)) return false;
+    leds.addZone(zone);
+    return leds.isZoneConfigured(zone.id);
+}
+
+bool applyScene(const std::vector<std::string>& args) {
+    // scene <vfx> <ambient|active|global> <group[,group...]> [audioFile]
+    if (args.size() < 4) return false;
+
+    SceneType type = SceneType::AMBIENT;
+    if (args[2] == "active") type = SceneType::ACTIVE;
+    else if (args[2] == "global") type = SceneType::GLOBAL;
+    else if (args[2] != "ambient") return false;
+
+    SceneConfig scene(args[1].c_str(), type);
+    for (const std::string& group : splitWords(args[3], ',')) {
+        scene.addTargetGroup(group.c_str());
+    }
+    if (args.size() > 4) {
+        scene.setAudio((uint16_t)strtoul(args[4].c_str(), nullptr, 10));
+    }
+    return config.addSceneConfig(scene);
+}
+
+bool applyCue(const std::vector<std::string>& args) {
+    // cue <scene> <atMs> <audio|trigger|color|intensity> <value> [durationMs]
+    if (args.size() < 5) return false;
+
+    SceneConfig* scene = config.getSceneConfig(args[1].c_str());
+    TimelineCue cue;
+    if (!scene || !parseTimelineAction(args[3].c_str(), cue.action)) return false;
+
+    cue.atMs = strtoul(args[2].c_str(), nullptr, 10);
+    switch (cue.action) {
+        case TimelineCue::Action::AUDIO:
+            cue.fileNumber = (uint16_t)strtoul(args[4].c_str(), nullptr, 10);
+            break;
+        case TimelineCue::Action::TRIGGER:
+            cue.vfxName = args[4].c_str();
+            cue.duration = args.size() > 5 ? strtoul(args[5].c_str(), nullptr, 10) : 0;
+            break;
+        case TimelineCue::Action::COLOR:
+            cue.color = strtoul(args[4].c_str(), nullptr, 16);
+            break;
+        case TimelineCue::Action::INTENSITY:
+            cue.intensity = (uint8_t)constrain(strtoul(args[4].c_str(), nullptr, 10), 0UL, 255UL);
+            break;
+    }
+
+    scene->timeline.push_back(cue);
+    sortTimeline(scene->timeline);
+    return true;
+}
+
+bool applyReactive(const std::vector<std::string>& args) {
+    // reactive <scene>
+    if (args.size() != 2) return false;
+
+    SceneConfig* scene = config.getSceneConfig(args[1].c_str());
+    if (!scene) return false;
+    scene->audioReactive = true;
+    return true;
+}
+
+bool applyParam(const std::vector<std::string>& args) {
+    // param <scene> <name> <value>
+    if (args.size() != 4) return false;
+
+    SceneConfig* scene = config.getSceneConfig(args[1].c_str());
+    if (!scene) return false;
+    scene->parameters[args[2]] = strtoul(args[3].c_str(), nullptr, 10);
+    return true;
+}
+
+bool applyCommand(const TimedCommand& command, VFXManager& vfx, LedController& leds, SyncGroup& syncGroup,
+                  int syncIndex) {
+    const std::vector<std::string>& args = command.args;
+    const std::string& name = args[0];
+
+    if (name == "trigger" && args.size() >= 2) {
+        uint32_t duration = args.size() > 2 ? strtoul(args[2].c_str(), nullptr, 10) : 0;
+        if (args.size() > 3) return vfx.triggerVFXOnGroup(args[1].c_str(), args[3].c_str(), duration);
+        return vfx.triggerVFX(args[1].c_str(), duration);
+    }
+    if (name == "sync-trigger" && args.size() >= 2) {
+        uint32_t duration = args.size() > 2 ? strtoul(args[2].c_str(), nullptr, 10) : 0;
+        int sender = args.size() > 3 ? (int)strtol(args[3].c_str(), nullptr, 10) : 0;
+        if (sender != std::max(syncIndex, 0)) return true;     // Another instance's to send
+        return vfx.hasVFX(args[1].c_str()) && syncGroup.requestTrigger(args[1].c_str(), duration);
+    }
+    if (name == "enable" && args.size() == 2) return vfx.enableVFX(args[1].c_str());
+    if (name == "disable" && args.size() == 2) return vfx.disableVFX(args[1].c_str());
+    if (name == "stop" && args.size() == 2) {
+        if (args[1] == "all") vfx.stopAllVFX();
+        else if (args[1] == "active") vfx.stopActiveVFX();
+        else if (args[1] == "global") vfx.stopGlobalVFX();
+        else return false;
+        return true;
+    }
+    if (name == "brightness" && args.size() == 3) {
+        uint8_t zoneId = (uint8_t)strtoul(args[1].c_str(), nullptr, 10);
+        if (!leds.isZoneConfigured(zoneId)) return false;
+        leds.setUserBrightness(zoneId, (uint8_t)constrain(strtoul(args[2].c_str(), nullptr, 10), 0UL, 255UL));
+        return true;
+    }
+    return false;
+}
+
+bool loadScript(const std::string& path, LedController& leds, std::vector<TimedCommand>& timeline) {
+    std::ifstream file(path);
+    if (!file) {
+        printf("Cannot open script %s\n", path.c_str());
+        return false;
+    }
+
+    std::string text;
+    int lineNumber = 0;
+    while (std::getline(file, text)) {
+        lineNumber++;
+        size_t comment = text.find('#');
+        if (comment != std::string::npos) text.erase(comment);
+
+        std::vector<std::string> words = splitWords(text);
+        if (words.empty()) continue;
+
+        if (words[0] == "zone" || words[0] == "scene" || words[0] == "cue" || words[0] == "reactive" ||
+            words[0] == "param") {
+            bool ok = (words[0] == "zone") ? applyZone(words, leds) :
+                      (words[0] == "scene") ? applyScene(words) :
+                      (words[0] == "cue") ? applyCue(words) :
+                      (words[0] == "param") ? applyParam(words) : applyReactive(words);
+            if (!ok) {
+                printf("%s:%d: invalid %s command\n", path.c_str(), lineNumber, words[0].c_str());
+                return false;
+            }
+            continue;
+        }
+
+        char* end = nullptr;
+        uint32_t timeMs = strtoul(words[0].c_str(), &end, 10);
+        if (*end != '\0' || words.size() < 2) {
+            printf("%s:%d: expected '<ms> <command> ...'\n", path.c_str(), lineNumber);
+            return false;
+        }
+        words.erase(words.begin());
+        timeline.push_back({timeMs, words, lineNumber});
+    }
+
+    // Commands with equal timestamps keep their file order
+    std::stable_sort(timeline.begin(), timeline.end(),
+                     [](const TimedCommand& a, const TimedCommand& b) { return a.timeMs < b.timeMs; });
+    return true;
+}
+
+// One capture line per zone output: PWM zones report their LEDC duty, strips
+// report the pixels FastLED last transmitted.
+void captureFrame(std::string& out) {
+    char buffer[16];
+    out.clear();
+
+    for (Zone* zone : config.getAllZones()) {
+        snprintf(buffer, sizeof(buffer), " %u=", zone->id);
+        out += buffer;
+
+        if (zone->type == ZoneType::PWM) {
+            uint32_t duty = 0;
+            sim::getPwmDutyForPin(zone->gpio, duty);
+            snprintf(buffer, sizeof(buffer), "%u", (unsigned)duty);
+            out += buffer;
+            continue;
+        }
+
+        for (int i = 0; i < FastLED.count(); i++) {
+            CLEDController& controller = FastLED[i];
+            if (controller.getPin() != zone->gpio) continue;
+            for (const CRGB& pixel : controller.lastFrame()) {
+                snprintf(buffer, sizeof(buffer), "%02x%02x%02x", pixel.r, pixel.g, pixel.b);
+                out += buffer;
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 2;
+    }
+
+    sim::setConsoleEcho(options.verbose);
+    sim::setFilesystemRoot(options.dataDir.c_str());
+    randomSeed(options.seed);
+
+    // This thread stands in for the render task
+    AllocCounter::trackCurrentTask();
+
+    const bool synced = options.syncIndex >= 0;
+    if (synced) {
+        sim::useWallClock((int64_t)options.clockOffsetMs * 1000, options.clockDriftPpm);
+    }
+
+    LedController ledController;
+    AudioController audioController(config);
+    FrameScheduler frameScheduler;
+    VFXManager vfxManager(ledController, audioController, config, &frameScheduler);
+
+    // Without --sync the group is just this instance, so sync-trigger still
+    // works on virtual time
+    SyncGroup syncGroup(vfxManager, (uint32_t)std::max(options.syncIndex, 0) + 1);
+    LoopbackSyncTransport syncTransport(syncGroup, (uint8_t)options.syncIndex);
+
+    if (!config.begin() || !ledController.begin()) {
+        printf("Initialization failed (data directory %s)\n", options.dataDir.c_str());
+        return 1;
+    }
+    for (Zone* zone : config.getAllZones()) {
+        ledController.addZone(*zone);
+    }
+
+    std::vector<TimedCommand> timeline;
+    if (!options.scriptPath.empty() && !loadScript(options.scriptPath, ledController, timeline)) {
+        return 1;
+    }
+
+    vfxManager.begin();
+    sim::attachAudioPlayer(Serial1);
+    audioController.begin();
+
+    if (synced) {
+        if (!syncTransport.begin()) return 1;
+        syncGroup.begin(syncTransport);
+        frameScheduler.begin(options.fps);
+    }
+
+    FILE* frames = nullptr;
+    if (!options.framesPath.empty()) {
+        frames = fopen(options.framesPath.c_str(), "w");
+        if (!frames) {
+            printf("Cannot write %s\n", options.framesPath.c_str());
+            return 1;
+        }
+        fprintf(frames, "# BattleAura frame capture: %u fps, seed %lu\n", options.fps, options.seed);
+    }
+
+    const uint32_t framePeriodUs = 1000000UL / options.fps;
+    const uint64_t startUs = sim::nowMicros();
+    size_t nextCommand = 0;
+    size_t audioLogged = 0;
+    int failures = 0;
+    std::string frame;
+    std::string lastFrame;
+    RenderStats stats;
+    uint32_t syncRunsLogged = 0;
+
+    for (uint32_t frameIndex = 0;; frameIndex++) {
+        // Virtual time advances by exactly one frame period per frame; a sync
+        // group instance runs in real time like the firmware's render task
+        uint32_t now;
+        if (synced) {
+            now = frameScheduler.waitForFrame();
+        } else {
+            sim::setMicros(startUs + (uint64_t)frameIndex * framePeriodUs);
+            now = millis();
+        }
+        auto frameStart = std::chrono::steady_clock::now();
+        uint32_t elapsedMs = (uint32_t)((sim::nowMicros() - startUs) / 1000);
+        if (elapsedMs > options.durationMs) break;
+
+        while (nextCommand < timeline.size() && timeline[nextCommand].timeMs <= elapsedMs) {
+            const TimedCommand& command = timeline[nextCommand++];
+            if (!applyCommand(command, vfxManager, ledController, syncGroup, options.syncIndex)) {
+                printf("script line %d: '%s' failed\n", command.line, command.args[0].c_str());
+                failures++;
+            }
+        }
+
+        uint32_t allocsBefore = AllocCounter::getAllocationCount();
+        auto renderStart = std::chrono::steady_clock::now();
+
+        vfxManager.update(now);
+        ledController.update(now);
+
+        uint64_t renderNs = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - renderStart).count();
+        uint32_t allocs = AllocCounter::getAllocationCount() - allocsBefore;
+
+        audioController.update();
+
+        if (synced) {
+            frameScheduler.endFrame();
+            frameScheduler.adjustPhase(syncGroup.getFrameCorrectionUs(frameScheduler.getNextFrameUs(),
+                                                                      frameScheduler.getFramePeriodUs()));
+        }
+        syncGroup.update(micros());
+
+        // A sync trigger ran this frame: log the host's clock, which all
+        // instances share, as the true run time to compare across them
+        for (; syncRunsLogged < syncGroup.getStats().triggersRun; syncRunsLogged++) {
+            printf("sync run %u at host %lld us\n", syncRunsLogged + 1,
+                   (long long)std::chrono::duration_cast<std::chrono::microseconds>(
+                       frameStart.time_since_epoch()).count());
+        }
+
+        stats.frames++;
+        stats.totalNs += renderNs;
+        if (renderNs > stats.maxNs) stats.maxNs = renderNs;
+        if (allocs > 0) stats.allocatingFrames++;
+        if (allocs > stats.maxAllocs) stats.maxAllocs = allocs;
+
+        if (frames) {
+            const std::vector<sim::AudioCommand>& audio = sim::audioLog();
+            for (; audioLogged < audio.size(); audioLogged++) {
+                // Status polls are not output; leave them out of the capture
+                if (strcmp(audio[audioLogged].command, "query") == 0) continue;
+                fprintf(frames, "%u audio %s %d\n", elapsedMs, audio[audioLogged].command,
+                        audio[audioLogged].argument);
+            }
+
+            // Only frames whose output changed are written, keeping captures diffable
+            captureFrame(frame);
+            if (frame != lastFrame) {
+                fprintf(frames, "%u%s\n", elapsedMs, frame.c_str());
+                lastFrame.swap(frame);
+            }
+        }
+    }
+
+    if (frames) fclose(frames);
+
+    const LedStats& ledStats = ledController.getStats();
+    printf("Simulated %u ms: %u frames at %u fps, %u zones\n", options.durationMs, stats.frames,
+           options.fps, (unsigned)config.getAllZones().size());
+    printf("Render: avg %llu ns, max %llu ns per frame\n",
+           (unsigned long long)(stats.frames ? stats.totalNs / stats.frames : 0),
+           (unsigned long long)stats.maxNs);
+    if (AllocCounter::isEnabled()) {
+        printf("Allocations: %u frames allocated, max %u per frame\n", stats.allocatingFrames, stats.maxAllocs);
+    }
+    printf("Shows: %u performed, %u skipped\n", ledStats.showsPerformed, ledStats.showsSkipped);
+    printf("Audio commands: %u\n", (unsigned)sim::audioLog().size());
+    if (synced) {
+        const SyncStats& syncStats = syncGroup.getStats();
+        printf("Sync: device %u of %u, master %u, offset %d us (rtt %u us), %u clock samples\n",
+               (unsigned)syncGroup.getDeviceId(), syncGroup.getMemberCount(), (unsigned)syncGroup.getMasterId(),
+               (int)syncGroup.getOffsetUs(), (unsigned)syncStats.bestRttUs, (unsigned)syncStats.clockSamples);
+        printf("Sync: %u triggers sent, %u run | skew %u samples, last %u us, avg %u us, max %u us\n",
+               (unsigned)syncStats.triggersSent, (unsigned)syncStats.triggersRun, (unsigned)syncStats.skewSamples,
+               (unsigned)syncStats.lastSkewUs, (unsigned)syncStats.avgSkewUs, (unsigned)syncStats.maxSkewUs);
+    }
+
+    return failures ? 1 : 0;
+}
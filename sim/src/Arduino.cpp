@@ -0,0 +1,111 @@
+#include <Arduino.h>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+uint64_t simMicros = 0;
+bool wallClock = false;
+std::chrono::steady_clock::time_point wallStart;
+int64_t wallOffsetUs = 0;
+int32_t wallDriftPpm = 0;
+uint32_t rngState = 0x12345678;
+uint32_t pwmDuty[16] = {0};
+int16_t pwmPin[16] = {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+
+uint32_t nextRandom() {
+    // xorshift32 - deterministic for a given randomSeed()
+    uint32_t x = rngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rngState = x;
+    return x;
+}
+
+} // namespace
+
+namespace sim {
+
+void setMicros(uint64_t now) { simMicros = now; }
+void advanceMicros(uint64_t delta) { simMicros += delta; }
+
+uint64_t nowMicros() {
+    if (!wallClock) return simMicros;
+
+    int64_t elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - wallStart).count();
+    int64_t localUs = elapsedUs + elapsedUs * wallDriftPpm / 1000000 + wallOffsetUs;
+    return localUs > 0 ? (uint64_t)localUs : 0;
+}
+
+void useWallClock(int64_t offsetUs, int32_t driftPpm) {
+    wallStart = std::chrono::steady_clock::now();
+    wallOffsetUs = offsetUs;
+    wallDriftPpm = driftPpm;
+    wallClock = true;
+}
+
+uint32_t getPwmDuty(uint8_t channel) {
+    return channel < 16 ? pwmDuty[channel] : 0;
+}
+
+bool getPwmDutyForPin(uint8_t pin, uint32_t& duty) {
+    for (uint8_t channel = 0; channel < 16; channel++) {
+        if (pwmPin[channel] == pin) {
+            duty = pwmDuty[channel];
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace sim
+
+uint32_t millis() { return (uint32_t)(sim::nowMicros() / 1000); }
+uint32_t micros() { return (uint32_t)sim::nowMicros(); }
+
+void delay(uint32_t ms) {
+    if (wallClock) std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    else simMicros += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(uint32_t us) {
+    if (wallClock) std::this_thread::sleep_for(std::chrono::microseconds(us));
+    else simMicros += us;
+}
+void yield() {}
+
+long random(long howBig) {
+    if (howBig <= 0) return 0;
+    return (long)(nextRandom() % (uint32_t)howBig);
+}
+
+long random(long howSmall, long howBig) {
+    if (howSmall >= howBig) return howSmall;
+    return howSmall + random(howBig - howSmall);
+}
+
+void randomSeed(unsigned long seed) {
+    rngState = seed ? (uint32_t)seed : 0x12345678;
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    if (inMax == inMin) return outMin;
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+double ledcSetup(uint8_t channel, double freq, uint8_t resolutionBits) {
+    (void)resolutionBits;
+    if (channel >= 16) return 0;
+    pwmDuty[channel] = 0;
+    return freq;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t channel) {
+    if (channel < 16) pwmPin[channel] = pin;
+}
+
+void ledcWrite(uint8_t channel, uint32_t duty) {
+    if (channel < 16) pwmDuty[channel] = duty;
+}
@@ -0,0 +1,160 @@
+#include <Arduino.h>
+#include <DFPlayerDevice.h>
+#include <deque>
+
+namespace {
+
+const uint8_t FRAME_SIZE = 10;
+const uint32_t RESET_DELAY_MS = 1500;   // Card scan after a reset
+const uint8_t STORAGE_SD = 0x02;
+
+std::vector<sim::AudioCommand> commandLog;
+bool playerPresent = true;
+uint32_t trackLengthMs = 2000;
+
+void record(const char* command, int argument = 0) {
+    commandLog.push_back({millis(), command, argument});
+}
+
+const char* commandName(uint8_t code) {
+    switch (code) {
+        case 0x01: return "next";
+        case 0x02: return "previous";
+        case 0x03: return "play";
+        case 0x06: return "volume";
+        case 0x08: return "loop";
+        case 0x0C: return "reset";
+        case 0x0D: return "resume";
+        case 0x0E: return "pause";
+        case 0x16: return "stop";
+        case 0x42: return "query";
+        default: return "unknown";
+    }
+}
+
+class DFPlayerDevice : public sim::SerialDevice {
+public:
+    void attach(HardwareSerial& serial) {
+        this->serial = &serial;
+        serial.attachDevice(this);
+    }
+
+    void onHostWrite(const uint8_t* data, size_t len) override {
+        for (size_t i = 0; i < len; i++) {
+            if (rxLength == 0 && data[i] != 0x7E) continue;
+            rxFrame[rxLength++] = data[i];
+            if (rxLength == FRAME_SIZE) {
+                rxLength = 0;
+                handleFrame();
+            }
+        }
+    }
+
+    void onHostPoll() override {
+        uint32_t now = millis();
+        while (!replies.empty() && (int32_t)(now - replies.front().dueMs) >= 0) {
+            sendFrame(replies.front().code, replies.front().parameter);
+            replies.pop_front();
+        }
+
+        // The module reports the end of a track twice
+        if (state == 1 && !looping && (int32_t)(now - finishMs) >= 0) {
+            state = 0;
+            sendFrame(0x3D, track);
+            sendFrame(0x3D, track);
+        }
+    }
+
+private:
+    struct Reply {
+        uint32_t dueMs;
+        uint8_t code;
+        uint16_t parameter;
+    };
+
+    HardwareSerial* serial = nullptr;
+    uint8_t rxFrame[FRAME_SIZE];
+    uint8_t rxLength = 0;
+    std::deque<Reply> replies;
+    uint8_t state = 0;          // 0 stopped, 1 playing, 2 paused
+    bool looping = false;
+    uint16_t track = 0;
+    uint32_t finishMs = 0;
+    uint32_t pausedRemainingMs = 0;
+
+    void handleFrame() {
+        uint16_t sum = 0;
+        for (uint8_t i = 1; i < 7; i++) sum += rxFrame[i];
+        uint16_t checksum = ((uint16_t)rxFrame[7] << 8) | rxFrame[8];
+        if (rxFrame[9] != 0xEF || (uint16_t)(sum + checksum) != 0) return;
+
+        uint8_t code = rxFrame[3];
+        bool ack = rxFrame[4] != 0;
+        uint16_t parameter = ((uint16_t)rxFrame[5] << 8) | rxFrame[6];
+        uint32_t now = millis();
+
+        record(commandName(code), parameter);
+        if (!playerPresent) return;
+
+        switch (code) {
+            case 0x03:
+            case 0x08:
+                state = 1;
+                track = parameter;
+                looping = code == 0x08;
+                finishMs = now + trackLengthMs;
+                break;
+            case 0x0C:
+                state = 0;
+                replies.clear();
+                replies.push_back({now + RESET_DELAY_MS, 0x3F, STORAGE_SD});
+                return;
+            case 0x0D:
+                if (state == 2) {
+                    state = 1;
+                    finishMs = now + pausedRemainingMs;
+                }
+                break;
+            case 0x0E:
+                if (state == 1) {
+                    state = 2;
+                    pausedRemainingMs = finishMs - now;
+                }
+                break;
+            case 0x16:
+                state = 0;
+                break;
+            case 0x42:
+                replies.push_back({now, 0x42, (uint16_t)((STORAGE_SD << 8) | state)});
+                break;
+        }
+
+        if (ack) {
+            replies.push_back({now, 0x41, 0});
+        }
+    }
+
+    void sendFrame(uint8_t code, uint16_t parameter) {
+        uint8_t frame[FRAME_SIZE] = {0x7E, 0xFF, 0x06, code, 0,
+                                     (uint8_t)(parameter >> 8), (uint8_t)parameter, 0, 0, 0xEF};
+        uint16_t sum = 0;
+        for (uint8_t i = 1; i < 7; i++) sum += frame[i];
+        uint16_t checksum = (uint16_t)(0 - sum);
+        frame[7] = checksum >> 8;
+        frame[8] = (uint8_t)checksum;
+        serial->inject(frame, FRAME_SIZE);
+    }
+};
+
+DFPlayerDevice player;
+
+} // namespace
+
+namespace sim {
+
+std::vector<AudioCommand>& audioLog() { return commandLog; }
+void attachAudioPlayer(HardwareSerial& serial) { player.attach(serial); }
+void setAudioPlayerPresent(bool present) { playerPresent = present; }
+void setAudioTrackLength(uint32_t ms) { trackLengthMs = ms; }
+
+} // namespace sim
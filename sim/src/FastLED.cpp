@@ -0,0 +1,36 @@
+#include <FastLED.h>
+#include <cstddef>
+
+void CLEDController::showLeds(uint8_t brightness) {
+    frame.resize(ledData ? ledCount : 0);
+    for (size_t i = 0; i < frame.size(); i++) {
+        frame[i] = ledData[i];
+        if (brightness != 255) frame[i].nscale8(brightness);
+    }
+}
+
+CLEDController& CFastLED::registerController(uint8_t pin, CRGB* data, int count) {
+    controllers.push_back(new CLEDController(pin, data, count));
+    return *controllers.back();
+}
+
+void CFastLED::show() {
+    show(brightness);
+}
+
+void CFastLED::show(uint8_t scale) {
+    for (CLEDController* controller : controllers) {
+        controller->showLeds(scale);
+    }
+    showCount++;
+}
+
+void CFastLED::reset() {
+    for (CLEDController* controller : controllers) {
+        delete controller;
+    }
+    controllers.clear();
+    showCount = 0;
+}
+
+CFastLED FastLED;
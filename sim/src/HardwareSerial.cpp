@@ -0,0 +1,24 @@
+#include <HardwareSerial.h>
+
+namespace {
+bool consoleEcho = true;
+}
+
+namespace sim {
+
+void setConsoleEcho(bool enabled) { consoleEcho = enabled; }
+bool isConsoleEchoEnabled() { return consoleEcho; }
+
+} // namespace sim
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    if (uartNum == 0) {
+        if (consoleEcho) fwrite(buffer, 1, size, stdout);
+    } else if (device) {
+        device->onHostWrite(buffer, size);
+    }
+    return size;
+}
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
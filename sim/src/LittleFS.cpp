@@ -0,0 +1,116 @@
+#include <LittleFS.h>
+#include <string>
+#include <sys/stat.h>
+
+namespace {
+
+std::string filesystemRoot = "sim_data";
+
+std::string resolve(const char* path) {
+    std::string relative = path ? path : "";
+    if (!relative.empty() && relative[0] == '/') relative.erase(0, 1);
+    return filesystemRoot + "/" + relative;
+}
+
+} // namespace
+
+namespace sim {
+
+void setFilesystemRoot(const char* directory) { filesystemRoot = directory; }
+const char* getFilesystemRoot() { return filesystemRoot.c_str(); }
+
+} // namespace sim
+
+namespace fs {
+
+File::File(FILE* file, const String& path) : handle(file, fclose), filePath(path) {}
+
+size_t File::write(uint8_t c) { return write(&c, 1); }
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+    return handle ? fwrite(buffer, 1, size, handle.get()) : 0;
+}
+
+int File::available() {
+    if (!handle) return 0;
+    return (int)(size() - position());
+}
+
+int File::read() {
+    if (!handle) return -1;
+    int c = fgetc(handle.get());
+    return c == EOF ? -1 : c;
+}
+
+int File::peek() {
+    if (!handle) return -1;
+    int c = fgetc(handle.get());
+    if (c == EOF) return -1;
+    ungetc(c, handle.get());
+    return c;
+}
+
+void File::flush() {
+    if (handle) fflush(handle.get());
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+    return handle ? fread(buffer, 1, size, handle.get()) : 0;
+}
+
+bool File::seek(uint32_t pos) {
+    return handle && fseek(handle.get(), pos, SEEK_SET) == 0;
+}
+
+size_t File::position() const {
+    return handle ? (size_t)ftell(handle.get()) : 0;
+}
+
+size_t File::size() const {
+    if (!handle) return 0;
+    long current = ftell(handle.get());
+    fseek(handle.get(), 0, SEEK_END);
+    long end = ftell(handle.get());
+    fseek(handle.get(), current, SEEK_SET);
+    return end < 0 ? 0 : (size_t)end;
+}
+
+void File::close() {
+    handle.reset();
+}
+
+File FS::open(const char* path, const char* mode) {
+    std::string fullPath = resolve(path);
+    std::string fileMode = mode ? mode : "r";
+    if (fileMode.find('b') == std::string::npos) fileMode += "b";
+    FILE* file = fopen(fullPath.c_str(), fileMode.c_str());
+    return file ? File(file, path) : File();
+}
+
+bool FS::exists(const char* path) {
+    struct stat info;
+    return stat(resolve(path).c_str(), &info) == 0;
+}
+
+bool FS::remove(const char* path) {
+    return ::remove(resolve(path).c_str()) == 0;
+}
+
+bool FS::mkdir(const char* path) {
+    return ::mkdir(resolve(path).c_str(), 0755) == 0 || exists(path);
+}
+
+bool LittleFSFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles, const char* partitionLabel) {
+    (void)basePath; (void)maxOpenFiles; (void)partitionLabel;
+    struct stat info;
+    if (stat(filesystemRoot.c_str(), &info) == 0) return S_ISDIR(info.st_mode);
+    return formatOnFail && ::mkdir(filesystemRoot.c_str(), 0755) == 0;
+}
+
+bool LittleFSFS::format() {
+    return true;
+}
+
+} // namespace fs
+
+fs::LittleFSFS LittleFS;
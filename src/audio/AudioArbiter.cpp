@@ -0,0 +1,139 @@
+#include "AudioArbiter.h"
+
+namespace BattleAura {
+
+static const AudioCue NO_CUE = {0, AudioPriority::AMBIENT, false};
+
+AudioArbiter::AudioArbiter(Configuration& config)
+    : config(config), current(NO_CUE), ambient(NO_CUE), queueCount(0), lastFile(0),
+      lastStartTime(0), stats{} {
+}
+
+AudioArbiter::Decision AudioArbiter::submit(const AudioCue& cue, uint32_t now) {
+    // Set by the render task, so copied out under the config lock
+    uint16_t retriggerMs;
+    AudioPolicy policy;
+    {
+        auto lock = config.lock();
+        const DeviceConfig& deviceConfig = config.getDeviceConfig();
+        retriggerMs = deviceConfig.audioRetriggerMs;
+        policy = deviceConfig.audioPolicies[(uint8_t)cue.priority];
+    }
+
+    // Rapid re-triggers of the same cue (machine gun bursts) cost UART time
+    // and restart the sound for no audible gain
+    if (cue.fileNumber == lastFile && now - lastStartTime < retriggerMs) {
+        stats.throttled++;
+        return Decision::THROTTLED;
+    }
+
+    if (cue.priority == AudioPriority::AMBIENT) {
+        AudioCue loop = cue;
+        loop.loop = true;
+
+        bool alreadyPlaying = current.fileNumber == loop.fileNumber && current.priority == AudioPriority::AMBIENT;
+        ambient = loop;
+        if (alreadyPlaying) {
+            stats.dropped++;
+            return Decision::DROPPED;
+        }
+
+        // Under a one-shot the new loop simply waits its turn
+        if (current.fileNumber != 0 && current.priority != AudioPriority::AMBIENT) {
+            stats.queued++;
+            return Decision::QUEUED;
+        }
+        return start(loop, now);
+    }
+
+    // One-shots always cut into the ambient loop and lower one-shots
+    if (current.fileNumber == 0 || cue.priority > current.priority) {
+        return start(cue, now);
+    }
+
+    switch (policy) {
+        case AudioPolicy::PREEMPT:
+            if (cue.priority == current.priority) {
+                return start(cue, now);
+            }
+            break;
+        case AudioPolicy::QUEUE:
+            return enqueue(cue);
+        case AudioPolicy::DROP:
+            break;
+    }
+
+    stats.dropped++;
+    return Decision::DROPPED;
+}
+
+void AudioArbiter::force(const AudioCue& cue) {
+    current = cue;
+}
+
+bool AudioArbiter::ended(uint16_t fileNumber, AudioCue& next) {
+    // A late report for a cue that was already replaced
+    if (fileNumber != current.fileNumber) return false;
+
+    bool wasAmbient = current.priority == AudioPriority::AMBIENT;
+    current = NO_CUE;
+
+    if (queueCount > 0) {
+        next = queue[0];
+        for (uint8_t i = 1; i < queueCount; i++) {
+            queue[i - 1] = queue[i];
+        }
+        queueCount--;
+        current = next;
+        stats.played++;
+        return true;
+    }
+
+    if (ambient.fileNumber != 0 && !wasAmbient) {
+        next = ambient;
+        current = next;
+        stats.resumed++;
+        return true;
+    }
+
+    return false;
+}
+
+bool AudioArbiter::restart(AudioCue& next) {
+    queueCount = 0;
+    current = ambient;
+    if (ambient.fileNumber == 0) return false;
+
+    next = ambient;
+    stats.resumed++;
+    return true;
+}
+
+void AudioArbiter::clear() {
+    current = NO_CUE;
+    ambient = NO_CUE;
+    queueCount = 0;
+}
+
+// Private methods
+
+AudioArbiter::Decision AudioArbiter::start(const AudioCue& cue, uint32_t now) {
+    current = cue;
+    lastFile = cue.fileNumber;
+    lastStartTime = now;
+    stats.played++;
+    return Decision::PLAY;
+}
+
+AudioArbiter::Decision AudioArbiter::enqueue(const AudioCue& cue) {
+    if (queueCount >= QUEUE_SIZE) {
+        stats.dropped++;
+        return Decision::DROPPED;
+    }
+
+    queue[queueCount++] = cue;
+    stats.queued++;
+    return Decision::QUEUED;
+}
+
+} // namespace BattleAura
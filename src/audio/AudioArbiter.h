@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Arduino.h>
+#include "../config/Configuration.h"
+
+namespace BattleAura {
+
+struct AudioCue {
+    uint16_t fileNumber;        // 0 = none
+    AudioPriority priority;
+    bool loop;
+};
+
+struct ArbiterStats {
+    uint32_t played;            // Cues started
+    uint32_t queued;            // Cues held until the current one ended
+    uint32_t dropped;           // Cues lost to policy or a full queue
+    uint32_t throttled;         // Repeats inside the retrigger window
+    uint32_t resumed;           // Ambient loops restarted after a one-shot
+};
+
+// Decides which cue owns the single DFPlayer output. One-shots (active,
+// global) interrupt the ambient loop, which is restarted when they are done;
+// one-shots that collide are preempted, queued or dropped per the device
+// config. Pure bookkeeping - AudioController sends the resulting commands.
+class AudioArbiter {
+public:
+    enum class Decision : uint8_t {
+        PLAY,       // Start this cue now
+        QUEUED,     // Will come back from ended() later
+        DROPPED,
+        THROTTLED
+    };
+
+    AudioArbiter(Configuration& config);
+
+    // A cue was requested
+    Decision submit(const AudioCue& cue, uint32_t now);
+
+    // Something played outside the arbiter (manual play from the web UI)
+    void force(const AudioCue& cue);
+
+    // fileNumber stopped playing. True if 'next' should start now: a queued
+    // one-shot or the ambient loop.
+    bool ended(uint16_t fileNumber, AudioCue& next);
+
+    // The player came back after a reset. True with the ambient loop to
+    // restart; pending one-shots are stale by now and dropped.
+    bool restart(AudioCue& next);
+
+    // Stop everything, including the ambient loop
+    void clear();
+
+    const AudioCue& getCurrent() const { return current; }
+    const AudioCue& getAmbient() const { return ambient; }
+    const ArbiterStats& getStats() const { return stats; }
+
+private:
+    static const uint8_t QUEUE_SIZE = 4;
+
+    Configuration& config;
+    AudioCue current;           // Cue the player is on
+    AudioCue ambient;           // Loop to return to
+    AudioCue queue[QUEUE_SIZE]; // FIFO of waiting one-shots
+    uint8_t queueCount;
+    uint16_t lastFile;          // For the retrigger window
+    uint32_t lastStartTime;
+    ArbiterStats stats;
+
+    Decision start(const AudioCue& cue, uint32_t now);
+    Decision enqueue(const AudioCue& cue);
+};
+
+} // namespace BattleAura
@@ -3,9 +3,10 @@
 namespace BattleAura {
 
 AudioController::AudioController(Configuration& config) 
-    : config(config), audioSerial(nullptr), currentStatus(AudioStatus::STOPPED),
-      currentTrack(0), currentVolume(15), playStartTime(0), audioAvailable(false),
-      lastStatusCheck(0), lastRetryAttempt(0), enableRetries(true) {
+    : config(config), audioSerial(nullptr), arbiter(config), currentStatus(AudioStatus::STOPPED),
+      currentTrack(0), currentLoop(false), currentVolume(15), playStartTime(0), audioAvailable(false),
+      lastRetryAttempt(0), enableRetries(true), initializing(false),
+      testStopTime(0), latencyFile(0), latencyRequestTime(0) {
 }
 
 bool AudioController::begin() {
@@ -35,15 +36,21 @@ bool AudioController::play(uint16_t fileNumber, bool loop) {
         return false;
     }
     
+    bool queued = loop ? dfPlayer.loop(fileNumber) : dfPlayer.play(fileNumber);
+    if (!queued) {
+        Serial.println("AudioController: DFPlayer command queue full");
+        return false;
+    }
+    
     Serial.printf("AudioController: Playing file %d %s\n", fileNumber, loop ? "(loop)" : "");
     
-    if (loop) {
-        dfPlayer.loop(fileNumber);
-    } else {
-        dfPlayer.play(fileNumber);
+    // The track this replaces won't report finished
+    if (currentStatus != AudioStatus::STOPPED && currentTrack != 0 && currentTrack != fileNumber) {
+        publish(AudioEvent::Type::STOPPED, currentTrack);
     }
     
     currentTrack = fileNumber;
+    currentLoop = loop;
     currentStatus = AudioStatus::PLAYING;
     playStartTime = millis();
     
@@ -61,9 +68,11 @@ bool AudioController::playTrack(const String& trackName) {
 }
 
 bool AudioController::stop() {
-    if (!audioAvailable) return false;
+    if (!audioAvailable || !dfPlayer.stop()) return false;
     
-    dfPlayer.stop();
+    if (currentTrack != 0) {
+        publish(AudioEvent::Type::STOPPED, currentTrack);
+    }
     currentStatus = AudioStatus::STOPPED;
     currentTrack = 0;
     playStartTime = 0;
@@ -73,9 +82,8 @@ bool AudioController::stop() {
 }
 
 bool AudioController::pause() {
-    if (!audioAvailable) return false;
+    if (!audioAvailable || !dfPlayer.pause()) return false;
     
-    dfPlayer.pause();
     currentStatus = AudioStatus::PAUSED;
     
     Serial.println("AudioController: Paused");
@@ -83,9 +91,8 @@ bool AudioController::pause() {
 }
 
 bool AudioController::resume() {
-    if (!audioAvailable) return false;
+    if (!audioAvailable || !dfPlayer.resume()) return false;
     
-    dfPlayer.start();
     currentStatus = AudioStatus::PLAYING;
     
     Serial.println("AudioController: Resumed");
@@ -93,20 +100,18 @@ bool AudioController::resume() {
 }
 
 bool AudioController::next() {
-    if (!audioAvailable) return false;
+    if (!audioAvailable || !dfPlayer.next()) return false;
     
-    dfPlayer.next();
-    updateCurrentStatus();
+    dfPlayer.queryStatus();
     
     Serial.println("AudioController: Next track");
     return true;
 }
 
 bool AudioController::previous() {
-    if (!audioAvailable) return false;
+    if (!audioAvailable || !dfPlayer.previous()) return false;
     
-    dfPlayer.previous();
-    updateCurrentStatus();
+    dfPlayer.queryStatus();
     
     Serial.println("AudioController: Previous track");
     return true;
@@ -117,7 +122,7 @@ bool AudioController::setVolume(uint8_t volume) {
     
     if (volume > 30) volume = 30;
     
-    dfPlayer.volume(volume);
+    if (!dfPlayer.setVolume(volume)) return false;
     currentVolume = volume;
     
     Serial.printf("AudioController: Volume set to %d\n", volume);
@@ -185,12 +190,11 @@ bool AudioController::testTrack(uint16_t fileNumber) {
     
     // Stop any current playback
     stop();
-    delay(100);
     
-    // Play track for 3 seconds
+    // Play track for 3 seconds; update() stops it
     if (play(fileNumber, false)) {
-        delay(3000);
-        stop();
+        testStopTime = millis() + TEST_PLAY_MS;
+        if (testStopTime == 0) testStopTime = 1;
         return true;
     }
     
@@ -211,6 +215,19 @@ void AudioController::printStatus() const {
     
     Serial.printf("Current Track: %d\n", currentTrack);
     Serial.printf("Volume: %d/30\n", currentVolume);
+    Serial.printf("Dropped commands: %lu\n", (unsigned long)droppedCommands.load());
+    Serial.printf("Start latency: %dms\n", startLatencyMs.load());
+    
+    const ArbiterStats& arbiterStats = arbiter.getStats();
+    Serial.printf("Cues: %lu played, %lu queued, %lu dropped, %lu throttled, %lu resumed (ambient: %d)\n",
+                 (unsigned long)arbiterStats.played, (unsigned long)arbiterStats.queued,
+                 (unsigned long)arbiterStats.dropped, (unsigned long)arbiterStats.throttled,
+                 (unsigned long)arbiterStats.resumed, arbiter.getAmbient().fileNumber);
+    
+    const DFPlayerStats& driverStats = dfPlayer.getStats();
+    Serial.printf("DFPlayer: %lu sent, %lu timeouts, %lu errors, %lu bad frames\n",
+                 (unsigned long)driverStats.commandsSent, (unsigned long)driverStats.timeouts,
+                 (unsigned long)driverStats.errors, (unsigned long)driverStats.badFrames);
     
     auto tracks = config.getAllAudioTracks();
     Serial.printf("Available Tracks: %d\n", tracks.size());
@@ -228,93 +245,263 @@ uint16_t AudioController::getAvailableTrackCount() const {
     return config.getAllAudioTracks().size();
 }
 
+bool AudioController::requestPlay(AudioSource source, uint16_t fileNumber, bool loop) {
+    return post(source, {AudioCommand::Type::PLAY, fileNumber, 0, loop, AudioPriority::AMBIENT});
+}
+
+bool AudioController::requestStop(AudioSource source) {
+    return post(source, {AudioCommand::Type::STOP, 0, 0, false, AudioPriority::AMBIENT});
+}
+
+bool AudioController::requestVolume(AudioSource source, uint8_t volume) {
+    return post(source, {AudioCommand::Type::SET_VOLUME, 0, volume, false, AudioPriority::AMBIENT});
+}
+
+bool AudioController::requestRetry(AudioSource source) {
+    return post(source, {AudioCommand::Type::RETRY, 0, 0, false, AudioPriority::AMBIENT});
+}
+
+bool AudioController::requestCue(AudioSource source, uint16_t fileNumber, AudioPriority priority, bool loop) {
+    return post(source, {AudioCommand::Type::CUE, fileNumber, 0, loop, priority});
+}
+
+bool AudioController::requestStopCue(AudioSource source, uint16_t fileNumber) {
+    return post(source, {AudioCommand::Type::STOP_CUE, fileNumber, 0, false, AudioPriority::AMBIENT});
+}
+
 void AudioController::update() {
+    // Commands queued by the render and web tasks
+    AudioCommand command;
+    for (auto& queue : commandQueues) {
+        while (queue.pop(command)) {
+            runCommand(command);
+        }
+    }
+    
     uint32_t currentTime = millis();
     
+    // Send, receive and time out DFPlayer frames
+    dfPlayer.update(currentTime);
+    
+    DFPlayerEvent event;
+    while (dfPlayer.pollEvent(event)) {
+        handleEvent(event, currentTime);
+    }
+    
+    // End of a testTrack() run
+    if (testStopTime != 0 && (int32_t)(currentTime - testStopTime) >= 0) {
+        testStopTime = 0;
+        stop();
+    }
+    
     // If audio is not available but retries are enabled, attempt periodic reconnection
-    if (!audioAvailable && enableRetries) {
-        // Retry every 30 seconds
-        if (currentTime - lastRetryAttempt >= 30000) {
+    if (!audioAvailable && !initializing && enableRetries) {
+        if (currentTime - lastRetryAttempt >= RETRY_INTERVAL) {
             Serial.println("AudioController: Attempting periodic retry...");
             retryInitialization();
-            lastRetryAttempt = currentTime;
         }
-        return;
-    }
-    
-    // If audio is available, periodically check DFPlayer status
-    if (audioAvailable && currentTime - lastStatusCheck >= STATUS_CHECK_INTERVAL) {
-        checkPlayerStatus();
-        lastStatusCheck = currentTime;
     }
 }
 
-// Private methods
-
-bool AudioController::initializeHardware() {
-    // Hardware initialization is done in begin()
-    return audioAvailable;
+bool AudioController::pollEvent(AudioEvent& event) {
+    return eventQueue.pop(event);
 }
 
-void AudioController::checkPlayerStatus() {
-    if (!audioAvailable) return;
-    
-    // Query DFPlayer status
-    int playerState = dfPlayer.readState();
-    
-    switch (playerState) {
-        case 513: // Playing
-            if (currentStatus != AudioStatus::PLAYING) {
-                currentStatus = AudioStatus::PLAYING;
+// Private methods
+
+void AudioController::handleEvent(const DFPlayerEvent& event, uint32_t now) {
+    switch (event.type) {
+        case DFPlayerEvent::Type::READY:
+            if (initializing || !audioAvailable) {
+                initializing = false;
+                audioAvailable = true;
+                
+                // Set initial volume from config
+                size_t trackCount;
+                {
+                    auto lock = config.lock();
+                    currentVolume = config.getDeviceConfig().audioVolume;
+                    trackCount = config.getAllAudioTracks().size();
+                }
+                if (currentVolume > 30) currentVolume = 30;
+                dfPlayer.setVolume(currentVolume);
+                
+                Serial.printf("AudioController: Hardware initialized successfully (Volume: %d, Tracks: %d)\n", 
+                             currentVolume, trackCount);
+                
+                // Ambient loop requested while the player was still starting
+                AudioCue next;
+                if (arbiter.restart(next)) {
+                    playNext(next);
+                }
+            }
+            break;
+            
+        case DFPlayerEvent::Type::TIMEOUT:
+            if (initializing) {
+                Serial.println("AudioController: DFPlayer did not respond to reset - will retry periodically");
+                initializing = false;
+                audioAvailable = false;
+                lastRetryAttempt = now;
+            } else {
+                Serial.printf("AudioController: DFPlayer command 0x%02X timed out\n", event.value);
+            }
+            break;
+            
+        case DFPlayerEvent::Type::STATUS:
+            // Commands queued after the query will change it; don't go back
+            if (dfPlayer.isBusy()) break;
+            
+            switch (event.value) {
+                case DFPlayerDriver::STATE_PLAYING:
+                    currentStatus = AudioStatus::PLAYING;
+                    break;
+                case DFPlayerDriver::STATE_STOPPED:
+                    if (currentStatus == AudioStatus::PLAYING) {
+                        currentStatus = AudioStatus::STOPPED;
+                        currentTrack = 0;
+                    }
+                    break;
+                case DFPlayerDriver::STATE_PAUSED:
+                    currentStatus = AudioStatus::PAUSED;
+                    break;
             }
             break;
             
-        case 512: // Stopped
-            if (currentStatus == AudioStatus::PLAYING) {
+        case DFPlayerEvent::Type::PLAY_STARTED:
+            recordStartLatency(event.value, now);
+            publish(AudioEvent::Type::STARTED, event.value);
+            break;
+            
+        case DFPlayerEvent::Type::PLAY_FINISHED:
+            // Playback state follows the player's own finished frames rather
+            // than status polls
+            Serial.printf("AudioController: Track %d finished\n", event.value);
+            if (currentStatus == AudioStatus::PLAYING && !currentLoop && event.value == currentTrack) {
                 currentStatus = AudioStatus::STOPPED;
                 currentTrack = 0;
+                playStartTime = 0;
+                publish(AudioEvent::Type::FINISHED, event.value);
+                
+                // Next queued one-shot, or back to the ambient loop
+                AudioCue next;
+                if (arbiter.ended(event.value, next)) {
+                    playNext(next);
+                }
             }
             break;
             
-        case 514: // Paused
-            currentStatus = AudioStatus::PAUSED;
+        case DFPlayerEvent::Type::CARD_INSERTED:
+            Serial.println("AudioController: SD card inserted");
             break;
             
-        default:
-            // Handle error or unknown states
-            if (playerState == -1) {
-                currentStatus = AudioStatus::ERROR;
+        case DFPlayerEvent::Type::CARD_REMOVED:
+            Serial.println("AudioController: SD card removed");
+            if (currentTrack != 0) {
+                publish(AudioEvent::Type::STOPPED, currentTrack);
             }
+            currentStatus = AudioStatus::STOPPED;
+            currentTrack = 0;
+            break;
+            
+        case DFPlayerEvent::Type::ERROR:
+            Serial.printf("AudioController: DFPlayer error %d\n", event.value);
             break;
     }
 }
 
-bool AudioController::waitForReady(uint32_t timeout) {
-    uint32_t startTime = millis();
+bool AudioController::post(AudioSource source, const AudioCommand& command) {
+    AudioCommand stamped = command;
+    stamped.requestTime = millis();
+    if (commandQueues[static_cast<uint8_t>(source)].push(stamped)) {
+        return true;
+    }
     
-    while (millis() - startTime < timeout) {
-        if (dfPlayer.available()) {
-            // Check for ready message or successful response
-            uint8_t type = dfPlayer.readType();
-            if (type == DFPlayerCardInserted || type == DFPlayerCardOnline) {
-                return true;
+    droppedCommands++;
+    return false;
+}
+
+void AudioController::publish(AudioEvent::Type type, uint16_t fileNumber) {
+    // If the render task isn't draining yet, later events are simply dropped
+    eventQueue.push({type, fileNumber});
+}
+
+void AudioController::startCue(const AudioCue& cue, uint32_t requestTime) {
+    switch (arbiter.submit(cue, millis())) {
+        case AudioArbiter::Decision::PLAY:
+            if (play(cue.fileNumber, cue.loop || cue.priority == AudioPriority::AMBIENT)) {
+                latencyFile = cue.fileNumber;
+                latencyRequestTime = requestTime;
             }
-        }
-        delay(100);
+            break;
+        case AudioArbiter::Decision::QUEUED:
+            Serial.printf("AudioController: Cue %d queued behind track %d\n", cue.fileNumber, currentTrack);
+            break;
+        case AudioArbiter::Decision::DROPPED:
+            Serial.printf("AudioController: Cue %d dropped\n", cue.fileNumber);
+            break;
+        case AudioArbiter::Decision::THROTTLED:
+            break;
     }
+}
+
+void AudioController::recordStartLatency(uint16_t fileNumber, uint32_t now) {
+    // Only cues that were played straight away say anything about the path
+    // from request to sound; queued ones also waited for the track before
+    if (fileNumber != latencyFile) return;
+    latencyFile = 0;
     
-    return false;
+    uint32_t sample = now - latencyRequestTime;
+    if (sample > MAX_LATENCY_SAMPLE) return;
+    
+    uint16_t average = startLatencyMs.load();
+    average = average == 0 ? sample : (average * 3 + sample) / 4;
+    startLatencyMs.store(average);
 }
 
+void AudioController::playNext(const AudioCue& cue) {
+    if (cue.priority == AudioPriority::AMBIENT) {
+        Serial.printf("AudioController: Resuming ambient track %d\n", cue.fileNumber);
+    }
+    play(cue.fileNumber, cue.loop);
+}
 
-void AudioController::updateCurrentStatus() {
-    checkPlayerStatus();
+void AudioController::runCommand(const AudioCommand& command) {
+    switch (command.type) {
+        case AudioCommand::Type::PLAY:
+            arbiter.force({command.fileNumber, AudioPriority::GLOBAL, command.loop});
+            play(command.fileNumber, command.loop);
+            break;
+        case AudioCommand::Type::STOP:
+            arbiter.clear();
+            stop();
+            break;
+        case AudioCommand::Type::CUE:
+            startCue({command.fileNumber, command.priority, command.loop}, command.requestTime);
+            break;
+        case AudioCommand::Type::STOP_CUE:
+            if (command.fileNumber == currentTrack) {
+                // Going straight to the next cue saves the stop command
+                AudioCue next;
+                if (arbiter.ended(command.fileNumber, next)) {
+                    playNext(next);
+                } else {
+                    stop();
+                }
+            }
+            break;
+        case AudioCommand::Type::SET_VOLUME:
+            setVolume(command.volume);
+            break;
+        case AudioCommand::Type::RETRY:
+            retryInitialization();
+            lastRetryAttempt = millis();
+            break;
+    }
 }
 
 
 bool AudioController::retryInitialization() {
-    const auto& deviceConfig = config.getDeviceConfig();
-    
     Serial.println("AudioController: Attempting hardware initialization...");
     
     // Initialize Hardware Serial for DFPlayer
@@ -323,36 +510,18 @@ bool AudioController::retryInitialization() {
         Serial.printf("AudioController: Initializing UART on RX=%d, TX=%d at %d baud\n", 
                      AUDIO_RX_PIN, AUDIO_TX_PIN, AUDIO_BAUD);
         audioSerial->begin(AUDIO_BAUD, SERIAL_8N1, AUDIO_RX_PIN, AUDIO_TX_PIN);
+        dfPlayer.begin(*audioSerial);
     }
     
-    // Give DFPlayer time to initialize
-    Serial.println("AudioController: Waiting 1000ms for DFPlayer startup...");
-    delay(1000);
-    
-    // Initialize DFPlayer
-    Serial.println("AudioController: Calling dfPlayer.begin()...");
-    if (!dfPlayer.begin(*audioSerial)) {
-        Serial.println("AudioController: dfPlayer.begin() failed - will retry periodically");
-        audioAvailable = false;
-        lastRetryAttempt = millis();
-        return false;
-    }
-    Serial.println("AudioController: dfPlayer.begin() succeeded");
-    
-    // Give DFPlayer additional time to stabilize
-    Serial.println("AudioController: Waiting additional 500ms for DFPlayer stabilization...");
-    delay(500);
-    
-    audioAvailable = true;
-    
-    // Set initial volume from config
-    currentVolume = deviceConfig.audioVolume;
-    if (currentVolume > 30) currentVolume = 30;
-    dfPlayer.volume(currentVolume);
-    
-    auto tracks = config.getAllAudioTracks();
-    Serial.printf("AudioController: Hardware initialized successfully (Volume: %d, Tracks: %d)\n", 
-                 currentVolume, tracks.size());
+    // The player answers with its storage-online frame once the card scan
+    // is done; update() picks that up, or the reset times out
+    Serial.println("AudioController: Resetting DFPlayer...");
+    audioAvailable = false;
+    initializing = true;
+    currentStatus = AudioStatus::STOPPED;
+    currentTrack = 0;
+    lastRetryAttempt = millis();
+    dfPlayer.reset();
     return true;
 }
 
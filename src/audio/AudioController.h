@@ -2,8 +2,10 @@
 
 #include <Arduino.h>
 #include <HardwareSerial.h>
-#include <DFRobotDFPlayerMini.h>
 #include "../config/Configuration.h"
+#include "DFPlayerDriver.h"
+#include "AudioArbiter.h"
+#include "../core/SpscQueue.h"
 
 namespace BattleAura {
 
@@ -14,6 +16,35 @@ enum class AudioStatus {
     ERROR
 };
 
+// Task that sends an audio command. Each source gets its own single-producer
+// queue into the audio task.
+enum class AudioSource : uint8_t {
+    RENDER = 0,     // Render task (VFX audio timeouts)
+    WEB = 1         // Web server handlers
+};
+
+struct AudioCommand {
+    enum class Type : uint8_t { PLAY, STOP, SET_VOLUME, RETRY, CUE, STOP_CUE };
+    
+    Type type;
+    uint16_t fileNumber;
+    uint8_t volume;
+    bool loop;
+    AudioPriority priority;     // CUE only
+    uint32_t requestTime = 0;   // millis() when posted
+};
+
+// Playback change published to the render task
+struct AudioEvent {
+    enum class Type : uint8_t {
+        STARTED,        // Player acknowledged the play; sound starts about now
+        FINISHED,       // Track played to its end
+        STOPPED         // Track was stopped or replaced before its end
+    };
+    
+    Type type;
+    uint16_t fileNumber;
+};
 
 class AudioController {
 public:
@@ -60,37 +91,82 @@ public:
     bool retryInitialization();
     void enablePeriodicRetries(bool enable = true);
     
-    // Update loop (check status, handle timeouts)
+    // Requests from other tasks. The DFPlayer driver belongs to the audio
+    // task, so other tasks queue commands instead and update() runs them
+    // there. false means the source's queue was full.
+    bool requestPlay(AudioSource source, uint16_t fileNumber, bool loop = false);
+    bool requestStop(AudioSource source);
+    bool requestVolume(AudioSource source, uint8_t volume);
+    bool requestRetry(AudioSource source);
+    
+    // Scene audio goes through the arbiter: ambient loops resume after
+    // one-shots, colliding one-shots follow the configured policy.
+    // requestPlay()/requestStop() above are manual overrides.
+    bool requestCue(AudioSource source, uint16_t fileNumber, AudioPriority priority, bool loop = false);
+    bool requestStopCue(AudioSource source, uint16_t fileNumber);  // Only if it is still playing
+    const ArbiterStats& getArbiterStats() const { return arbiter.getStats(); }
+    uint16_t getAmbientTrack() const { return arbiter.getAmbient().fileNumber; }
+    uint32_t getDroppedCommands() const { return droppedCommands.load(); }
+    
+    // Average time from requestCue() to the player acknowledging the play,
+    // so visuals can wait for the sound they go with. 0 until measured.
+    uint16_t getStartLatency() const { return startLatencyMs.load(); }
+    
+    // Playback events for the render task, oldest first (single consumer)
+    bool pollEvent(AudioEvent& event);
+    
+    // Update loop (run queued commands, drive the UART, handle player events)
     void update();
     
 private:
     Configuration& config;
     HardwareSerial* audioSerial;
-    DFRobotDFPlayerMini dfPlayer;
+    DFPlayerDriver dfPlayer;
+    AudioArbiter arbiter;
     
     // Audio state
     AudioStatus currentStatus;
     uint16_t currentTrack;
+    bool currentLoop;
     uint8_t currentVolume;
     uint32_t playStartTime;
     bool audioAvailable;
-    uint32_t lastStatusCheck;
     uint32_t lastRetryAttempt;
     bool enableRetries;
+    bool initializing;          // Reset sent, waiting for the player to come online
+    uint32_t testStopTime;      // When testTrack() playback ends (0 = no test running)
+    
+    // Start latency measurement
+    uint16_t latencyFile;       // Cue waiting for its PLAY_STARTED (0 = none)
+    uint32_t latencyRequestTime;
+    std::atomic<uint16_t> startLatencyMs{0};
+    
+    // Cross-task command queues, one per AudioSource
+    static const uint8_t SOURCE_COUNT = 2;
+    SpscQueue<AudioCommand, 16> commandQueues[SOURCE_COUNT];
+    std::atomic<uint32_t> droppedCommands{0};
+    
+    // Audio task -> render task
+    SpscQueue<AudioEvent, 8> eventQueue;
     
     // Hardware management
-    bool initializeHardware();
-    void checkPlayerStatus();
-    bool waitForReady(uint32_t timeout = 1000);
+    void handleEvent(const DFPlayerEvent& event, uint32_t now);
     
     // Utilities
-    void updateCurrentStatus();
+    bool post(AudioSource source, const AudioCommand& command);
+    void publish(AudioEvent::Type type, uint16_t fileNumber);
+    void startCue(const AudioCue& cue, uint32_t requestTime);
+    void recordStartLatency(uint16_t fileNumber, uint32_t now);
+    void playNext(const AudioCue& cue);
+    void runCommand(const AudioCommand& command);
     
     // Constants
     static const uint8_t AUDIO_RX_PIN = 44;  // ESP32-S3 D7/GPIO44 RX <- DFPlayer TX
     static const uint8_t AUDIO_TX_PIN = 43;  // ESP32-S3 D6/GPIO43 TX -> DFPlayer RX
     static const uint32_t AUDIO_BAUD = 9600;
-    static const uint32_t STATUS_CHECK_INTERVAL = 500; // Check every 500ms
+    static const uint32_t RETRY_INTERVAL = 30000;       // Reset an absent player every 30s
+    static const uint32_t TEST_PLAY_MS = 3000;
+    static const uint32_t MAX_LATENCY_SAMPLE = 1000;    // Longer means the player was busy resetting
 };
 
 } // namespace BattleAura
\ No newline at end of file
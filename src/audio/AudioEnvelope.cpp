@@ -0,0 +1,108 @@
+#include "AudioEnvelope.h"
+#include <LittleFS.h>
+
+namespace BattleAura {
+
+const char* const EnvelopeStore::DIRECTORY = "/envelopes";
+
+uint32_t AudioEnvelope::getDurationMs() const {
+    return rateHz > 0 ? (uint32_t)samples.size() * 1000 / rateHz : 0;
+}
+
+uint8_t AudioEnvelope::levelAt(uint32_t ms, bool loop) const {
+    size_t count = samples.size();
+    if (count == 0 || rateHz == 0) return 0;
+
+    // Position in 1/256ths of a sample
+    uint32_t position = (uint32_t)(((uint64_t)ms * rateHz * 256) / 1000);
+    uint32_t index = position >> 8;
+    if (index >= count) {
+        if (!loop) return 0;
+        index %= count;
+    }
+
+    uint32_t next = index + 1 < count ? index + 1 : (loop ? 0 : index);
+    uint8_t fraction = position & 0xFF;
+    int16_t a = samples[index];
+    int16_t b = samples[next];
+    return (uint8_t)(a + ((b - a) * fraction) / 256);
+}
+
+EnvelopeStore::EnvelopeStore(Configuration& config) : config(config) {
+}
+
+void EnvelopeStore::begin() {
+    envelopes.clear();
+    for (const AudioTrack* track : config.getAllAudioTracks()) {
+        load(track->fileNumber);
+    }
+
+    // Scenes can name a file that has no track entry
+    for (const SceneConfig* scene : config.getAllSceneConfigs()) {
+        if (scene->hasAudio() && !get(scene->audioFile)) {
+            load(scene->audioFile);
+        }
+    }
+
+    Serial.printf("EnvelopeStore: %d envelopes loaded\n", envelopes.size());
+}
+
+bool EnvelopeStore::load(uint16_t fileNumber) {
+    String path = pathFor(fileNumber);
+    if (!LittleFS.exists(path)) {
+        envelopes.erase(fileNumber);
+        return false;
+    }
+
+    File file = LittleFS.open(path, "r");
+    if (!file) return false;
+
+    size_t size = file.size();
+    if (size < HEADER_SIZE || size > HEADER_SIZE + MAX_SAMPLES) {
+        Serial.printf("EnvelopeStore: %s has a bad size (%d bytes)\n", path.c_str(), size);
+        file.close();
+        return false;
+    }
+
+    std::vector<uint8_t> data(size);
+    size_t bytesRead = file.read(data.data(), size);
+    file.close();
+
+    AudioEnvelope envelope;
+    if (bytesRead != size || !parse(data.data(), size, envelope)) {
+        Serial.printf("EnvelopeStore: %s is not a valid envelope\n", path.c_str());
+        return false;
+    }
+
+    envelopes[fileNumber] = std::move(envelope);
+    return true;
+}
+
+void EnvelopeStore::set(uint16_t fileNumber, AudioEnvelope&& envelope) {
+    envelopes[fileNumber] = std::move(envelope);
+}
+
+const AudioEnvelope* EnvelopeStore::get(uint16_t fileNumber) const {
+    auto it = envelopes.find(fileNumber);
+    return it != envelopes.end() ? &it->second : nullptr;
+}
+
+String EnvelopeStore::pathFor(uint16_t fileNumber) {
+    char path[24];
+    snprintf(path, sizeof(path), "%s/%04u.env", DIRECTORY, fileNumber);
+    return String(path);
+}
+
+bool EnvelopeStore::parse(const uint8_t* data, size_t length, AudioEnvelope& envelope) {
+    if (length < HEADER_SIZE || memcmp(data, "BAE1", 4) != 0) return false;
+
+    uint8_t rateHz = data[4];
+    uint16_t count = data[6] | ((uint16_t)data[7] << 8);
+    if (rateHz == 0 || count > MAX_SAMPLES || length != HEADER_SIZE + count) return false;
+
+    envelope.rateHz = rateHz;
+    envelope.samples.assign(data + HEADER_SIZE, data + length);
+    return true;
+}
+
+} // namespace BattleAura
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+#include <map>
+#include <vector>
+#include "../config/Configuration.h"
+
+namespace BattleAura {
+
+// Loudness of one track over time, built offline from its mp3 by
+// tools/audio_envelope.py
+struct AudioEnvelope {
+    uint8_t rateHz;
+    std::vector<uint8_t> samples;   // 0 = silent, 255 = loudest part of the track
+
+    uint32_t getDurationMs() const;
+
+    // Level ms into playback, interpolated between samples. Loops wrap;
+    // one-shots read 0 past the end.
+    uint8_t levelAt(uint32_t ms, bool loop) const;
+};
+
+// Envelopes for the configured tracks, read from /envelopes/NNNN.env next
+// to /config.json. They are a few hundred bytes each and kept in RAM so the
+// render loop never touches the filesystem.
+class EnvelopeStore {
+public:
+    EnvelopeStore(Configuration& config);
+
+    // Load the envelopes that exist for configured tracks and scene audio
+    void begin();
+
+    // (Re)load one track's envelope from the filesystem
+    bool load(uint16_t fileNumber);
+
+    // Replace one track's envelope with one already parsed, e.g. from an
+    // upload, without touching the filesystem
+    void set(uint16_t fileNumber, AudioEnvelope&& envelope);
+
+    const AudioEnvelope* get(uint16_t fileNumber) const;
+    size_t count() const { return envelopes.size(); }
+
+    // File layout, shared with the upload handler:
+    //   0 "BAE1", 4 uint8 rate (Hz), 5 reserved, 6 uint16 LE count, 8 samples
+    static String pathFor(uint16_t fileNumber);
+    static bool parse(const uint8_t* data, size_t length, AudioEnvelope& envelope);
+
+    static const char* const DIRECTORY;
+    static const size_t HEADER_SIZE = 8;
+    static const uint16_t MAX_SAMPLES = 3000;      // 60s at 50Hz
+
+private:
+    Configuration& config;
+    std::map<uint16_t, AudioEnvelope> envelopes;
+};
+
+} // namespace BattleAura
@@ -0,0 +1,216 @@
+#include "DFPlayerDriver.h"
+
+namespace BattleAura {
+
+DFPlayerDriver::DFPlayerDriver()
+    : stream(nullptr), state(State::IDLE), online(false), pendingCode(0), pendingParameter(0),
+      sentTime(0), timeoutMs(0), readyTime(0), resetPending(false), rxLength(0),
+      lastFinishedTrack(0), lastFinishedTime(0), stats{} {
+}
+
+void DFPlayerDriver::begin(Stream& stream) {
+    this->stream = &stream;
+    rxLength = 0;
+}
+
+void DFPlayerDriver::reset() {
+    // Anything queued was meant for the player as it was before the reset
+    Command dropped;
+    while (commandQueue.pop(dropped)) {}
+
+    online = false;
+    resetPending = true;
+}
+
+bool DFPlayerDriver::play(uint16_t fileNumber) {
+    return enqueue(CMD_PLAY, fileNumber);
+}
+
+bool DFPlayerDriver::loop(uint16_t fileNumber) {
+    return enqueue(CMD_LOOP, fileNumber);
+}
+
+bool DFPlayerDriver::stop() {
+    return enqueue(CMD_STOP);
+}
+
+bool DFPlayerDriver::pause() {
+    return enqueue(CMD_PAUSE);
+}
+
+bool DFPlayerDriver::resume() {
+    return enqueue(CMD_RESUME);
+}
+
+bool DFPlayerDriver::next() {
+    return enqueue(CMD_NEXT);
+}
+
+bool DFPlayerDriver::previous() {
+    return enqueue(CMD_PREVIOUS);
+}
+
+bool DFPlayerDriver::setVolume(uint8_t volume) {
+    if (volume > 30) volume = 30;
+    return enqueue(CMD_VOLUME, volume);
+}
+
+bool DFPlayerDriver::queryStatus() {
+    return enqueue(CMD_QUERY_STATUS);
+}
+
+void DFPlayerDriver::update(uint32_t now) {
+    if (!stream) return;
+
+    receive(now);
+
+    // A command that never got an answer
+    if (state != State::IDLE && now - sentTime >= timeoutMs) {
+        stats.timeouts++;
+        pushEvent(DFPlayerEvent::Type::TIMEOUT, pendingCode);
+        if (state == State::RESETTING) {
+            online = false;
+        }
+        state = State::IDLE;
+        readyTime = now;
+    }
+
+    if (resetPending) {
+        resetPending = false;
+        send(CMD_RESET, 0, false, now);
+        state = State::RESETTING;
+        timeoutMs = RESET_TIMEOUT_MS;
+        return;
+    }
+
+    // One command in flight at a time, spaced so the player keeps up
+    if (state != State::IDLE || (int32_t)(now - readyTime) < 0) return;
+
+    Command command;
+    if (commandQueue.pop(command)) {
+        // Queries are answered with their own reply frame, not an ACK
+        send(command.code, command.parameter, command.code != CMD_QUERY_STATUS, now);
+        state = State::WAITING;
+        timeoutMs = COMMAND_TIMEOUT_MS;
+    }
+}
+
+bool DFPlayerDriver::pollEvent(DFPlayerEvent& event) {
+    return eventQueue.pop(event);
+}
+
+// Private methods
+
+bool DFPlayerDriver::enqueue(uint8_t code, uint16_t parameter) {
+    if (!online) return false;
+    return commandQueue.push({code, parameter});
+}
+
+void DFPlayerDriver::send(uint8_t code, uint16_t parameter, bool ack, uint32_t now) {
+    // 7E FF 06 <cmd> <ack> <param hi> <param lo> <checksum hi> <checksum lo> EF
+    uint8_t frame[FRAME_SIZE] = {0x7E, 0xFF, 0x06, code, (uint8_t)(ack ? 1 : 0),
+                                 (uint8_t)(parameter >> 8), (uint8_t)parameter, 0, 0, 0xEF};
+    uint16_t sum = 0;
+    for (uint8_t i = 1; i < 7; i++) {
+        sum += frame[i];
+    }
+    uint16_t checksum = (uint16_t)(0 - sum);
+    frame[7] = checksum >> 8;
+    frame[8] = (uint8_t)checksum;
+
+    stream->write(frame, FRAME_SIZE);
+    stats.commandsSent++;
+    pendingCode = code;
+    pendingParameter = parameter;
+    sentTime = now;
+}
+
+void DFPlayerDriver::receive(uint32_t now) {
+    while (stream->available() > 0) {
+        int c = stream->read();
+        if (c < 0) break;
+
+        // Wait for a start byte, then collect a whole frame
+        if (rxLength == 0 && c != 0x7E) continue;
+        rxFrame[rxLength++] = (uint8_t)c;
+        if (rxLength < FRAME_SIZE) continue;
+        rxLength = 0;
+
+        uint16_t sum = 0;
+        for (uint8_t i = 1; i < 7; i++) {
+            sum += rxFrame[i];
+        }
+        uint16_t checksum = ((uint16_t)rxFrame[7] << 8) | rxFrame[8];
+        if (rxFrame[9] != 0xEF || (uint16_t)(sum + checksum) != 0) {
+            stats.badFrames++;
+            continue;
+        }
+
+        handleFrame(rxFrame[3], ((uint16_t)rxFrame[5] << 8) | rxFrame[6], now);
+    }
+}
+
+void DFPlayerDriver::handleFrame(uint8_t code, uint16_t parameter, uint32_t now) {
+    switch (code) {
+        case MSG_ACK:
+            if (state != State::WAITING) break;
+            // The player starts decoding as it acknowledges, so this is as
+            // close to the first audible sample as the protocol gets
+            if (pendingCode == CMD_PLAY || pendingCode == CMD_LOOP) {
+                pushEvent(DFPlayerEvent::Type::PLAY_STARTED, pendingParameter);
+            }
+            complete(now);
+            break;
+
+        case MSG_ERROR:
+            stats.errors++;
+            pushEvent(DFPlayerEvent::Type::ERROR, parameter);
+            // During a reset this only means the card scan isn't done; keep waiting
+            if (state == State::WAITING) complete(now);
+            break;
+
+        case MSG_STORAGE_ONLINE:
+            // Sent after a reset and at power-up, even without being asked
+            online = true;
+            pushEvent(DFPlayerEvent::Type::READY, parameter);
+            if (state == State::RESETTING) complete(now);
+            break;
+
+        case MSG_CARD_INSERTED:
+            pushEvent(DFPlayerEvent::Type::CARD_INSERTED, parameter);
+            break;
+
+        case MSG_CARD_REMOVED:
+            pushEvent(DFPlayerEvent::Type::CARD_REMOVED, parameter);
+            break;
+
+        case MSG_FINISHED_USB:
+        case MSG_FINISHED_SD:
+        case MSG_FINISHED_FLASH:
+            if (parameter == lastFinishedTrack && now - lastFinishedTime < FINISHED_REPEAT_MS) break;
+            lastFinishedTrack = parameter;
+            lastFinishedTime = now;
+            pushEvent(DFPlayerEvent::Type::PLAY_FINISHED, parameter);
+            break;
+
+        case CMD_QUERY_STATUS:
+            // High byte is the storage device, low byte the playback state
+            pushEvent(DFPlayerEvent::Type::STATUS, parameter & 0xFF);
+            if (state == State::WAITING && pendingCode == CMD_QUERY_STATUS) complete(now);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void DFPlayerDriver::complete(uint32_t now) {
+    state = State::IDLE;
+    readyTime = now + COMMAND_GAP_MS;
+}
+
+void DFPlayerDriver::pushEvent(DFPlayerEvent::Type type, uint16_t value) {
+    eventQueue.push({type, value});
+}
+
+} // namespace BattleAura
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <Arduino.h>
+#include "../core/SpscQueue.h"
+
+namespace BattleAura {
+
+// Something the DFPlayer reported, or a command it never answered
+struct DFPlayerEvent {
+    enum class Type : uint8_t {
+        READY,          // Reset finished; value = online storage bitmask
+        CARD_INSERTED,
+        CARD_REMOVED,
+        PLAY_STARTED,   // Player acknowledged play/loop; value = track number
+        PLAY_FINISHED,  // value = track number
+        STATUS,         // Reply to queryStatus(); value = DFPlayerDriver::STATE_*
+        ERROR,          // value = DFPlayer error code
+        TIMEOUT         // value = command that got no reply
+    };
+
+    Type type;
+    uint16_t value;
+};
+
+struct DFPlayerStats {
+    uint32_t commandsSent;
+    uint32_t timeouts;          // Commands that got no reply in time
+    uint32_t errors;            // Error frames from the player
+    uint32_t badFrames;         // Received frames with a bad checksum or end byte
+};
+
+// Non-blocking driver for the DFPlayer Mini serial protocol.
+// Commands are queued and sent one at a time from update(); each waits for
+// its ACK or reply up to a timeout, with a short gap before the next one so
+// the player doesn't drop it. Frames the player sends on its own (track
+// finished, card inserted/removed) are parsed whenever they arrive and
+// surface through pollEvent(). Nothing here waits or calls delay().
+class DFPlayerDriver {
+public:
+    // Playback state reported by queryStatus()
+    static const uint8_t STATE_STOPPED = 0;
+    static const uint8_t STATE_PLAYING = 1;
+    static const uint8_t STATE_PAUSED = 2;
+
+    DFPlayerDriver();
+
+    void begin(Stream& stream);
+
+    // Drop anything queued and reset the player. READY follows once its
+    // storage is online, or TIMEOUT if it never answers.
+    void reset();
+    bool isOnline() const { return online; }
+    bool isBusy() const { return state != State::IDLE || !commandQueue.isEmpty(); }
+
+    // Queue a command; false if the player is offline or the queue is full
+    bool play(uint16_t fileNumber);
+    bool loop(uint16_t fileNumber);
+    bool stop();
+    bool pause();
+    bool resume();
+    bool next();
+    bool previous();
+    bool setVolume(uint8_t volume);     // 0-30
+    bool queryStatus();
+
+    // Read replies, time out and send the next command - call often
+    void update(uint32_t now);
+
+    // Next event, oldest first; false when there is none
+    bool pollEvent(DFPlayerEvent& event);
+
+    const DFPlayerStats& getStats() const { return stats; }
+
+private:
+    enum class State : uint8_t {
+        IDLE,           // Nothing in flight
+        WAITING,        // Sent a command, waiting for its ACK or reply
+        RESETTING       // Sent a reset, waiting for the storage-online frame
+    };
+
+    struct Command {
+        uint8_t code;
+        uint16_t parameter;
+    };
+
+    static const uint8_t FRAME_SIZE = 10;
+
+    Stream* stream;
+    State state;
+    bool online;
+    uint8_t pendingCode;        // Command in flight
+    uint16_t pendingParameter;
+    uint32_t sentTime;
+    uint32_t timeoutMs;
+    uint32_t readyTime;         // Earliest time the next command may go out
+    bool resetPending;
+
+    // Receive side
+    uint8_t rxFrame[FRAME_SIZE];
+    uint8_t rxLength;
+    uint16_t lastFinishedTrack;
+    uint32_t lastFinishedTime;
+
+    SpscQueue<Command, 8> commandQueue;
+    SpscQueue<DFPlayerEvent, 16> eventQueue;
+    DFPlayerStats stats;
+
+    bool enqueue(uint8_t code, uint16_t parameter = 0);
+    void send(uint8_t code, uint16_t parameter, bool ack, uint32_t now);
+    void receive(uint32_t now);
+    void handleFrame(uint8_t code, uint16_t parameter, uint32_t now);
+    void complete(uint32_t now);
+    void pushEvent(DFPlayerEvent::Type type, uint16_t value);
+
+    // Protocol
+    static const uint8_t CMD_NEXT = 0x01;
+    static const uint8_t CMD_PREVIOUS = 0x02;
+    static const uint8_t CMD_PLAY = 0x03;
+    static const uint8_t CMD_VOLUME = 0x06;
+    static const uint8_t CMD_LOOP = 0x08;
+    static const uint8_t CMD_RESET = 0x0C;
+    static const uint8_t CMD_RESUME = 0x0D;
+    static const uint8_t CMD_PAUSE = 0x0E;
+    static const uint8_t CMD_STOP = 0x16;
+    static const uint8_t CMD_QUERY_STATUS = 0x42;
+
+    static const uint8_t MSG_FINISHED_USB = 0x3C;
+    static const uint8_t MSG_FINISHED_SD = 0x3D;
+    static const uint8_t MSG_FINISHED_FLASH = 0x3E;
+    static const uint8_t MSG_CARD_INSERTED = 0x3A;
+    static const uint8_t MSG_CARD_REMOVED = 0x3B;
+    static const uint8_t MSG_STORAGE_ONLINE = 0x3F;
+    static const uint8_t MSG_ERROR = 0x40;
+    static const uint8_t MSG_ACK = 0x41;
+
+    // Timing
+    static const uint32_t COMMAND_TIMEOUT_MS = 500;
+    static const uint32_t RESET_TIMEOUT_MS = 3000;     // Card scan takes 1-2s
+    static const uint32_t COMMAND_GAP_MS = 30;         // Player drops commands sent closer than this
+    static const uint32_t FINISHED_REPEAT_MS = 200;    // Finished frames arrive twice
+};
+
+} // namespace BattleAura
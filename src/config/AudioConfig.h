@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace BattleAura {
+
+// Audio priority classes. Values match VFXPriority.
+const uint8_t AUDIO_PRIORITY_COUNT = 3;
+
+enum class AudioPriority : uint8_t {
+    AMBIENT,    // Looping background; resumed after one-shots end
+    ACTIVE,     // Weapon and engine one-shots
+    GLOBAL      // Damage, destroyed, victory
+};
+
+// What a one-shot does when the player is busy with another one-shot of
+// the same or higher priority. A higher priority cue always cuts in.
+enum class AudioPolicy : uint8_t {
+    PREEMPT,    // Replace a cue of the same priority; dropped under a higher one
+    QUEUE,      // Play after the current cue ends
+    DROP        // Don't play
+};
+
+inline const char* audioPriorityName(AudioPriority priority) {
+    switch (priority) {
+        case AudioPriority::ACTIVE: return "active";
+        case AudioPriority::GLOBAL: return "global";
+        default:                    return "ambient";
+    }
+}
+
+inline const char* audioPolicyName(AudioPolicy policy) {
+    switch (policy) {
+        case AudioPolicy::QUEUE: return "queue";
+        case AudioPolicy::DROP:  return "drop";
+        default:                 return "preempt";
+    }
+}
+
+inline bool parseAudioPolicy(const String& name, AudioPolicy& policy) {
+    if (name == "preempt")    policy = AudioPolicy::PREEMPT;
+    else if (name == "queue") policy = AudioPolicy::QUEUE;
+    else if (name == "drop")  policy = AudioPolicy::DROP;
+    else return false;
+    return true;
+}
+
+} // namespace BattleAura
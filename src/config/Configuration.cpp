@@ -2,8 +2,9 @@
 
 namespace BattleAura {
 
-Configuration::Configuration() {
+Configuration::Configuration() : zoneGeneration(0) {
     // Initialize with default values
+    rebuildZoneIndex();
 }
 
 bool Configuration::begin() {
@@ -31,7 +32,7 @@ bool Configuration::save() {
     return saveToLittleFS();
 }
 
-bool Configuration::factoryReset() {
+void Configuration::factoryReset() {
     Serial.println("Configuration: Performing factory reset");
     
     // Clear all data structures
@@ -41,9 +42,6 @@ bool Configuration::factoryReset() {
     
     // Create default configuration
     createDefaultConfiguration();
-    
-    // Save to filesystem
-    return save();
 }
 
 // Zone management
@@ -69,39 +67,20 @@ bool Configuration::removeZone(uint8_t zoneId) {
 }
 
 Zone* Configuration::getZone(uint8_t zoneId) {
-    auto it = zones.find(zoneId);
-    return (it != zones.end()) ? &it->second : nullptr;
+    return zoneLookup[zoneId];
 }
 
 const Zone* Configuration::getZone(uint8_t zoneId) const {
-    auto it = zones.find(zoneId);
-    return (it != zones.end()) ? &it->second : nullptr;
+    return zoneLookup[zoneId];
 }
 
-std::vector<Zone*> Configuration::getZonesByGroup(const String& groupName) {
-    std::vector<Zone*> result;
-    for (auto& pair : zones) {
-        if (pair.second.groupName == groupName) {
-            result.push_back(&pair.second);
-        }
-    }
-    return result;
+const std::vector<Zone*>& Configuration::getZonesByGroup(const String& groupName) const {
+    auto it = groupZones.find(groupName);
+    return (it != groupZones.end()) ? it->second : noZones;
 }
 
-std::vector<Zone*> Configuration::getAllZones() {
-    std::vector<Zone*> result;
-    for (auto& pair : zones) {
-        result.push_back(&pair.second);
-    }
-    return result;
-}
-
-const std::vector<Zone*> Configuration::getAllZones() const {
-    std::vector<Zone*> result;
-    for (auto& pair : const_cast<std::map<uint8_t, Zone>&>(zones)) {
-        result.push_back(&pair.second);
-    }
-    return result;
+const std::vector<Zone*>& Configuration::getAllZones() const {
+    return allZones;
 }
 
 uint8_t Configuration::getNextZoneId() const {
@@ -169,6 +148,24 @@ void Configuration::updateGroupMembership() {
             groups[zone.groupName] = newGroup;
         }
     }
+    
+    rebuildZoneIndex();
+}
+
+void Configuration::rebuildZoneIndex() {
+    // std::map nodes are stable, so cached pointers stay valid until the zone is erased
+    memset(zoneLookup, 0, sizeof(zoneLookup));
+    allZones.clear();
+    groupZones.clear();
+    
+    for (auto& pair : zones) {
+        Zone* zone = &pair.second;
+        zoneLookup[zone->id] = zone;
+        allZones.push_back(zone);
+        groupZones[zone->groupName].push_back(zone);
+    }
+    
+    zoneGeneration++;
 }
 
 // Scene configuration management
@@ -412,6 +409,32 @@ bool Configuration::loadFromLittleFS() {
         deviceConfig.audioEnabled = deviceObj["audioEnabled"] | true;
         deviceConfig.audioVolume = deviceObj["audioVolume"] | 20;
         deviceConfig.globalBrightness = deviceObj["globalBrightness"] | 255;
+        deviceConfig.frameRate = deviceObj["frameRate"] | 50;
+        
+        JsonObject layersObj = deviceObj["layers"];
+        for (uint8_t i = 0; i < LAYER_COUNT; i++) {
+            LayerConfig& layer = deviceConfig.layers[i];
+            JsonObject layerObj = layersObj[layerName(i)];
+            if (!parseBlendMode(layerObj["blend"] | "replace", layer.blend)) {
+                layer.blend = BlendMode::REPLACE;
+            }
+            layer.opacity = layerObj["opacity"] | 255;
+        }
+        
+        deviceConfig.transitionMs = deviceObj["transitionMs"] | 200;
+        if (!parseEasing(deviceObj["transitionEasing"] | "ease-in-out", deviceConfig.transitionEasing)) {
+            deviceConfig.transitionEasing = Easing::EASE_IN_OUT;
+        }
+        
+        JsonObject policyObj = deviceObj["audioPolicy"];
+        const DeviceConfig defaults;
+        for (uint8_t i = 0; i < AUDIO_PRIORITY_COUNT; i++) {
+            const char* name = audioPriorityName((AudioPriority)i);
+            if (!parseAudioPolicy(policyObj[name] | audioPolicyName(defaults.audioPolicies[i]), deviceConfig.audioPolicies[i])) {
+                deviceConfig.audioPolicies[i] = defaults.audioPolicies[i];
+            }
+        }
+        deviceConfig.audioRetriggerMs = deviceObj["audioRetriggerMs"] | 150;
         deviceConfig.otaPassword = deviceObj["otaPassword"] | "battlesync";
         deviceConfig.apPassword = deviceObj["apPassword"] | "battlesync";
     }
@@ -466,6 +489,7 @@ bool Configuration::loadFromLittleFS() {
             sceneConfig.audioFile = configObj["audioFile"] | 0;
             sceneConfig.duration = configObj["duration"] | 0;
             sceneConfig.audioTimeout = configObj["audioTimeout"] | 0;
+            sceneConfig.audioReactive = configObj["audioReactive"] | false;
             sceneConfig.enabled = configObj["enabled"] | true;
             
             // Load type
@@ -490,6 +514,23 @@ bool Configuration::loadFromLittleFS() {
                 }
             }
             
+            // Load timeline
+            for (JsonVariant cueObj : configObj["timeline"].as<JsonArray>()) {
+                TimelineCue cue;
+                if (parseTimelineCue(cueObj, cue)) {
+                    sceneConfig.timeline.push_back(cue);
+                } else {
+                    Serial.printf("Configuration: Skipping invalid timeline cue in scene '%s'\n", sceneName.c_str());
+                }
+            }
+            sortTimeline(sceneConfig.timeline);
+            
+            // VFX parameters are kept as JSON; each effect's schema parses them
+            // into its Params struct when the scene is applied
+            if (configObj["parameters"].is<JsonObject>()) {
+                sceneConfig.parameters.set(configObj["parameters"]);
+            }
+            
             sceneConfigs[sceneName] = sceneConfig;
         }
     }
@@ -504,8 +545,10 @@ bool Configuration::loadFromLittleFS() {
 bool Configuration::saveToLittleFS() {
     Serial.println("Configuration: Saving to LittleFS...");
     
-    // Create JSON document
+    // Create JSON document. Only building it needs the lock; the render
+    // task doesn't wait on the flash write.
     JsonDocument doc;
+    std::unique_lock<std::mutex> guard = lock();
     
     // Save device config
     JsonObject deviceObj = doc["device"].to<JsonObject>();
@@ -515,6 +558,22 @@ bool Configuration::saveToLittleFS() {
     deviceObj["audioEnabled"] = deviceConfig.audioEnabled;
     deviceObj["audioVolume"] = deviceConfig.audioVolume;
     deviceObj["globalBrightness"] = deviceConfig.globalBrightness;
+    deviceObj["frameRate"] = deviceConfig.frameRate;
+    
+    JsonObject layersObj = deviceObj["layers"].to<JsonObject>();
+    for (uint8_t i = 0; i < LAYER_COUNT; i++) {
+        JsonObject layerObj = layersObj[layerName(i)].to<JsonObject>();
+        layerObj["blend"] = blendModeName(deviceConfig.layers[i].blend);
+        layerObj["opacity"] = deviceConfig.layers[i].opacity;
+    }
+    deviceObj["transitionMs"] = deviceConfig.transitionMs;
+    deviceObj["transitionEasing"] = easingName(deviceConfig.transitionEasing);
+    
+    JsonObject policyObj = deviceObj["audioPolicy"].to<JsonObject>();
+    for (uint8_t i = 0; i < AUDIO_PRIORITY_COUNT; i++) {
+        policyObj[audioPriorityName((AudioPriority)i)] = audioPolicyName(deviceConfig.audioPolicies[i]);
+    }
+    deviceObj["audioRetriggerMs"] = deviceConfig.audioRetriggerMs;
     deviceObj["otaPassword"] = deviceConfig.otaPassword;
     deviceObj["apPassword"] = deviceConfig.apPassword;
     
@@ -553,6 +612,7 @@ bool Configuration::saveToLittleFS() {
         configObj["audioFile"] = sceneConfig.audioFile;
         configObj["duration"] = sceneConfig.duration;
         configObj["audioTimeout"] = sceneConfig.audioTimeout;
+        configObj["audioReactive"] = sceneConfig.audioReactive;
         configObj["enabled"] = sceneConfig.enabled;
         
         // Save type
@@ -564,7 +624,21 @@ bool Configuration::saveToLittleFS() {
         for (const String& group : sceneConfig.targetGroups) {
             groupsArray.add(group);
         }
+        
+        // Save timeline
+        if (sceneConfig.hasTimeline()) {
+            JsonArray timelineArray = configObj["timeline"].to<JsonArray>();
+            for (const TimelineCue& cue : sceneConfig.timeline) {
+                writeTimelineCue(cue, timelineArray.add<JsonObject>());
+            }
+        }
+        
+        // Save VFX parameters
+        if (sceneConfig.parameters.size() > 0) {
+            configObj["parameters"] = sceneConfig.parameters;
+        }
     }
+    guard.unlock();
     
     // Open file for writing
     File file = LittleFS.open("/config.json", "w");
@@ -600,6 +674,15 @@ void Configuration::createDefaultConfiguration() {
     deviceConfig.firmwareVersion = "2.10.0-esp32s3-hardware";
     deviceConfig.audioEnabled = true;
     deviceConfig.audioVolume = 20;
+    deviceConfig.frameRate = 50;
+    for (LayerConfig& layer : deviceConfig.layers) {
+        layer = LayerConfig();
+    }
+    deviceConfig.transitionMs = 200;
+    deviceConfig.transitionEasing = Easing::EASE_IN_OUT;
+    const DeviceConfig defaults;
+    memcpy(deviceConfig.audioPolicies, defaults.audioPolicies, sizeof(deviceConfig.audioPolicies));
+    deviceConfig.audioRetriggerMs = defaults.audioRetriggerMs;
     deviceConfig.otaPassword = "battlesync";
     deviceConfig.apPassword = "battlesync";
     
@@ -607,6 +690,8 @@ void Configuration::createDefaultConfiguration() {
     // This allows testing with any hardware setup
     // VFX will be enabled automatically when zones are added
     
+    rebuildZoneIndex();
+    
     Serial.println("Configuration: Default configuration created");
 }
 
@@ -2,7 +2,11 @@
 
 #include "ZoneConfig.h"
 #include "SceneConfig.h"
+#include "LayerConfig.h"
+#include "AudioConfig.h"
 #include <map>
+#include <atomic>
+#include <mutex>
 #include <LittleFS.h>
 
 namespace BattleAura {
@@ -28,11 +32,20 @@ struct DeviceConfig {
     uint8_t audioVolume;
     bool audioEnabled;
     uint8_t globalBrightness;
+    uint8_t frameRate;          // Target render frame rate (FPS)
+    LayerConfig layers[LAYER_COUNT]; // Ambient/active/global compositing
+    uint16_t transitionMs;      // Cross-fade when an effect ends on a zone (0 = cut)
+    Easing transitionEasing;
+    AudioPolicy audioPolicies[AUDIO_PRIORITY_COUNT]; // Collision policy per priority (ambient unused)
+    uint16_t audioRetriggerMs;  // Ignore the same cue again within this window
     String firmwareVersion;
     
     DeviceConfig() : deviceName("BattleAura"), otaPassword("battlesync"),
                     apPassword("battlesync"), audioVolume(20), audioEnabled(true),
-                    globalBrightness(255), firmwareVersion("2.10.0-esp32s3-hardware") {}
+                    globalBrightness(255), frameRate(50), transitionMs(200),
+                    transitionEasing(Easing::EASE_IN_OUT),
+                    audioPolicies{AudioPolicy::PREEMPT, AudioPolicy::PREEMPT, AudioPolicy::QUEUE},
+                    audioRetriggerMs(150), firmwareVersion("2.10.0-esp32s3-hardware") {}
 };
 
 class Configuration {
@@ -42,18 +55,28 @@ public:
     // Initialization
     bool begin();
     bool load();
-    bool save();
-    bool factoryReset();
+    bool save();            // Loop task only, so saves never overlap
+    void factoryReset();    // Defaults in memory; save() stores them
+    
+    // The render task reads zones, scenes, tracks and its own and the audio
+    // settings every frame without locking, so only it changes them (through
+    // VFXManager's request calls), holding lock() while it does. Other tasks
+    // hold lock() while they read anything, and while they change what the
+    // render task never reads (names, WiFi). Whoever changes something calls
+    // markChanged() and the loop task saves it.
+    std::unique_lock<std::mutex> lock() const { return std::unique_lock<std::mutex>(mutex); }
+    void markChanged() { changed = true; }
+    bool takeChanged() { return changed.exchange(false); }
     
     // Zone management
     bool addZone(const Zone& zone);
     bool removeZone(uint8_t zoneId);
     Zone* getZone(uint8_t zoneId);
     const Zone* getZone(uint8_t zoneId) const;
-    std::vector<Zone*> getZonesByGroup(const String& groupName);
-    std::vector<Zone*> getAllZones();
-    const std::vector<Zone*> getAllZones() const;
+    const std::vector<Zone*>& getZonesByGroup(const String& groupName) const;
+    const std::vector<Zone*>& getAllZones() const;
     uint8_t getNextZoneId() const;
+    uint32_t getZoneGeneration() const { return zoneGeneration; } // Changes whenever zone lists are rebuilt
     
     // Group management  
     bool addGroup(const Group& group);
@@ -105,6 +128,17 @@ private:
     std::map<uint16_t, AudioTrack> audioTracks; // fileNumber -> AudioTrack
     DeviceConfig deviceConfig;
     
+    mutable std::mutex mutex;
+    std::atomic<bool> changed{false};
+    
+    // Lookup caches, rebuilt only when zones change
+    Zone* zoneLookup[256];                              // zoneId -> Zone
+    std::vector<Zone*> allZones;                        // All zones in id order
+    std::map<String, std::vector<Zone*>> groupZones;    // groupName -> zones
+    std::vector<Zone*> noZones;                         // Returned for unknown groups
+    uint32_t zoneGeneration;
+    
+    void rebuildZoneIndex();
     bool loadFromLittleFS();
     bool saveToLittleFS();
     void createDefaultConfiguration();
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace BattleAura {
+
+// Compositing layers, bottom to top. Indices match VFXPriority.
+const uint8_t LAYER_COUNT = 3;
+
+enum class BlendMode : uint8_t {
+    REPLACE,   // Cover the layers below (cross-fade by opacity)
+    ADD,       // Brighten the layers below
+    MAX,       // Per-channel maximum of this layer and the layers below
+    MULTIPLY   // Tint/darken the layers below
+};
+
+// Curve for cross-fades between effect outputs
+enum class Easing : uint8_t {
+    LINEAR,
+    EASE_IN,
+    EASE_OUT,
+    EASE_IN_OUT,
+    GAMMA       // Linear in light output rather than PWM duty / RGB value
+};
+
+struct LayerConfig {
+    BlendMode blend;
+    uint8_t opacity;   // 0-255, 255 = fully applied
+    
+    LayerConfig() : blend(BlendMode::REPLACE), opacity(255) {}
+};
+
+inline const char* layerName(uint8_t layer) {
+    static const char* const names[LAYER_COUNT] = {"ambient", "active", "global"};
+    return layer < LAYER_COUNT ? names[layer] : "unknown";
+}
+
+inline const char* blendModeName(BlendMode mode) {
+    switch (mode) {
+        case BlendMode::ADD:      return "add";
+        case BlendMode::MAX:      return "max";
+        case BlendMode::MULTIPLY: return "multiply";
+        default:                  return "replace";
+    }
+}
+
+inline bool parseBlendMode(const String& name, BlendMode& mode) {
+    if (name == "replace")       mode = BlendMode::REPLACE;
+    else if (name == "add")      mode = BlendMode::ADD;
+    else if (name == "max")      mode = BlendMode::MAX;
+    else if (name == "multiply") mode = BlendMode::MULTIPLY;
+    else return false;
+    return true;
+}
+
+inline const char* easingName(Easing easing) {
+    switch (easing) {
+        case Easing::EASE_IN:     return "ease-in";
+        case Easing::EASE_OUT:    return "ease-out";
+        case Easing::EASE_IN_OUT: return "ease-in-out";
+        case Easing::GAMMA:       return "gamma";
+        default:                  return "linear";
+    }
+}
+
+inline bool parseEasing(const String& name, Easing& easing) {
+    if (name == "linear")           easing = Easing::LINEAR;
+    else if (name == "ease-in")     easing = Easing::EASE_IN;
+    else if (name == "ease-out")    easing = Easing::EASE_OUT;
+    else if (name == "ease-in-out") easing = Easing::EASE_IN_OUT;
+    else if (name == "gamma")       easing = Easing::GAMMA;
+    else return false;
+    return true;
+}
+
+} // namespace BattleAura
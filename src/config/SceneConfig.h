@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <vector>
+#include "TimelineConfig.h"
 
 namespace BattleAura {
 
@@ -26,13 +27,17 @@ struct SceneConfig {
     String audioDescription;            // User's description of audio file
     uint32_t duration;                  // Duration in ms, 0 = infinite/ambient
     uint32_t audioTimeout;              // Audio timeout in ms, 0 = no timeout
-    JsonDocument parameters;            // VFX-specific parameters  
+    JsonDocument parameters;            // VFX tunables by name, see BaseVFX::getParamSchema()
+    std::vector<TimelineCue> timeline;  // Timed cues from trigger, sorted by atMs
+    bool audioReactive;                 // Scale brightness by the audio file's loudness envelope
     bool enabled;                       // VFX enabled/disabled
     
-    SceneConfig() : type(SceneType::AMBIENT), audioFile(0), duration(0), audioTimeout(0), enabled(true) {}
+    SceneConfig() : type(SceneType::AMBIENT), audioFile(0), duration(0), audioTimeout(0),
+                    audioReactive(false), enabled(true) {}
     
     SceneConfig(const String& _name, SceneType _type, uint32_t _duration = 0)
-        : name(_name), type(_type), audioFile(0), duration(_duration), audioTimeout(0), enabled(true) {}
+        : name(_name), type(_type), audioFile(0), duration(_duration), audioTimeout(0),
+          audioReactive(false), enabled(true) {}
     
     void addTargetGroup(const String& groupName) {
         // Avoid duplicates
@@ -73,6 +78,10 @@ struct SceneConfig {
     bool isInfinite() const {
         return duration == 0;
     }
+    
+    bool hasTimeline() const {
+        return !timeline.empty();
+    }
 };
 
 // Runtime VFX instance
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <vector>
+#include <algorithm>
+
+namespace BattleAura {
+
+// One timed step of a scene, relative to when the scene is triggered.
+// Audio cues are sent at atMs; visual cues wait for the measured DFPlayer
+// start latency on top, so they land with the sound rather than before it.
+struct TimelineCue {
+    enum class Action : uint8_t {
+        AUDIO,      // Play fileNumber at the scene's audio priority
+        TRIGGER,    // Trigger the VFX named vfxName for duration ms (0 = its default)
+        COLOR,      // Tint the scene's zones; white leaves them unchanged
+        INTENSITY   // Scale the scene's zones; 255 leaves them unchanged
+    };
+
+    uint32_t atMs;
+    Action action;
+    uint16_t fileNumber;        // AUDIO
+    String vfxName;             // TRIGGER
+    uint32_t duration;          // TRIGGER
+    uint32_t color;             // COLOR, 0xRRGGBB
+    uint8_t intensity;          // INTENSITY
+
+    TimelineCue() : atMs(0), action(Action::AUDIO), fileNumber(0), duration(0),
+                    color(0xFFFFFF), intensity(255) {}
+
+    bool isAudio() const { return action == Action::AUDIO; }
+};
+
+inline const char* timelineActionName(TimelineCue::Action action) {
+    switch (action) {
+        case TimelineCue::Action::TRIGGER:   return "trigger";
+        case TimelineCue::Action::COLOR:     return "color";
+        case TimelineCue::Action::INTENSITY: return "intensity";
+        default:                             return "audio";
+    }
+}
+
+inline bool parseTimelineAction(const String& name, TimelineCue::Action& action) {
+    if (name == "audio")          action = TimelineCue::Action::AUDIO;
+    else if (name == "trigger")   action = TimelineCue::Action::TRIGGER;
+    else if (name == "color")     action = TimelineCue::Action::COLOR;
+    else if (name == "intensity") action = TimelineCue::Action::INTENSITY;
+    else return false;
+    return true;
+}
+
+// {"at":1200,"action":"trigger","vfx":"Damage","duration":300}
+// {"at":0,"action":"audio","file":8}
+// {"at":400,"action":"color","color":"#FF8000"}
+// {"at":900,"action":"intensity","intensity":96}
+inline bool parseTimelineCue(JsonVariantConst json, TimelineCue& cue) {
+    String action = json["action"] | "";
+    if (!parseTimelineAction(action, cue.action)) return false;
+
+    cue.atMs = json["at"] | 0;
+    switch (cue.action) {
+        case TimelineCue::Action::AUDIO:
+            cue.fileNumber = json["file"] | 0;
+            return cue.fileNumber != 0;
+        case TimelineCue::Action::TRIGGER:
+            cue.vfxName = json["vfx"] | "";
+            cue.duration = json["duration"] | 0;
+            return !cue.vfxName.isEmpty();
+        case TimelineCue::Action::COLOR: {
+            String hex = json["color"] | "";
+            if (hex.length() != 7 || hex[0] != '#') return false;
+            char* end = nullptr;
+            cue.color = strtoul(hex.c_str() + 1, &end, 16);
+            return *end == '\0';
+        }
+        case TimelineCue::Action::INTENSITY:
+            cue.intensity = json["intensity"] | 255;
+            return true;
+    }
+    return false;
+}
+
+inline void writeTimelineCue(const TimelineCue& cue, JsonObject json) {
+    json["at"] = cue.atMs;
+    json["action"] = timelineActionName(cue.action);
+    switch (cue.action) {
+        case TimelineCue::Action::AUDIO:
+            json["file"] = cue.fileNumber;
+            break;
+        case TimelineCue::Action::TRIGGER:
+            json["vfx"] = cue.vfxName;
+            json["duration"] = cue.duration;
+            break;
+        case TimelineCue::Action::COLOR: {
+            char hex[8];
+            snprintf(hex, sizeof(hex), "#%06lX", (unsigned long)(cue.color & 0xFFFFFF));
+            json["color"] = hex;
+            break;
+        }
+        case TimelineCue::Action::INTENSITY:
+            json["intensity"] = cue.intensity;
+            break;
+    }
+}
+
+// Playback walks cues in order, so keep them sorted by time. Cues at the
+// same time keep their written order.
+inline void sortTimeline(std::vector<TimelineCue>& timeline) {
+    std::stable_sort(timeline.begin(), timeline.end(),
+                     [](const TimelineCue& a, const TimelineCue& b) { return a.atMs < b.atMs; });
+}
+
+} // namespace BattleAura
@@ -0,0 +1,119 @@
+#include "AllocCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<uint32_t> allocationCount(0);
+
+#ifdef ESP_PLATFORM
+// Set once from the render task; read by every allocation
+std::atomic<TaskHandle_t> trackedTask(nullptr);
+
+bool isTrackedTask() {
+    TaskHandle_t task = trackedTask.load(std::memory_order_relaxed);
+    return task && xTaskGetCurrentTaskHandle() == task;
+}
+#else
+// Host builds: the simulation's own threads (sync loopback) stay uncounted
+thread_local bool trackedThread = false;
+
+bool isTrackedTask() {
+    return trackedThread;
+}
+#endif
+
+} // namespace
+
+namespace BattleAura {
+
+bool AllocCounter::isEnabled() {
+#ifdef BATTLEAURA_ALLOC_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocCounter::trackCurrentTask() {
+#ifdef ESP_PLATFORM
+    trackedTask.store(xTaskGetCurrentTaskHandle(), std::memory_order_relaxed);
+#else
+    trackedThread = true;
+#endif
+}
+
+uint32_t AllocCounter::getAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+} // namespace BattleAura
+
+#ifdef BATTLEAURA_ALLOC_TRACKING
+
+// The C allocator is wrapped at link time (-Wl,--wrap=malloc etc. in the
+// tracking environments), so every malloc call in the image, C++ or not,
+// lands here first
+
+extern "C" {
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+static void countAllocation() {
+    if (isTrackedTask()) allocationCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* __wrap_malloc(size_t size) {
+    countAllocation();
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    countAllocation();
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    // Growing in place still goes to the allocator
+    countAllocation();
+    return __real_realloc(ptr, size);
+}
+
+} // extern "C"
+
+// Replace the global operator new/delete so C++ allocations reach the wrapped
+// malloc even where the toolchain's own operator new is a shared library
+
+static void* countedAlloc(size_t size) {
+    return malloc(size ? size : 1);
+}
+
+void* operator new(size_t size) {
+    void* ptr = countedAlloc(size);
+    if (!ptr) abort();
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    void* ptr = countedAlloc(size);
+    if (!ptr) abort();
+    return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+
+#endif // BATTLEAURA_ALLOC_TRACKING
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace BattleAura {
+
+// Heap allocation counter used to prove the render path is allocation-free.
+// Only allocations made by the task that called trackCurrentTask() are
+// counted, so the web, WiFi and audio tasks running alongside a frame don't
+// show up in it. Both operator new and the C allocator (malloc, calloc,
+// realloc, which Arduino String and strdup use) are counted.
+// Counting is only compiled in with -DBATTLEAURA_ALLOC_TRACKING (see the
+// seeed_xiao_esp32s3_alloc environment); otherwise the count stays at zero.
+class AllocCounter {
+public:
+    static bool isEnabled();
+    // Count allocations made from the calling task (the render task) from now on
+    static void trackCurrentTask();
+    static uint32_t getAllocationCount();
+};
+
+} // namespace BattleAura
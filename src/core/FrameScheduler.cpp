@@ -0,0 +1,113 @@
+#include "FrameScheduler.h"
+
+namespace BattleAura {
+
+FrameScheduler::FrameScheduler()
+    : targetFps(DEFAULT_FPS), framePeriodUs(1000000UL / DEFAULT_FPS),
+      nextFrameUs(0), frameStartUs(0), frameTimeMs(0) {
+    resetStats();
+}
+
+void FrameScheduler::begin(uint8_t fps) {
+    setTargetFps(fps);
+    resetStats();
+    nextFrameUs = micros();
+    
+    Serial.printf("FrameScheduler: Running at %d FPS (%lu us per frame)\n", 
+                 targetFps, (unsigned long)framePeriodUs);
+}
+
+void FrameScheduler::setTargetFps(uint8_t fps) {
+    fps = clampFps(fps);
+    if (fps == targetFps) return;
+    
+    targetFps = fps;
+    framePeriodUs = 1000000UL / targetFps;
+    
+    // Restart pacing from now so the new period takes effect immediately
+    nextFrameUs = micros();
+    Serial.printf("FrameScheduler: Target frame rate set to %d FPS\n", targetFps);
+}
+
+uint32_t FrameScheduler::waitForFrame() {
+    // Sleep the whole wait, so the core idles between frames and lower
+    // priority tasks get it. Rounded up to whole ticks: frames start up to a
+    // tick late rather than spinning for the edge. A delay can end just
+    // before its last tick is up, hence the loop.
+    int32_t remainingUs;
+    while ((remainingUs = (int32_t)(nextFrameUs - micros())) > 0) {
+        delay((remainingUs + 999) / 1000);
+    }
+    
+    frameStartUs = micros();
+    frameTimeMs = millis();
+    
+    // Jitter: how late this frame started against its deadline
+    uint32_t jitterUs = frameStartUs - nextFrameUs;
+    if (jitterUs > stats.maxJitterUs) stats.maxJitterUs = jitterUs;
+    stats.avgJitterUs = stats.avgJitterUs - (stats.avgJitterUs >> 4) + (jitterUs >> 4);
+    stats.frameCount++;
+    
+    // Schedule the next frame; if we're already past it, drop the missed slots
+    // instead of bursting frames to catch up
+    nextFrameUs += framePeriodUs;
+    int32_t lateUs = (int32_t)(frameStartUs - nextFrameUs);
+    if (lateUs >= 0) {
+        uint32_t missed = (uint32_t)lateUs / framePeriodUs + 1;
+        stats.droppedFrames += missed;
+        nextFrameUs += missed * framePeriodUs;
+    }
+    
+    return frameTimeMs;
+}
+
+void FrameScheduler::endFrame() {
+    uint32_t workUs = micros() - frameStartUs;
+    
+    stats.lastWorkUs = workUs;
+    if (workUs > stats.maxWorkUs) stats.maxWorkUs = workUs;
+    stats.avgWorkUs = stats.avgWorkUs - (stats.avgWorkUs >> 4) + (workUs >> 4);
+    
+    if (workUs > framePeriodUs) {
+        stats.overrunCount++;
+    }
+}
+
+void FrameScheduler::recordRenderAllocations(uint32_t allocations) {
+    stats.lastRenderAllocs = allocations;
+    if (allocations > stats.maxRenderAllocs) stats.maxRenderAllocs = allocations;
+    if (allocations > 0) stats.allocatingFrames++;
+}
+
+uint8_t FrameScheduler::getLoadPercent() const {
+    uint32_t load = (stats.avgWorkUs * 100) / framePeriodUs;
+    return load > 100 ? 100 : (uint8_t)load;
+}
+
+void FrameScheduler::resetStats() {
+    memset(&stats, 0, sizeof(stats));
+}
+
+void FrameScheduler::printStatus() const {
+    Serial.println("=== FrameScheduler Status ===");
+    Serial.printf("Target: %d FPS (%lu us), Load: %d%%\n", 
+                 targetFps, (unsigned long)framePeriodUs, getLoadPercent());
+    Serial.printf("Frames: %lu, Overruns: %lu, Dropped: %lu\n",
+                 (unsigned long)stats.frameCount, 
+                 (unsigned long)stats.overrunCount, 
+                 (unsigned long)stats.droppedFrames);
+    Serial.printf("Work: %lu us avg, %lu us max | Jitter: %lu us avg, %lu us max\n",
+                 (unsigned long)stats.avgWorkUs, (unsigned long)stats.maxWorkUs,
+                 (unsigned long)stats.avgJitterUs, (unsigned long)stats.maxJitterUs);
+    Serial.printf("Render allocations: %lu last, %lu max, %lu frames allocating\n",
+                 (unsigned long)stats.lastRenderAllocs, (unsigned long)stats.maxRenderAllocs,
+                 (unsigned long)stats.allocatingFrames);
+}
+
+uint8_t FrameScheduler::clampFps(uint8_t fps) {
+    if (fps < MIN_FPS) return MIN_FPS;
+    if (fps > MAX_FPS) return MAX_FPS;
+    return fps;
+}
+
+} // namespace BattleAura
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace BattleAura {
+
+struct FrameStats {
+    uint32_t frameCount;        // Frames started since last reset
+    uint32_t overrunCount;      // Frames whose work took longer than the frame period
+    uint32_t droppedFrames;     // Frame slots skipped to resync after running late
+    uint32_t lastWorkUs;        // Work time of the most recent frame
+    uint32_t maxWorkUs;         // Worst work time seen
+    uint32_t avgWorkUs;         // Smoothed work time
+    uint32_t avgJitterUs;       // Smoothed wake-up lateness against the frame deadline
+    uint32_t maxJitterUs;       // Worst wake-up lateness seen
+    uint32_t lastRenderAllocs;  // Heap allocations in the last frame's render path
+    uint32_t maxRenderAllocs;   // Most allocations seen in one frame's render path
+    uint32_t allocatingFrames;  // Frames whose render path allocated at all
+};
+
+class FrameScheduler {
+public:
+    static const uint8_t DEFAULT_FPS = 50;
+    static const uint8_t MIN_FPS = 10;
+    static const uint8_t MAX_FPS = 120;
+    
+    FrameScheduler();
+    
+    // Initialization
+    void begin(uint8_t targetFps = DEFAULT_FPS);
+    
+    // Frame rate control
+    void setTargetFps(uint8_t fps);
+    static uint8_t clampFps(uint8_t fps);   // The rate setTargetFps() would run at
+    uint8_t getTargetFps() const { return targetFps; }
+    uint32_t getFramePeriodUs() const { return framePeriodUs; }
+    
+    // Frame pacing - sleep until the next frame boundary and return the shared
+    // frame timestamp (ms) that every VFX update in this frame uses
+    uint32_t waitForFrame();
+    void endFrame();
+    uint32_t getFrameTime() const { return frameTimeMs; }
+    uint32_t getNextFrameUs() const { return nextFrameUs; }
+    
+    // Move the next and all later frame deadlines, e.g. onto a sync group's
+    // frame grid; positive is later
+    void adjustPhase(int32_t deltaUs) { nextFrameUs += deltaUs; }
+    void recordRenderAllocations(uint32_t allocations);
+    
+    // Statistics
+    const FrameStats& getStats() const { return stats; }
+    uint8_t getLoadPercent() const;
+    void resetStats();
+    void printStatus() const;
+
+private:
+    uint8_t targetFps;
+    uint32_t framePeriodUs;
+    uint32_t nextFrameUs;       // Deadline of the next frame
+    uint32_t frameStartUs;      // When the current frame actually started
+    uint32_t frameTimeMs;       // Shared timestamp of the current frame
+    FrameStats stats;
+};
+
+} // namespace BattleAura
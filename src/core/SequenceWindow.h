@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace BattleAura {
+
+// Which of one sender's recent sequence numbers are settled, to tell a
+// retransmit from a new datagram. Sequences count up and wrap at 16 bits.
+// Each of the WINDOW sequences up to the newest settled one has its own bit,
+// so one left unsettled (e.g. refused as busy) can still run when it is resent
+// after a newer one. A sequence WINDOW or more behind the newest is taken as
+// the sender having restarted.
+class SequenceWindow {
+public:
+    static const int16_t WINDOW = 64;
+
+    bool isSettled(uint16_t sequence) const {
+        int16_t behind = (int16_t)(newest - sequence);
+        return behind >= 0 && behind < WINDOW && ((settled >> behind) & 1);
+    }
+
+    void settle(uint16_t sequence) {
+        int16_t ahead = (int16_t)(sequence - newest);
+        if (settled == 0 || ahead >= WINDOW || ahead <= -WINDOW) {
+            // The first, or too far from the rest to share the window
+            newest = sequence;
+            settled = 1;
+        } else if (ahead > 0) {
+            newest = sequence;
+            settled = (settled << ahead) | 1;
+        } else {
+            settled |= 1ULL << -ahead;
+        }
+    }
+
+private:
+    uint16_t newest = 0;
+    uint64_t settled = 0;       // Bit n: newest - n is settled (0 = none yet)
+};
+
+} // namespace BattleAura
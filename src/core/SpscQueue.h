@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+namespace BattleAura {
+
+// Bounded lock-free queue for exactly one producer task and one consumer task.
+// Neither side blocks: push() fails when the queue is full, pop() when it is
+// empty. Capacity must be a power of two; one slot is kept free to tell full
+// from empty, so Capacity - 1 items fit.
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscQueue capacity must be a power of two");
+
+public:
+    // Producer side
+    bool push(const T& item) {
+        size_t head = this->head.load(std::memory_order_relaxed);
+        size_t next = (head + 1) & (Capacity - 1);
+        if (next == tail.load(std::memory_order_acquire)) {
+            return false; // Full
+        }
+
+        items[head] = item;
+        this->head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& item) {
+        size_t tail = this->tail.load(std::memory_order_relaxed);
+        if (tail == head.load(std::memory_order_acquire)) {
+            return false; // Empty
+        }
+
+        item = items[tail];
+        this->tail.store((tail + 1) & (Capacity - 1), std::memory_order_release);
+        return true;
+    }
+
+    // Either side; only a snapshot while the other side is running
+    bool isEmpty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+    size_t size() const {
+        return (head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire)) & (Capacity - 1);
+    }
+    static constexpr size_t capacity() { return Capacity - 1; }
+
+private:
+    T items[Capacity];
+    std::atomic<size_t> head{0};    // Next slot the producer writes
+    std::atomic<size_t> tail{0};    // Next slot the consumer reads
+};
+
+} // namespace BattleAura
@@ -2,9 +2,10 @@
 
 namespace BattleAura {
 
-LedController::LedController() {
+LedController::LedController() : stripsChanged(false), lastUpdateMs(0), stats{} {
     // Reserve space to prevent vector reallocation which breaks WS2812B leds pointers
     zones.reserve(12); // ESP32-S3 supports max 11 GPIO pins for zones (1-9, 43-44)
+    rebuildZoneIndex();
 }
 
 LedController::~LedController() {
@@ -55,6 +56,7 @@ void LedController::addZone(const Zone& zone) {
         if (setupSuccess) {
             Serial.printf("LedController: Added WS2812B zone %d on GPIO %d (%d LEDs)\n", 
                          zone.id, zone.gpio, zone.ledCount);
+            stripsChanged = true; // Push the initial black frame
         }
     }
     
@@ -63,14 +65,24 @@ void LedController::addZone(const Zone& zone) {
         zones.pop_back(); // Remove the zone if setup failed
         return;
     }
+    
+    zoneIndex[zone.id] = zones.size() - 1;
 }
 
 void LedController::removeZone(uint8_t zoneId) {
+    ZoneState* zoneState = findZone(zoneId);
+    if (zoneState && zoneState->controller) {
+        // Detach the strip from FastLED before its buffer is freed
+        zoneState->controller->setLeds(nullptr, 0);
+        zoneState->controller = nullptr;
+    }
+    
     zones.erase(
         std::remove_if(zones.begin(), zones.end(),
             [zoneId](const ZoneState& zs) { return zs.zone.id == zoneId; }),
         zones.end()
     );
+    rebuildZoneIndex();
 }
 
 void LedController::setZoneBrightness(uint8_t zoneId, uint8_t brightness) {
@@ -87,6 +99,11 @@ void LedController::setZoneBrightness(uint8_t zoneId, uint8_t brightness) {
     
     uint8_t finalBrightness = (uint8_t)scaledBrightness;
     
+    if (zoneState->pixelMode) {
+        zoneState->pixelMode = false;
+        zoneState->needsUpdate = true;
+    }
+    
     if (zoneState->targetBrightness != finalBrightness) {
         zoneState->targetBrightness = finalBrightness;
         zoneState->needsUpdate = true;
@@ -104,6 +121,12 @@ void LedController::setZoneColor(uint8_t zoneId, CRGB color) {
         return; // Only WS2812B zones support color
     }
     
+    if (zoneState->pixelMode) {
+        // Back to solid fill - repaint the whole strip
+        zoneState->pixelMode = false;
+        zoneState->needsUpdate = true;
+    }
+    
     if (zoneState->targetColor != color) {
         zoneState->targetColor = color;
         zoneState->needsUpdate = true;
@@ -120,7 +143,8 @@ void LedController::setZoneColorAndBrightness(uint8_t zoneId, CRGB color, uint8_
     
     uint8_t finalBrightness = (uint8_t)scaledBrightness;
     
-    bool needsUpdate = false;
+    bool needsUpdate = zoneState->pixelMode;
+    zoneState->pixelMode = false;
     
     if (zoneState->targetBrightness != finalBrightness) {
         zoneState->targetBrightness = finalBrightness;
@@ -143,26 +167,69 @@ CRGB LedController::getZoneColor(uint8_t zoneId) const {
            zoneState->currentColor : CRGB::Black;
 }
 
-void LedController::update() {
+void LedController::startTransition(uint8_t zoneId, uint16_t durationMs, Easing easing) {
+    ZoneState* zoneState = findZone(zoneId);
+    if (!zoneState || durationMs == 0) return;
+    
+    zoneState->stage.fadeMs = durationMs;
+    zoneState->stage.fadeEasing = easing;
+    zoneState->stage.fadePending = true;
+    zoneState->stage.settling = true;
+}
+
+void LedController::setZoneSmoothing(uint8_t zoneId, uint16_t timeConstantMs) {
+    ZoneState* zoneState = findZone(zoneId);
+    if (zoneState) {
+        zoneState->stage.smoothingMs = timeConstantMs;
+    }
+}
+
+void LedController::update(uint32_t now) {
+    uint32_t deltaMs = (lastUpdateMs != 0 && (int32_t)(now - lastUpdateMs) > 0) ? now - lastUpdateMs : 0;
+    lastUpdateMs = now;
+    
     for (ZoneState& zoneState : zones) {
         if (zoneState.needsUpdate) {
-            // For Phase 2, directly set values - no smooth transitions yet
             zoneState.currentBrightness = zoneState.targetBrightness;
             zoneState.currentColor = zoneState.targetColor;
+            zoneState.stage.settling = true;
+            zoneState.needsUpdate = false;
+        }
+        
+        // Move the output toward the target and write it while it differs
+        if (zoneState.stage.settling && !zoneState.pixelMode) {
+            advanceOutput(zoneState, now, deltaMs);
             
-            // Update hardware based on zone type
+            const uint16_t* shown = zoneState.stage.shown;
             if (zoneState.zone.type == ZoneType::PWM) {
-                updatePWM(zoneState.pwmChannel, zoneState.currentBrightness, zoneState.zone.brightness);
+                updatePWM(zoneState.pwmChannel, shown[0] >> 8);
             } else if (zoneState.zone.type == ZoneType::WS2812B) {
-                updateWS2812B(zoneState);
+                updateWS2812B(zoneState, CRGB(shown[0] >> 8, shown[1] >> 8, shown[2] >> 8));
+                stripsChanged = true;
             }
-            
-            zoneState.needsUpdate = false;
+        }
+        
+        // Push only the pixels written since the last update
+        if (zoneState.pixelMode && zoneState.dirtyEnd > zoneState.dirtyStart) {
+            flushPixels(zoneState);
+            stripsChanged = true;
         }
     }
     
-    // Update FastLED for all WS2812B changes
+    // show() blocks for the RMT transmit of every strip, so only run it when
+    // an addressable strip actually changed. The ESP32 RMT driver sends all
+    // registered strips together, so a single strip can't be pushed alone.
+    if (!stripsChanged) {
+        stats.showsSkipped++;
+        return;
+    }
+    
+    uint32_t showStart = micros();
     FastLED.show();
+    stats.lastShowUs = micros() - showStart;
+    if (stats.lastShowUs > stats.maxShowUs) stats.maxShowUs = stats.lastShowUs;
+    stats.showsPerformed++;
+    stripsChanged = false;
 }
 
 bool LedController::isZoneConfigured(uint8_t zoneId) const {
@@ -172,6 +239,9 @@ bool LedController::isZoneConfigured(uint8_t zoneId) const {
 void LedController::printStatus() const {
     Serial.println("=== LedController Status ===");
     Serial.printf("Configured zones: %d\n", zones.size());
+    Serial.printf("Shows: %lu performed, %lu skipped (last %lu us, max %lu us)\n",
+                 (unsigned long)stats.showsPerformed, (unsigned long)stats.showsSkipped,
+                 (unsigned long)stats.lastShowUs, (unsigned long)stats.maxShowUs);
     
     for (const ZoneState& zoneState : zones) {
         const char* typeStr = (zoneState.zone.type == ZoneType::PWM) ? "PWM" : "WS2812B";
@@ -219,12 +289,8 @@ bool LedController::setupPWM(ZoneState& zoneState) {
     return true;
 }
 
-void LedController::updatePWM(uint8_t channel, uint8_t brightness, uint8_t maxBrightness) {
-    // Scale brightness from 0-maxBrightness to 0-255
-    uint16_t scaledBrightness = (brightness * 255) / maxBrightness;
-    if (scaledBrightness > 255) scaledBrightness = 255;
-    
-    ledcWrite(channel, scaledBrightness);
+void LedController::updatePWM(uint8_t channel, uint8_t duty) {
+    ledcWrite(channel, duty);
 }
 
 bool LedController::setupWS2812B(ZoneState& zoneState) {
@@ -235,7 +301,8 @@ bool LedController::setupWS2812B(ZoneState& zoneState) {
     }
     
     zoneState.leds = new CRGB[zoneState.zone.ledCount];
-    if (!zoneState.leds) {
+    zoneState.pixels = new CRGB[zoneState.zone.ledCount];
+    if (!zoneState.leds || !zoneState.pixels) {
         Serial.printf("LedController: Failed to allocate LEDs for zone %d\n", zoneState.zone.id);
         return false;
     }
@@ -243,26 +310,29 @@ bool LedController::setupWS2812B(ZoneState& zoneState) {
     // Initialize all LEDs to black
     for (uint8_t i = 0; i < zoneState.zone.ledCount; i++) {
         zoneState.leds[i] = CRGB::Black;
+        zoneState.pixels[i] = CRGB::Black;
     }
     
     // Add LED strip to FastLED - using template matching for ESP32-S3 pins
     // Valid GPIOs: 1-9 (always), 43-44 (if audio disabled)
     switch (zoneState.zone.gpio) {
-        case 1:  FastLED.addLeds<WS2812B, 1, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
-        case 2:  FastLED.addLeds<WS2812B, 2, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
-        case 3:  FastLED.addLeds<WS2812B, 3, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
-        case 4:  FastLED.addLeds<WS2812B, 4, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
-        case 5:  FastLED.addLeds<WS2812B, 5, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
-        case 6:  FastLED.addLeds<WS2812B, 6, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
-        case 7:  FastLED.addLeds<WS2812B, 7, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
-        case 8:  FastLED.addLeds<WS2812B, 8, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
-        case 9:  FastLED.addLeds<WS2812B, 9, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
-        case 43: FastLED.addLeds<WS2812B, 43, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
-        case 44: FastLED.addLeds<WS2812B, 44, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
+        case 1:  zoneState.controller = &FastLED.addLeds<WS2812B, 1, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
+        case 2:  zoneState.controller = &FastLED.addLeds<WS2812B, 2, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
+        case 3:  zoneState.controller = &FastLED.addLeds<WS2812B, 3, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
+        case 4:  zoneState.controller = &FastLED.addLeds<WS2812B, 4, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
+        case 5:  zoneState.controller = &FastLED.addLeds<WS2812B, 5, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
+        case 6:  zoneState.controller = &FastLED.addLeds<WS2812B, 6, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
+        case 7:  zoneState.controller = &FastLED.addLeds<WS2812B, 7, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
+        case 8:  zoneState.controller = &FastLED.addLeds<WS2812B, 8, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
+        case 9:  zoneState.controller = &FastLED.addLeds<WS2812B, 9, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
+        case 43: zoneState.controller = &FastLED.addLeds<WS2812B, 43, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
+        case 44: zoneState.controller = &FastLED.addLeds<WS2812B, 44, GRB>(zoneState.leds, zoneState.zone.ledCount); break;
         default:
             Serial.printf("LedController: Unsupported GPIO %d for WS2812B\n", zoneState.zone.gpio);
             delete[] zoneState.leds;
+            delete[] zoneState.pixels;
             zoneState.leds = nullptr;
+            zoneState.pixels = nullptr;
             return false;
     }
     
@@ -271,21 +341,194 @@ bool LedController::setupWS2812B(ZoneState& zoneState) {
     return true;
 }
 
-void LedController::updateWS2812B(ZoneState& zoneState) {
+void LedController::updateWS2812B(ZoneState& zoneState, CRGB color) {
     if (!zoneState.leds) return;
     
-    // Apply color and brightness to all LEDs in this zone
+    // Set all LEDs in this zone to the same color/brightness
+    for (uint8_t i = 0; i < zoneState.zone.ledCount; i++) {
+        zoneState.leds[i] = color;
+    }
+}
+
+uint8_t LedController::targetOutput(const ZoneState& zoneState, uint8_t* out) const {
+    // Brightness is relative to the zone max - scale it to the full 0-255 range
+    uint16_t scaledBrightness = zoneState.zone.brightness > 0 ?
+                                (zoneState.currentBrightness * 255) / zoneState.zone.brightness : 0;
+    if (scaledBrightness > 255) scaledBrightness = 255;
+    
+    if (zoneState.zone.type == ZoneType::PWM) {
+        out[0] = (uint8_t)scaledBrightness;
+        return 1;
+    }
+    
     CRGB color = zoneState.currentColor;
+    color.nscale8((uint8_t)scaledBrightness);
+    out[0] = color.r;
+    out[1] = color.g;
+    out[2] = color.b;
+    return 3;
+}
+
+// Easing curves on a 0-65535 progress value
+static uint16_t ease(uint16_t t, Easing easing) {
+    uint32_t x = t;
+    switch (easing) {
+        case Easing::EASE_IN:
+            return (x * x) >> 16;
+        case Easing::EASE_OUT:
+            return 65535 - (((65535 - x) * (65535 - x)) >> 16);
+        case Easing::EASE_IN_OUT:
+            // Smoothstep: 3x^2 - 2x^3
+            return (uint16_t)min<uint64_t>(65535, ((uint64_t)((x * x) >> 16) * (3 * 65536 - 2 * x)) >> 16);
+        default:
+            return t;
+    }
+}
+
+static uint16_t isqrt32(uint32_t value) {
+    uint32_t result = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > value) bit >>= 2;
+    
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t)result;
+}
+
+void LedController::advanceOutput(ZoneState& zoneState, uint32_t now, uint32_t deltaMs) {
+    OutputStage& stage = zoneState.stage;
+    uint8_t target[3];
+    uint8_t channels = targetOutput(zoneState, target);
+    
+    if (!stage.valid) {
+        // Coming out of pixel mode (or first write) - the strip shows its
+        // framebuffer, so fade from the average of what is on the LEDs
+        for (uint8_t c = 0; c < channels; c++) stage.shown[c] = target[c] << 8;
+        if (stage.fadePending && zoneState.leds && zoneState.zone.ledCount > 0) {
+            uint32_t sum[3] = {0, 0, 0};
+            for (uint16_t i = 0; i < zoneState.zone.ledCount; i++) {
+                sum[0] += zoneState.leds[i].r;
+                sum[1] += zoneState.leds[i].g;
+                sum[2] += zoneState.leds[i].b;
+            }
+            for (uint8_t c = 0; c < 3; c++) {
+                stage.shown[c] = (uint16_t)((sum[c] / zoneState.zone.ledCount) << 8);
+            }
+        }
+        stage.valid = true;
+    }
     
-    // Scale brightness - FastLED handles this internally but we need to respect zone max
-    uint8_t scaledBrightness = (zoneState.currentBrightness * 255) / zoneState.zone.brightness;
-    if (scaledBrightness > 255) scaledBrightness = 255;
+    if (stage.fadePending) {
+        memcpy(stage.from, stage.shown, sizeof(stage.from));
+        stage.fadeStart = now;
+        stage.fadePending = false;
+    }
     
-    color.nscale8(scaledBrightness);  // Apply brightness scaling to color
+    bool settled = true;
+    uint32_t elapsed = now - stage.fadeStart;
+    
+    if (stage.fadeMs > 0 && elapsed < stage.fadeMs) {
+        uint16_t progress = ease((uint16_t)((elapsed * 65535UL) / stage.fadeMs), stage.fadeEasing);
+        for (uint8_t c = 0; c < channels; c++) {
+            uint32_t to = target[c] << 8;
+            if (stage.fadeEasing == Easing::GAMMA) {
+                // Blend in linear light (value squared) so mid-fade isn't too dark
+                int64_t fromSq = (int64_t)stage.from[c] * stage.from[c];
+                int64_t toSq = (int64_t)to * to;
+                stage.shown[c] = isqrt32((uint32_t)(fromSq + (((toSq - fromSq) * progress) >> 16)));
+            } else {
+                int32_t from = stage.from[c];
+                stage.shown[c] = (uint16_t)(from + ((((int32_t)to - from) * progress) >> 16));
+            }
+        }
+        settled = false;
+    } else if (stage.smoothingMs > 0) {
+        // First-order low-pass: alpha = dt / (tau + dt), independent of frame rate
+        stage.fadeMs = 0;
+        uint32_t alpha = (deltaMs << 16) / (stage.smoothingMs + deltaMs);
+        for (uint8_t c = 0; c < channels; c++) {
+            int32_t to = target[c] << 8;
+            int32_t diff = to - (int32_t)stage.shown[c];
+            if (abs(diff) <= 0x80) {
+                stage.shown[c] = to; // Within half a step of the target
+            } else {
+                int32_t step = (int32_t)(((int64_t)diff * alpha) >> 16);
+                if (step == 0) step = diff > 0 ? 1 : -1; // Long time constants still arrive
+                stage.shown[c] = (uint16_t)(stage.shown[c] + step);
+                settled = false;
+            }
+        }
+    } else {
+        stage.fadeMs = 0;
+        for (uint8_t c = 0; c < channels; c++) stage.shown[c] = target[c] << 8;
+    }
     
-    // Set all LEDs in this zone to the same color/brightness
-    for (uint8_t i = 0; i < zoneState.zone.ledCount; i++) {
-        zoneState.leds[i] = color;
+    stage.settling = !settled;
+}
+
+void LedController::flushPixels(ZoneState& zoneState) {
+    if (!zoneState.leds || !zoneState.pixels) return;
+    
+    // Framebuffer is in VFX intensity space - apply the user limit relative to zone max
+    uint16_t scale = zoneState.zone.brightness > 0 ?
+                     (zoneState.userBrightness * 255) / zoneState.zone.brightness : 0;
+    if (scale > 255) scale = 255;
+    
+    for (uint16_t i = zoneState.dirtyStart; i < zoneState.dirtyEnd; i++) {
+        zoneState.leds[i] = zoneState.pixels[i];
+        zoneState.leds[i].nscale8((uint8_t)scale);
+    }
+    
+    zoneState.dirtyStart = 0;
+    zoneState.dirtyEnd = 0;
+}
+
+// Per-pixel framebuffer
+uint16_t LedController::getZonePixelCount(uint8_t zoneId) const {
+    const ZoneState* zoneState = findZone(zoneId);
+    return (zoneState && zoneState->pixels) ? zoneState->zone.ledCount : 0;
+}
+
+void LedController::setPixel(uint8_t zoneId, uint16_t index, CRGB color) {
+    ZoneState* zoneState = beginPixelWrite(zoneId);
+    if (!zoneState || index >= zoneState->zone.ledCount) return;
+    
+    if (zoneState->pixels[index] != color) {
+        zoneState->pixels[index] = color;
+        markPixelsDirty(*zoneState, index, index + 1);
+    }
+}
+
+void LedController::fillPixels(uint8_t zoneId, uint16_t start, uint16_t count, CRGB color) {
+    ZoneState* zoneState = beginPixelWrite(zoneId);
+    if (!zoneState || start >= zoneState->zone.ledCount) return;
+    
+    uint16_t end = min<uint16_t>(start + count, zoneState->zone.ledCount);
+    for (uint16_t i = start; i < end; i++) {
+        if (zoneState->pixels[i] != color) {
+            zoneState->pixels[i] = color;
+            markPixelsDirty(*zoneState, i, i + 1);
+        }
+    }
+}
+
+void LedController::blitPixels(uint8_t zoneId, uint16_t start, const CRGB* colors, uint16_t count) {
+    ZoneState* zoneState = beginPixelWrite(zoneId);
+    if (!zoneState || !colors || start >= zoneState->zone.ledCount) return;
+    
+    uint16_t end = min<uint16_t>(start + count, zoneState->zone.ledCount);
+    for (uint16_t i = start; i < end; i++) {
+        if (zoneState->pixels[i] != colors[i - start]) {
+            zoneState->pixels[i] = colors[i - start];
+            markPixelsDirty(*zoneState, i, i + 1);
+        }
     }
 }
 
@@ -303,6 +546,9 @@ void LedController::setUserBrightness(uint8_t zoneId, uint8_t brightness) {
     
     // Force recalculation of current VFX brightness
     zoneState->needsUpdate = true;
+    if (zoneState->pixelMode) {
+        markPixelsDirty(*zoneState, 0, zoneState->zone.ledCount);
+    }
     
     Serial.printf("LedController: Set user brightness for zone %d to %d\n", zoneId, brightness);
 }
@@ -312,22 +558,51 @@ uint8_t LedController::getUserBrightness(uint8_t zoneId) const {
     return zoneState ? zoneState->userBrightness : 0;
 }
 
-LedController::ZoneState* LedController::findZone(uint8_t zoneId) {
-    for (ZoneState& zoneState : zones) {
-        if (zoneState.zone.id == zoneId) {
-            return &zoneState;
-        }
+void LedController::rebuildZoneIndex() {
+    memset(zoneIndex, NO_ZONE, sizeof(zoneIndex));
+    for (size_t i = 0; i < zones.size(); i++) {
+        zoneIndex[zones[i].zone.id] = i;
     }
-    return nullptr;
+}
+
+LedController::ZoneState* LedController::findZone(uint8_t zoneId) {
+    uint8_t index = zoneIndex[zoneId];
+    return index != NO_ZONE ? &zones[index] : nullptr;
 }
 
 const LedController::ZoneState* LedController::findZone(uint8_t zoneId) const {
-    for (const ZoneState& zoneState : zones) {
-        if (zoneState.zone.id == zoneId) {
-            return &zoneState;
+    uint8_t index = zoneIndex[zoneId];
+    return index != NO_ZONE ? &zones[index] : nullptr;
+}
+
+LedController::ZoneState* LedController::beginPixelWrite(uint8_t zoneId) {
+    ZoneState* zoneState = findZone(zoneId);
+    if (!zoneState || !zoneState->pixels) {
+        return nullptr; // Only WS2812B zones have a framebuffer
+    }
+    
+    if (!zoneState->pixelMode) {
+        // Entering pixel mode - start from a black frame and repaint the whole strip
+        for (uint16_t i = 0; i < zoneState->zone.ledCount; i++) {
+            zoneState->pixels[i] = CRGB::Black;
         }
+        zoneState->pixelMode = true;
+        zoneState->stage.valid = false;
+        markPixelsDirty(*zoneState, 0, zoneState->zone.ledCount);
     }
-    return nullptr;
+    
+    return zoneState;
+}
+
+void LedController::markPixelsDirty(ZoneState& zoneState, uint16_t start, uint16_t end) {
+    if (zoneState.dirtyEnd <= zoneState.dirtyStart) {
+        zoneState.dirtyStart = start;
+        zoneState.dirtyEnd = end;
+        return;
+    }
+    
+    if (start < zoneState.dirtyStart) zoneState.dirtyStart = start;
+    if (end > zoneState.dirtyEnd) zoneState.dirtyEnd = end;
 }
 
 } // namespace BattleAura
\ No newline at end of file
@@ -2,11 +2,19 @@
 
 #include <Arduino.h>
 #include "../config/ZoneConfig.h"
+#include "../config/LayerConfig.h"
 #include <vector>
 #include <FastLED.h>
 
 namespace BattleAura {
 
+struct LedStats {
+    uint32_t showsPerformed;    // FastLED.show() calls that pushed changed strips
+    uint32_t showsSkipped;      // Frames where no addressable strip changed
+    uint32_t lastShowUs;        // Duration of the most recent show()
+    uint32_t maxShowUs;         // Longest show() seen
+};
+
 class LedController {
 public:
     LedController();
@@ -28,14 +36,46 @@ public:
     void setUserBrightness(uint8_t zoneId, uint8_t brightness);
     uint8_t getUserBrightness(uint8_t zoneId) const;
     
-    // Update hardware (apply changes)
-    void update();
+    // Per-pixel framebuffer (WS2812B zones only)
+    // Writing pixels switches the zone to pixel mode until the next solid
+    // setZoneColor/setZoneBrightness call. Pixels are in VFX intensity space;
+    // the user brightness limit is applied when they are pushed to the strip.
+    uint16_t getZonePixelCount(uint8_t zoneId) const;
+    void setPixel(uint8_t zoneId, uint16_t index, CRGB color);
+    void fillPixels(uint8_t zoneId, uint16_t start, uint16_t count, CRGB color);
+    void blitPixels(uint8_t zoneId, uint16_t start, const CRGB* colors, uint16_t count);
+    
+    // Output stage for solid (PWM and filled WS2812B) zones. Targets set above
+    // are reached through an eased cross-fade or a first-order smoothing filter
+    // rather than a jump. Pixel-mode strips always show their framebuffer as is.
+    //
+    // Cross-fade from what the zone shows now to the next target it is given
+    void startTransition(uint8_t zoneId, uint16_t durationMs, Easing easing);
+    // Low-pass every new target with this time constant (0 = jump to target)
+    void setZoneSmoothing(uint8_t zoneId, uint16_t timeConstantMs);
+    
+    // Update hardware (apply changes) - call once per frame with the frame time
+    void update(uint32_t now);
     
     // Utility
     bool isZoneConfigured(uint8_t zoneId) const;
     void printStatus() const;
+    const LedStats& getStats() const { return stats; }
 
 private:
+    // Where a solid zone's output is between its old and new target
+    struct OutputStage {
+        uint16_t shown[3];           // Output on the LEDs, 8.8 fixed point (PWM uses [0])
+        uint16_t from[3];            // Output when the running cross-fade started
+        uint32_t fadeStart;
+        uint16_t fadeMs;             // Running cross-fade length (0 = none)
+        Easing fadeEasing;
+        bool fadePending;            // Cross-fade starts at the next update()
+        bool valid;                  // shown reflects the LEDs (false after pixel mode)
+        bool settling;               // Output hasn't reached the target yet
+        uint16_t smoothingMs;        // First-order time constant (0 = off)
+    };
+    
     struct ZoneState {
         Zone zone;
         uint8_t currentBrightness;
@@ -47,27 +87,49 @@ private:
         uint8_t pwmChannel;          // PWM channel for PWM zones
         CRGB* leds;                  // FastLED array for WS2812B zones
         
+        CRGB* pixels;                // Framebuffer written by VFX in pixel mode
+        CLEDController* controller;  // FastLED controller driving this strip
+        bool pixelMode;              // Strip is rendered from the framebuffer
+        uint16_t dirtyStart;         // Dirty pixel range [dirtyStart, dirtyEnd)
+        uint16_t dirtyEnd;
+        OutputStage stage;
+        
         ZoneState(const Zone& z) : zone(z), currentBrightness(0), targetBrightness(0), 
                                    userBrightness(z.brightness), currentColor(CRGB::Black), 
                                    targetColor(CRGB::White), needsUpdate(false), 
-                                   pwmChannel(255), leds(nullptr) {}
+                                   pwmChannel(255), leds(nullptr), pixels(nullptr),
+                                   controller(nullptr), pixelMode(false),
+                                   dirtyStart(0), dirtyEnd(0), stage() {}
+        
+        // Buffers are owned; FastLED keeps raw pointers to leds, so zone states
+        // may only be moved (vector growth/erase), never copied.
+        ZoneState(const ZoneState&) = delete;
+        ZoneState& operator=(const ZoneState&) = delete;
         
-        // Copy constructor
-        ZoneState(const ZoneState& other) : zone(other.zone), 
-                                          currentBrightness(other.currentBrightness),
-                                          targetBrightness(other.targetBrightness),
-                                          userBrightness(other.userBrightness),
-                                          currentColor(other.currentColor),
-                                          targetColor(other.targetColor),
-                                          needsUpdate(other.needsUpdate),
-                                          pwmChannel(other.pwmChannel),
-                                          leds(nullptr) {
-            // Don't copy leds pointer - each instance manages its own memory
+        ZoneState(ZoneState&& other) noexcept : zone(other.zone),
+                                                currentBrightness(other.currentBrightness),
+                                                targetBrightness(other.targetBrightness),
+                                                userBrightness(other.userBrightness),
+                                                currentColor(other.currentColor),
+                                                targetColor(other.targetColor),
+                                                needsUpdate(other.needsUpdate),
+                                                pwmChannel(other.pwmChannel),
+                                                leds(other.leds),
+                                                pixels(other.pixels),
+                                                controller(other.controller),
+                                                pixelMode(other.pixelMode),
+                                                dirtyStart(other.dirtyStart),
+                                                dirtyEnd(other.dirtyEnd),
+                                                stage(other.stage) {
+            other.leds = nullptr;
+            other.pixels = nullptr;
+            other.controller = nullptr;
         }
         
-        // Copy assignment
-        ZoneState& operator=(const ZoneState& other) {
+        ZoneState& operator=(ZoneState&& other) noexcept {
             if (this != &other) {
+                delete[] leds;
+                delete[] pixels;
                 zone = other.zone;
                 currentBrightness = other.currentBrightness;
                 targetBrightness = other.targetBrightness;
@@ -76,31 +138,49 @@ private:
                 targetColor = other.targetColor;
                 needsUpdate = other.needsUpdate;
                 pwmChannel = other.pwmChannel;
-                // Don't copy leds pointer - each instance manages its own memory
-                leds = nullptr;
+                leds = other.leds;
+                pixels = other.pixels;
+                controller = other.controller;
+                pixelMode = other.pixelMode;
+                dirtyStart = other.dirtyStart;
+                dirtyEnd = other.dirtyEnd;
+                stage = other.stage;
+                other.leds = nullptr;
+                other.pixels = nullptr;
+                other.controller = nullptr;
             }
             return *this;
         }
         
         ~ZoneState() {
-            if (leds) {
-                delete[] leds;
-                leds = nullptr;
-            }
+            delete[] leds;
+            delete[] pixels;
         }
     };
     
     std::vector<ZoneState> zones;
+    uint8_t zoneIndex[256];      // zoneId -> index into zones (NO_ZONE if absent)
+    bool stripsChanged;          // Some WS2812B buffer changed since the last show()
+    uint32_t lastUpdateMs;       // Frame time of the previous update()
+    LedStats stats;
     
     // Hardware Management
     bool setupPWM(ZoneState& zoneState);
     bool setupWS2812B(ZoneState& zoneState);
-    void updatePWM(uint8_t channel, uint8_t brightness, uint8_t maxBrightness);
-    void updateWS2812B(ZoneState& zoneState);
+    void updatePWM(uint8_t channel, uint8_t duty);
+    void updateWS2812B(ZoneState& zoneState, CRGB color);
+    uint8_t targetOutput(const ZoneState& zoneState, uint8_t* out) const;
+    void advanceOutput(ZoneState& zoneState, uint32_t now, uint32_t deltaMs);
+    void flushPixels(ZoneState& zoneState);
+    
+    static const uint8_t NO_ZONE = 0xFF;
     
     // Helper methods
+    void rebuildZoneIndex();
     ZoneState* findZone(uint8_t zoneId);
     const ZoneState* findZone(uint8_t zoneId) const;
+    ZoneState* beginPixelWrite(uint8_t zoneId);
+    void markPixelsDirty(ZoneState& zoneState, uint16_t start, uint16_t end);
 };
 
 } // namespace BattleAura
\ No newline at end of file
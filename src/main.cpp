@@ -2,8 +2,13 @@
 #include "config/Configuration.h"
 #include "hardware/LedController.h"
 #include "web/WebServer.h"
+#include "web/TriggerServer.h"
+#include "web/MulticastSyncTransport.h"
+#include "sync/SyncGroup.h"
 #include "vfx/VFXManager.h"
 #include "audio/AudioController.h"
+#include "core/FrameScheduler.h"
+#include "core/AllocCounter.h"
 
 using namespace BattleAura;
 
@@ -11,8 +16,71 @@ using namespace BattleAura;
 Configuration BattleAura::config;
 LedController ledController;
 AudioController audioController(config);
-VFXManager vfxManager(ledController, audioController, config);
-WebServer webServer(config, ledController, vfxManager, audioController);
+FrameScheduler frameScheduler;
+VFXManager vfxManager(ledController, audioController, config, &frameScheduler);
+TriggerServer triggerServer(vfxManager);
+SyncGroup syncGroup(vfxManager, (uint32_t)ESP.getEfuseMac());
+MulticastSyncTransport syncTransport(syncGroup);
+WebServer webServer(config, ledController, vfxManager, audioController, frameScheduler, triggerServer, syncGroup);
+
+// Task layout. The render task owns VFXManager and LedController and runs on
+// the core that doesn't carry the WiFi stack. The DFPlayer UART is serviced by
+// its own task, so a slow reply can't stall a frame. Arduino loop() keeps OTA
+// and status logging at the lowest priority.
+static const BaseType_t RENDER_CORE = 1;
+static const UBaseType_t RENDER_PRIORITY = 3;
+static const uint32_t RENDER_STACK = 8192;
+static const BaseType_t AUDIO_CORE = 0;
+static const UBaseType_t AUDIO_PRIORITY = 1;
+static const uint32_t AUDIO_STACK = 4096;
+static const uint32_t AUDIO_POLL_MS = 20;
+
+void renderTask(void* parameter) {
+    // Only this task's allocations count towards the per-frame figure
+    AllocCounter::trackCurrentTask();
+    
+    for (;;) {
+        // Sleep until the next frame; every VFX sees the same frame timestamp
+        uint32_t frameTime = frameScheduler.waitForFrame();
+        
+        uint32_t allocsBefore = AllocCounter::getAllocationCount();
+        
+        // Update all VFX via VFXManager
+        vfxManager.update(frameTime);
+        
+        // Apply LED changes to hardware
+        ledController.update(frameTime);
+        
+        frameScheduler.recordRenderAllocations(AllocCounter::getAllocationCount() - allocsBefore);
+        frameScheduler.endFrame();
+        
+        // Keep frame edges on the sync group's grid so shared triggers land
+        // in the same frame on every device
+        frameScheduler.adjustPhase(syncGroup.getFrameCorrectionUs(frameScheduler.getNextFrameUs(),
+                                                                  frameScheduler.getFramePeriodUs()));
+        
+        // Print status every 15 seconds
+        static uint32_t lastPrint = 0;
+        if (millis() - lastPrint >= 15000) {
+            lastPrint = millis();
+            vfxManager.printStatus();
+            frameScheduler.printStatus();
+        }
+    }
+}
+
+void audioTask(void* parameter) {
+    // Starts the DFPlayer reset; the player comes online from update() a
+    // second or two later
+    if (!audioController.begin()) {
+        Serial.println("WARNING: AudioController failed to initialize (audio will be disabled)");
+    }
+    
+    for (;;) {
+        audioController.update();
+        vTaskDelay(pdMS_TO_TICKS(AUDIO_POLL_MS));
+    }
+}
 
 void setup() {
     Serial.begin(115200);
@@ -54,10 +122,16 @@ void setup() {
         return;
     }
     
-    // Initialize AudioController
-    Serial.println("Initializing AudioController...");
-    if (!audioController.begin()) {
-        Serial.println("WARNING: AudioController failed to initialize (audio will be disabled)");
+    // UDP triggers need the network and VFXManager's scene IDs
+    if (!triggerServer.begin()) {
+        Serial.println("WARNING: TriggerServer failed to start (UDP triggers disabled)");
+    }
+    
+    // Sync group over multicast; without it triggers just run locally
+    if (syncTransport.begin()) {
+        syncGroup.begin(syncTransport);
+    } else {
+        Serial.println("WARNING: Sync group transport failed to start (sync triggers run locally only)");
     }
     
     // Print status
@@ -66,6 +140,13 @@ void setup() {
     webServer.printStatus();
     vfxManager.printStatus();
     
+    // Start the frame clock last so the first frame isn't counted as an overrun
+    frameScheduler.begin(config.getDeviceConfig().frameRate);
+    
+    Serial.println("Starting render and audio tasks...");
+    xTaskCreatePinnedToCore(renderTask, "render", RENDER_STACK, nullptr, RENDER_PRIORITY, nullptr, RENDER_CORE);
+    xTaskCreatePinnedToCore(audioTask, "audio", AUDIO_STACK, nullptr, AUDIO_PRIORITY, nullptr, AUDIO_CORE);
+    
     Serial.println("\n=== Phase 2 System Ready ===");
     Serial.println("- Full VFX library with priority system active");
     Serial.println("- Mixed PWM and RGB LED support via FastLED");
@@ -76,17 +157,9 @@ void setup() {
 }
 
 void loop() {
-    // Handle web server and OTA
+    // Handle OTA; rendering and audio run in their own tasks
     webServer.handle();
-    
-    // Update all VFX via VFXManager
-    vfxManager.update();
-    
-    // Apply LED changes to hardware
-    ledController.update();
-    
-    // Update audio controller
-    audioController.update();
+    syncGroup.update(micros());
     
     // Print status every 15 seconds
     static uint32_t lastPrint = 0;
@@ -95,6 +168,8 @@ void loop() {
         Serial.printf("Status: VFX Active | WiFi: %s | IP: %s\n",
                      webServer.isWiFiConnected() ? "Connected" : "AP Mode",
                      webServer.getIPAddress().c_str());
-        vfxManager.printStatus();
+        syncGroup.printStatus();
     }
+    
+    delay(10);
 }
\ No newline at end of file
@@ -0,0 +1,399 @@
+#include "SyncGroup.h"
+
+namespace BattleAura {
+
+namespace {
+
+// Every message starts "BS", type, 0, then the sender's device ID
+const size_t HEADER_SIZE = 8;
+
+void writeU16(uint8_t* out, uint16_t value) {
+    out[0] = value;
+    out[1] = value >> 8;
+}
+
+void writeU32(uint8_t* out, uint32_t value) {
+    out[0] = value;
+    out[1] = value >> 8;
+    out[2] = value >> 16;
+    out[3] = value >> 24;
+}
+
+uint16_t readU16(const uint8_t* in) {
+    return in[0] | ((uint16_t)in[1] << 8);
+}
+
+uint32_t readU32(const uint8_t* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+} // namespace
+
+SyncGroup::SyncGroup(VFXManager& vfxManager, uint32_t deviceId)
+    : vfxManager(vfxManager), deviceId(deviceId), masterId(deviceId) {
+}
+
+void SyncGroup::begin(SyncTransport& transport) {
+    this->transport = &transport;
+    
+    // Alone until beacons say otherwise, and then our own clock is the group's
+    masterId = deviceId;
+    synced.store(true);
+    
+    Serial.printf("SyncGroup: Device %08lx joining on port %d\n", (unsigned long)deviceId, PORT);
+}
+
+void SyncGroup::receive(const uint8_t* data, size_t length, uint32_t receivedUs) {
+    if (length < HEADER_SIZE || length > MAX_MESSAGE_SIZE) {
+        receiveDropped++;
+        return;
+    }
+    
+    Datagram datagram;
+    memcpy(datagram.data, data, length);
+    datagram.length = length;
+    datagram.receivedUs = receivedUs;
+    if (!inbox.push(datagram)) {
+        receiveDropped++;
+    }
+}
+
+void SyncGroup::update(uint32_t nowUs) {
+    Datagram datagram;
+    while (inbox.pop(datagram)) {
+        handleMessage(datagram, nowUs);
+    }
+    
+    updateMembers(nowUs);
+    
+    if (nowUs - lastBeaconUs >= BEACON_INTERVAL_US) {
+        lastBeaconUs = nowUs;
+        uint8_t payload[4];
+        writeU32(payload, masterId);
+        send(MessageType::BEACON, payload, sizeof(payload));
+    }
+    
+    // Followers keep measuring their offset to the master, quickly at first
+    uint32_t clockInterval = sampleCount < CLOCK_SAMPLES ? CLOCK_FAST_INTERVAL_US : CLOCK_INTERVAL_US;
+    if (!isMaster() && nowUs - lastClockRequestUs >= clockInterval) {
+        lastClockRequestUs = nowUs;
+        uint8_t payload[8];
+        writeU32(payload, masterId);
+        writeU32(payload + 4, micros());
+        send(MessageType::CLOCK_REQUEST, payload, sizeof(payload));
+    }
+    
+    // Triggers started here: on the next frame of the group grid after the
+    // lead time, in the middle of it so small clock errors can't change
+    // which frame edge the devices pick
+    PendingTrigger pending;
+    while (pendingTriggers.pop(pending)) {
+        uint32_t period = framePeriodUs.load();
+        uint32_t executeAt = toGroupTime(nowUs) + TRIGGER_LEAD_US;
+        executeAt = executeAt - executeAt % period + period / 2;
+    
+        triggerSequence++;
+        Scheduled& entry = schedule(deviceId, triggerSequence, pending.vfxName, pending.duration, executeAt);
+        entry.resend = true;
+        entry.resendAtUs = nowUs + TRIGGER_RESEND_US;
+        sendTrigger(entry);
+        stats.triggersSent++;
+    }
+    
+    // Each trigger goes out twice; multicast over WiFi loses packets
+    for (Scheduled& entry : scheduled) {
+        if (entry.resend && (int32_t)(nowUs - entry.resendAtUs) >= 0) {
+            entry.resend = false;
+            sendTrigger(entry);
+        }
+    }
+    
+    reportRuns();
+    
+    if (skew.reports > 0 && nowUs - skew.openedUs >= SKEW_WINDOW_US) {
+        closeSkewWindow();
+    }
+}
+
+bool SyncGroup::requestTrigger(const String& vfxName, uint32_t duration) {
+    if (vfxName.length() == 0 || vfxName.length() > MAX_NAME_LENGTH) return false;
+    
+    PendingTrigger pending;
+    strncpy(pending.vfxName, vfxName.c_str(), sizeof(pending.vfxName));
+    pending.vfxName[MAX_NAME_LENGTH] = '\0';
+    pending.duration = duration;
+    return pendingTriggers.push(pending);
+}
+
+int32_t SyncGroup::getFrameCorrectionUs(uint32_t nextFrameUs, uint32_t period) {
+    framePeriodUs.store(period);
+    if (!synced.load() || period == 0) return 0;
+    
+    // Where the next edge falls in the group's frame grid, -period/2..period/2
+    int32_t error = toGroupTime(nextFrameUs) % period;
+    if (error > (int32_t)period / 2) error -= period;
+    
+    // A quarter of the way per frame, and never more than an eighth of a
+    // frame, so a clock step doesn't show as a stutter
+    int32_t limit = period / 8;
+    return constrain(-error / 4, -limit, limit);
+}
+
+uint8_t SyncGroup::getMemberCount() const {
+    uint8_t count = 1;
+    for (const Member& member : members) {
+        if (member.id != 0) count++;
+    }
+    return count;
+}
+
+void SyncGroup::printStatus() const {
+    Serial.printf("SyncGroup: %08lx, %d devices, master %08lx%s, offset %ld us (rtt %lu us)%s\n",
+                  (unsigned long)deviceId, getMemberCount(), (unsigned long)masterId,
+                  isMaster() ? " (this device)" : "", (long)offsetUs.load(),
+                  (unsigned long)stats.bestRttUs, synced.load() ? "" : ", not synced");
+    Serial.printf("SyncGroup: %lu triggers sent, %lu run | Skew: %lu samples, %lu us last, %lu us avg, %lu us max\n",
+                  (unsigned long)stats.triggersSent, (unsigned long)stats.triggersRun,
+                  (unsigned long)stats.skewSamples, (unsigned long)stats.lastSkewUs,
+                  (unsigned long)stats.avgSkewUs, (unsigned long)stats.maxSkewUs);
+}
+
+// Private methods
+
+void SyncGroup::handleMessage(const Datagram& datagram, uint32_t nowUs) {
+    const uint8_t* data = datagram.data;
+    if (data[0] != 'B' || data[1] != 'S') {
+        stats.dropped++;
+        return;
+    }
+    
+    // Our own multicast, looped back
+    uint32_t sender = readU32(data + 4);
+    if (sender == deviceId || sender == 0) return;
+    
+    stats.received++;
+    seen(sender, nowUs);
+    
+    const uint8_t* payload = data + HEADER_SIZE;
+    size_t length = datagram.length - HEADER_SIZE;
+    
+    switch ((MessageType)data[2]) {
+        case MessageType::BEACON:
+            break;
+        case MessageType::CLOCK_REQUEST:
+            if (length == 8 && isMaster() && readU32(payload) == deviceId) {
+                uint8_t reply[16];
+                writeU32(reply, sender);
+                memcpy(reply + 4, payload + 4, 4);
+                writeU32(reply + 8, toGroupTime(datagram.receivedUs));
+                writeU32(reply + 12, toGroupTime(micros()));
+                send(MessageType::CLOCK_REPLY, reply, sizeof(reply));
+            }
+            break;
+        case MessageType::CLOCK_REPLY:
+            if (length == 16 && sender == masterId && readU32(payload) == deviceId) {
+                handleClockReply(payload, datagram.receivedUs);
+            }
+            break;
+        case MessageType::TRIGGER:
+            handleTrigger(sender, payload, length);
+            break;
+        case MessageType::REPORT:
+            if (length == 10) handleReport(payload);
+            break;
+        default:
+            stats.dropped++;
+            break;
+    }
+}
+
+void SyncGroup::handleClockReply(const uint8_t* data, uint32_t receivedUs) {
+    // NTP's four timestamps: t0 sent and t3 received on our clock, t1
+    // received and t2 sent on the group clock
+    uint32_t t0 = readU32(data + 4);
+    uint32_t t1 = readU32(data + 8);
+    uint32_t t2 = readU32(data + 12);
+    uint32_t t3 = receivedUs;
+    
+    int32_t rtt = (int32_t)((t3 - t0) - (t2 - t1));
+    if (rtt < 0) return;
+    
+    // Mean of the two one-way offsets; they differ by the round trip
+    uint32_t outbound = t1 - t0;
+    uint32_t inbound = t2 - t3;
+    addClockSample((int32_t)(outbound + (uint32_t)((int32_t)(inbound - outbound) / 2)), rtt);
+}
+
+void SyncGroup::handleTrigger(uint32_t origin, const uint8_t* data, size_t length) {
+    // sequence, duration, executeAt, name length, name
+    if (length < 11 || length != 11u + data[10] || data[10] == 0 || data[10] > MAX_NAME_LENGTH) {
+        stats.dropped++;
+        return;
+    }
+    
+    uint16_t sequence = readU16(data);
+    for (const Scheduled& entry : scheduled) {
+        if (entry.origin == origin && entry.sequence == sequence) return;    // The repeat
+    }
+    
+    char vfxName[MAX_NAME_LENGTH + 1];
+    memcpy(vfxName, data + 11, data[10]);
+    vfxName[data[10]] = '\0';
+    schedule(origin, sequence, vfxName, readU32(data + 2), readU32(data + 6));
+}
+
+void SyncGroup::handleReport(const uint8_t* data) {
+    recordRun(readU32(data), readU16(data + 4), readU32(data + 6));
+}
+
+void SyncGroup::updateMembers(uint32_t nowUs) {
+    uint32_t lowest = deviceId;
+    for (Member& member : members) {
+        if (member.id == 0) continue;
+        if (nowUs - member.lastSeenUs > MEMBER_TIMEOUT_US) {
+            Serial.printf("SyncGroup: Device %08lx left\n", (unsigned long)member.id);
+            member.id = 0;
+            continue;
+        }
+        if (member.id < lowest) lowest = member.id;
+    }
+    
+    if (lowest == masterId) return;
+    
+    // The group clock carries on from the new master's idea of it, so only
+    // the samples are restarted; a master keeps the offset it had
+    Serial.printf("SyncGroup: Master is now %08lx%s\n", (unsigned long)lowest, lowest == deviceId ? " (this device)" : "");
+    masterId = lowest;
+    sampleCount = 0;
+    nextSample = 0;
+    if (isMaster()) synced.store(true);
+}
+
+void SyncGroup::seen(uint32_t id, uint32_t nowUs) {
+    Member* slot = nullptr;
+    for (Member& member : members) {
+        if (member.id == id) {
+            member.lastSeenUs = nowUs;
+            return;
+        }
+        if (member.id == 0 && !slot) slot = &member;
+    }
+    
+    if (!slot) return;      // Group full; it still works, just isn't a master candidate
+    slot->id = id;
+    slot->lastSeenUs = nowUs;
+    Serial.printf("SyncGroup: Device %08lx joined\n", (unsigned long)id);
+}
+
+void SyncGroup::addClockSample(int32_t sampleOffsetUs, uint32_t rttUs) {
+    samples[nextSample] = {sampleOffsetUs, rttUs};
+    nextSample = (nextSample + 1) % CLOCK_SAMPLES;
+    if (sampleCount < CLOCK_SAMPLES) sampleCount++;
+    stats.clockSamples++;
+    
+    // The quickest round trip had the least room for queueing delay
+    const ClockSample* best = &samples[0];
+    for (uint8_t i = 1; i < sampleCount; i++) {
+        if (samples[i].rttUs < best->rttUs) best = &samples[i];
+    }
+    offsetUs.store(best->offsetUs);
+    stats.bestRttUs = best->rttUs;
+    synced.store(true);
+}
+
+SyncGroup::Scheduled& SyncGroup::schedule(uint32_t origin, uint16_t sequence, const char* vfxName,
+                                          uint32_t duration, uint32_t executeAt) {
+    uint8_t tag = nextScheduled;
+    nextScheduled = (nextScheduled + 1) % MAX_SCHEDULED;
+    
+    Scheduled& entry = scheduled[tag];
+    entry.origin = origin;
+    entry.sequence = sequence;
+    entry.resend = false;
+    strncpy(entry.vfxName, vfxName, sizeof(entry.vfxName));
+    entry.vfxName[MAX_NAME_LENGTH] = '\0';
+    entry.duration = duration;
+    entry.executeAt = executeAt;
+    
+    uint32_t localUs = executeAt - (uint32_t)offsetUs.load();
+    if (!vfxManager.requestTriggerAt(entry.vfxName, duration, localUs, tag)) {
+        Serial.printf("SyncGroup: Can't schedule '%s' from %08lx\n", entry.vfxName, (unsigned long)origin);
+    }
+    return entry;
+}
+
+void SyncGroup::sendTrigger(const Scheduled& entry) {
+    uint8_t nameLength = strlen(entry.vfxName);
+    uint8_t payload[11 + MAX_NAME_LENGTH];
+    writeU16(payload, entry.sequence);
+    writeU32(payload + 2, entry.duration);
+    writeU32(payload + 6, entry.executeAt);
+    payload[10] = nameLength;
+    memcpy(payload + 11, entry.vfxName, nameLength);
+    send(MessageType::TRIGGER, payload, 11 + nameLength);
+}
+
+void SyncGroup::reportRuns() {
+    ScheduledRun run;
+    while (vfxManager.popScheduledRun(run)) {
+        if (run.tag >= MAX_SCHEDULED) continue;
+        const Scheduled& entry = scheduled[run.tag];
+        uint32_t ranAt = toGroupTime(run.executedUs);
+        stats.triggersRun++;
+    
+        uint8_t payload[10];
+        writeU32(payload, entry.origin);
+        writeU16(payload + 4, entry.sequence);
+        writeU32(payload + 6, ranAt);
+        send(MessageType::REPORT, payload, sizeof(payload));
+        recordRun(entry.origin, entry.sequence, ranAt);
+    }
+}
+
+void SyncGroup::recordRun(uint32_t origin, uint16_t sequence, uint32_t ranAt) {
+    if (skew.reports > 0 && (skew.origin != origin || skew.sequence != sequence)) {
+        closeSkewWindow();
+    }
+    
+    if (skew.reports == 0) {
+        skew.origin = origin;
+        skew.sequence = sequence;
+        skew.earliest = ranAt;
+        skew.latest = ranAt;
+        skew.openedUs = micros();
+    } else if ((int32_t)(ranAt - skew.earliest) < 0) {
+        skew.earliest = ranAt;
+    } else if ((int32_t)(ranAt - skew.latest) > 0) {
+        skew.latest = ranAt;
+    }
+    skew.reports++;
+}
+
+void SyncGroup::closeSkewWindow() {
+    if (skew.reports >= 2) {
+        uint32_t spread = skew.latest - skew.earliest;
+        stats.lastSkewUs = spread;
+        if (spread > stats.maxSkewUs) stats.maxSkewUs = spread;
+        stats.avgSkewUs = stats.skewSamples == 0 ? spread
+                        : stats.avgSkewUs - (stats.avgSkewUs >> 3) + (spread >> 3);
+        stats.skewSamples++;
+    }
+    skew.reports = 0;
+}
+
+void SyncGroup::send(MessageType type, const uint8_t* payload, size_t length) {
+    uint8_t message[MAX_MESSAGE_SIZE];
+    message[0] = 'B';
+    message[1] = 'S';
+    message[2] = (uint8_t)type;
+    message[3] = 0;
+    writeU32(message + 4, deviceId);
+    memcpy(message + HEADER_SIZE, payload, length);
+    
+    // Without a transport the group is just this device
+    if (transport && transport->send(message, HEADER_SIZE + length)) {
+        stats.sent++;
+    }
+}
+
+} // namespace BattleAura
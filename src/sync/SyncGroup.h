@@ -0,0 +1,203 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "../core/SpscQueue.h"
+#include "../vfx/VFXManager.h"
+
+namespace BattleAura {
+
+// Sends a datagram to every device in the sync group. The firmware uses UDP
+// multicast (MulticastSyncTransport); the host simulation fans out over
+// localhost ports so several instances can run on one machine.
+class SyncTransport {
+public:
+    virtual ~SyncTransport() = default;
+    virtual bool send(const uint8_t* data, size_t length) = 0;
+};
+
+struct SyncStats {
+    uint32_t received;          // Well-formed messages from other devices
+    uint32_t dropped;           // Malformed; see also getReceiveDropped()
+    uint32_t sent;
+    uint32_t clockSamples;      // Offset measurements against the master
+    uint32_t bestRttUs;         // Round trip of the sample the offset comes from
+    uint32_t triggersSent;      // Started here and fanned out
+    uint32_t triggersRun;       // Run here, from any device
+    uint32_t skewSamples;       // Triggers reported run by two or more devices
+    uint32_t lastSkewUs;        // Spread of the devices' run times, group clock
+    uint32_t maxSkewUs;
+    uint32_t avgSkewUs;         // Smoothed
+};
+
+// Devices on one network form a sync group: each multicasts a beacon, the
+// lowest device ID heard is the clock master, and the others measure their
+// offset to its clock NTP-style (the lowest round trip of recent samples
+// wins). Together that gives a shared group clock.
+//
+// A trigger started on any device goes out with a run time on that clock a
+// little in the future. Every device, the sender included, hands it to
+// VFXManager as a TRIGGER_AT, and nudges its frame edges onto the group
+// clock's frame grid, so all of them run it in the same frame. Each then
+// multicasts when it actually ran; the spread of those times is the skew.
+//
+// Messages are UDP datagrams, little endian, after an 8-byte header of "BS",
+// uint8 MessageType, 0, uint32 sender device ID. Times are µs; "group" ones
+// are on the master's clock:
+//   BEACON         uint32 master as the sender sees it
+//   CLOCK_REQUEST  uint32 master, uint32 t0 (sender's clock)
+//   CLOCK_REPLY    uint32 requester, uint32 t0, uint32 t1, uint32 t2 (group)
+//   TRIGGER        uint16 sequence, uint32 duration ms, uint32 run at (group),
+//                  uint8 name length, name
+//   REPORT         uint32 trigger's origin, uint16 its sequence, uint32 ran at (group)
+//
+// Threads: receive() is the network task's, requestTrigger() the web task's,
+// getFrameCorrectionUs() the render task's; everything else happens in
+// update() on the owning task.
+class SyncGroup {
+public:
+    static const uint16_t PORT = 4211;
+    static const size_t MAX_MESSAGE_SIZE = 48;
+    static const uint8_t MAX_MEMBERS = 8;
+    static const uint8_t MAX_NAME_LENGTH = 24;
+    
+    SyncGroup(VFXManager& vfxManager, uint32_t deviceId);
+    
+    // Until begin() the group is just this device; triggers still run here
+    void begin(SyncTransport& transport);
+    
+    // Network task: queue a datagram, stamped with micros() on arrival
+    void receive(const uint8_t* data, size_t length, uint32_t receivedUs);
+    
+    // Owning task, every few ms: handle received messages, send beacons and
+    // clock samples, fan out requested triggers and report runs
+    void update(uint32_t nowUs);
+    
+    // Web task: run a VFX on every device in the group in the same frame
+    bool requestTrigger(const String& vfxName, uint32_t duration);
+    
+    // Render task: how far to move the next frame deadline (micros()) towards
+    // the group's frame grid. Small steps, so frame pacing stays smooth.
+    int32_t getFrameCorrectionUs(uint32_t nextFrameUs, uint32_t framePeriodUs);
+    
+    // Group clock
+    uint32_t toGroupTime(uint32_t localUs) const { return localUs + (uint32_t)offsetUs.load(); }
+    int32_t getOffsetUs() const { return offsetUs.load(); }
+    bool isSynced() const { return synced.load(); }
+    
+    // Membership
+    uint32_t getDeviceId() const { return deviceId; }
+    uint32_t getMasterId() const { return masterId; }
+    bool isMaster() const { return masterId == deviceId; }
+    uint8_t getMemberCount() const;     // Including this device
+    
+    const SyncStats& getStats() const { return stats; }
+    uint32_t getReceiveDropped() const { return receiveDropped.load(); }   // Wrong size, or the inbox was full
+    void printStatus() const;
+
+private:
+    enum class MessageType : uint8_t {
+        BEACON = 1,         // I am here
+        CLOCK_REQUEST,      // Follower -> master: t0
+        CLOCK_REPLY,        // Master -> follower: t0, t1 (received), t2 (sent)
+        TRIGGER,            // Run a VFX at a group time
+        REPORT              // A trigger ran here at a group time
+    };
+    
+    struct Datagram {
+        uint8_t data[MAX_MESSAGE_SIZE];
+        uint8_t length;
+        uint32_t receivedUs;
+    };
+    
+    struct Member {
+        uint32_t id = 0;            // 0 = free slot
+        uint32_t lastSeenUs = 0;
+    };
+    
+    struct ClockSample {
+        int32_t offsetUs;
+        uint32_t rttUs;
+    };
+    
+    // Triggers this device has scheduled, to drop repeats and to match up
+    // VFXManager's run reports; indexed by the TRIGGER_AT tag
+    struct Scheduled {
+        uint32_t origin = 0;
+        uint16_t sequence = 0;
+        uint32_t resendAtUs = 0;    // Own triggers go out twice in case one is lost
+        bool resend = false;
+        char vfxName[MAX_NAME_LENGTH + 1] = {};
+        uint32_t duration = 0;
+        uint32_t executeAt = 0;     // Group time
+    };
+    
+    struct PendingTrigger {
+        char vfxName[MAX_NAME_LENGTH + 1];
+        uint32_t duration;
+    };
+    
+    // Spread of run reports for the trigger being measured
+    struct SkewWindow {
+        uint32_t origin = 0;
+        uint16_t sequence = 0;
+        uint32_t earliest = 0;
+        uint32_t latest = 0;
+        uint8_t reports = 0;
+        uint32_t openedUs = 0;
+    };
+    
+    static const uint32_t BEACON_INTERVAL_US = 500000;
+    static const uint32_t MEMBER_TIMEOUT_US = 2000000;
+    static const uint32_t CLOCK_INTERVAL_US = 1000000;
+    static const uint32_t CLOCK_FAST_INTERVAL_US = 100000;     // Until the sample window is full
+    static const uint8_t CLOCK_SAMPLES = 8;
+    static const uint32_t TRIGGER_LEAD_US = 150000;            // Time for every device to hear a trigger
+    static const uint32_t TRIGGER_RESEND_US = 30000;
+    static const uint32_t SKEW_WINDOW_US = 1000000;            // Reports later than this are ignored
+    static const uint8_t MAX_SCHEDULED = 8;
+    
+    VFXManager& vfxManager;
+    SyncTransport* transport = nullptr;
+    const uint32_t deviceId;
+    uint32_t masterId;
+    
+    SpscQueue<Datagram, 16> inbox;
+    SpscQueue<PendingTrigger, 4> pendingTriggers;
+    
+    Member members[MAX_MEMBERS];
+    ClockSample samples[CLOCK_SAMPLES];
+    uint8_t sampleCount = 0;
+    uint8_t nextSample = 0;
+    std::atomic<int32_t> offsetUs{0};
+    std::atomic<bool> synced{false};
+    std::atomic<uint32_t> framePeriodUs{20000};   // Latest from the render task
+    
+    Scheduled scheduled[MAX_SCHEDULED];
+    uint8_t nextScheduled = 0;
+    uint16_t triggerSequence = 0;
+    SkewWindow skew;
+    
+    uint32_t lastBeaconUs = 0;
+    uint32_t lastClockRequestUs = 0;
+    SyncStats stats = {};                       // Owning task only
+    std::atomic<uint32_t> receiveDropped{0};    // Receive task only
+    
+    void handleMessage(const Datagram& datagram, uint32_t nowUs);
+    void handleClockReply(const uint8_t* data, uint32_t receivedUs);
+    void handleTrigger(uint32_t origin, const uint8_t* data, size_t length);
+    void handleReport(const uint8_t* data);
+    
+    void updateMembers(uint32_t nowUs);
+    void seen(uint32_t id, uint32_t nowUs);
+    void addClockSample(int32_t sampleOffsetUs, uint32_t rttUs);
+    Scheduled& schedule(uint32_t origin, uint16_t sequence, const char* vfxName, uint32_t duration, uint32_t executeAt);
+    void sendTrigger(const Scheduled& entry);
+    void reportRuns();
+    void recordRun(uint32_t origin, uint16_t sequence, uint32_t ranAt);
+    void closeSkewWindow();
+    
+    void send(MessageType type, const uint8_t* payload, size_t length);
+};
+
+} // namespace BattleAura
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <Arduino.h>
-#include "../hardware/LedController.h"
+#include "Compositor.h"
+#include "VFXMath.h"
+#include "VFXParams.h"
 #include "../config/Configuration.h"
 
 namespace BattleAura {
 
+// Priority doubles as the compositing layer the VFX draws into
 enum class VFXPriority {
     AMBIENT = 0,    // Background VFX (candle flicker, engine idle)
     ACTIVE = 1,     // Player-triggered VFX (weapon fire, engine rev)
@@ -14,39 +17,67 @@ enum class VFXPriority {
 
 class BaseVFX {
 public:
-    BaseVFX(LedController& ledController, Configuration& config, 
+    BaseVFX(Compositor& compositor, Configuration& config, 
             const String& name, VFXPriority priority)
-        : ledController(ledController), config(config), 
-          vfxName(name), priority(priority), enabled(false) {}
+        : layer(compositor.getLayer(static_cast<uint8_t>(priority))), config(config), 
+          vfxName(name), priority(priority), enabled(false) {
+        rng.seed(random(1, 0x7FFFFFFF));
+    }
     
     virtual ~BaseVFX() = default;
     
     // Pure virtual methods - must be implemented by subclasses
+    // update() is called once per frame with the shared frame timestamp (ms)
     virtual void begin() = 0;
-    virtual void update() = 0;
+    virtual void update(uint32_t now) = 0;
     
     // VFX control
-    virtual void setEnabled(bool enabled) { this->enabled = enabled; }
+    // Disabling releases this VFX's zones in its layer so lower layers show
+    virtual void setEnabled(bool enabled) {
+        if (this->enabled && !enabled) {
+            layer.releaseZones(getActiveZones());
+        }
+        this->enabled = enabled;
+    }
     bool isEnabled() const { return enabled; }
     
     // Target zone control
-    void setTargetZones(const std::vector<Zone*>& zones) { targetZones = zones; }
+    // Changing targets re-runs begin() so per-zone state is sized once here
+    // rather than checked on every frame
+    void setTargetZones(const std::vector<Zone*>& zones) {
+        if (useAllZones || zones != targetZones) {
+            layer.releaseZones(getActiveZones());
+        }
+        targetZones = zones;  // Reuses capacity, no allocation once warmed up
+        useAllZones = false;
+        begin();
+    }
     const std::vector<Zone*>& getTargetZones() const { return targetZones; }
+    void reserveZones(size_t count) { targetZones.reserve(count); }
     bool hasTargetZones() const { return !targetZones.empty(); }
     
+    // Zones this VFX renders: its targets once set, otherwise every zone
+    const std::vector<Zone*>& getActiveZones() const {
+        return useAllZones ? config.getAllZones() : targetZones;
+    }
+    
     // VFX metadata
     const String& getName() const { return vfxName; }
     VFXPriority getPriority() const { return priority; }
     
+    // Tunables: the schema lists them, applyParameters() copies a scene's
+    // parameters into the effect. Call begin() afterwards so per-zone state
+    // picks up the new values.
+    const ParamSchema& getParamSchema() const { return *paramSchema; }
+    void applyParameters(JsonVariantConst parameters) {
+        if (paramStorage) paramSchema->apply(parameters, paramStorage);
+    }
+    
     // Duration-based VFX (0 = continuous)
     virtual void trigger(uint32_t duration = 0) {
-        if (duration > 0) {
-            triggerTime = millis();
-            triggerDuration = duration;
-            setEnabled(true);
-        } else {
-            setEnabled(true);
-        }
+        triggerTime = millis();
+        triggerDuration = duration;
+        setEnabled(true);
     }
     
     virtual void stop() {
@@ -54,25 +85,56 @@ public:
         triggerDuration = 0;
     }
     
+    uint32_t getTriggerTime() const { return triggerTime; }
+    
     // Check if timed VFX should stop
-    bool shouldStop() const {
+    bool shouldStop(uint32_t now) const {
         return triggerDuration > 0 && 
-               (millis() - triggerTime >= triggerDuration);
+               elapsedSince(now, triggerTime) >= triggerDuration;
     }
 
 protected:
-    LedController& ledController;
+    // Milliseconds from start to the frame timestamp. Triggers arrive from the
+    // web server between frames, so a start time may be slightly ahead of now.
+    static uint32_t elapsedSince(uint32_t now, uint32_t start) {
+        int32_t elapsed = (int32_t)(now - start);
+        return elapsed > 0 ? (uint32_t)elapsed : 0;
+    }
+    
+    // Frame-rate independent step for a rate given in units per second
+    static uint8_t scaledStep(uint16_t ratePerSecond, uint32_t deltaMs) {
+        uint32_t step = ((uint32_t)ratePerSecond * deltaMs + 500) / 1000;
+        return step > 255 ? 255 : (uint8_t)step;
+    }
+    
+    // Subclasses with tunables bind their Params struct in the constructor;
+    // it starts out at the schema defaults
+    void bindParams(const ParamSchema& schema, void* params) {
+        paramSchema = &schema;
+        paramStorage = params;
+        schema.apply(JsonVariantConst(), params);
+    }
+
+    RenderLayer& layer;
     Configuration& config;
     String vfxName;
     VFXPriority priority;
     bool enabled;
     
-    // Target zones (empty = all zones, for backward compatibility)
+    // Target zones (all zones until targets are set, for backward compatibility)
     std::vector<Zone*> targetZones;
+    bool useAllZones = true;
+    
+    // Per-effect random numbers for the frame path (cheaper than random())
+    VFXMath::Rng rng;
     
     // Duration-based triggering
     uint32_t triggerTime = 0;
     uint32_t triggerDuration = 0;
+    
+private:
+    const ParamSchema* paramSchema = &NO_PARAMS;
+    void* paramStorage = nullptr;
 };
 
 } // namespace BattleAura
\ No newline at end of file
@@ -0,0 +1,412 @@
+#include "Compositor.h"
+
+namespace BattleAura {
+
+namespace {
+
+// a -> b by amount/255
+inline uint8_t mix8(uint8_t a, uint8_t b, uint8_t amount) {
+    return (uint8_t)(a + (((int16_t)b - (int16_t)a) * amount) / 255);
+}
+
+inline CRGB mixColor(CRGB a, CRGB b, uint8_t amount) {
+    return CRGB(mix8(a.r, b.r, amount), mix8(a.g, b.g, amount), mix8(a.b, b.b, amount));
+}
+
+} // namespace
+
+// RenderLayer - thin forwarding to the owning compositor's zone slots
+
+void RenderLayer::setZoneBrightness(uint8_t zoneId, uint8_t brightness) {
+    Compositor::ZoneSlot* slot = compositor->findSlot(zoneId);
+    if (!slot) return;
+
+    Compositor::LayerCell& cell = slot->cells[index];
+    if (cell.covered && !cell.pixelMode && cell.brightness == brightness) return;
+
+    cell.brightness = brightness;
+    cell.covered = true;
+    cell.pixelMode = false;
+    slot->dirty = true;
+}
+
+void RenderLayer::setZoneColor(uint8_t zoneId, CRGB color) {
+    Compositor::ZoneSlot* slot = compositor->findSlot(zoneId);
+    if (!slot || !slot->isStrip) return; // Only WS2812B zones support color
+
+    Compositor::LayerCell& cell = slot->cells[index];
+    if (cell.covered && !cell.pixelMode && cell.color == color) return;
+
+    cell.color = color;
+    cell.covered = true;
+    cell.pixelMode = false;
+    slot->dirty = true;
+}
+
+void RenderLayer::setZoneColorAndBrightness(uint8_t zoneId, CRGB color, uint8_t brightness) {
+    Compositor::ZoneSlot* slot = compositor->findSlot(zoneId);
+    if (!slot) return;
+
+    Compositor::LayerCell& cell = slot->cells[index];
+    if (slot->isStrip) {
+        cell.color = color;
+    }
+    cell.brightness = brightness;
+    cell.covered = true;
+    cell.pixelMode = false;
+    slot->dirty = true;
+}
+
+uint8_t RenderLayer::getZoneBrightness(uint8_t zoneId) const {
+    const Compositor::ZoneSlot* slot = compositor->findSlot(zoneId);
+    if (!slot) return 0;
+
+    const CRGB& out = slot->output;
+    return max(out.r, max(out.g, out.b));
+}
+
+CRGB RenderLayer::getZoneColor(uint8_t zoneId) const {
+    const Compositor::ZoneSlot* slot = compositor->findSlot(zoneId);
+    if (!slot || !slot->isStrip) return CRGB::Black;
+
+    // Output is premultiplied; undo the brightness so color * brightness matches it
+    CRGB color = slot->output;
+    uint8_t brightness = max(color.r, max(color.g, color.b));
+    if (brightness == 0) return CRGB::Black;
+    return CRGB((color.r * 255) / brightness, (color.g * 255) / brightness, (color.b * 255) / brightness);
+}
+
+uint16_t RenderLayer::getZonePixelCount(uint8_t zoneId) const {
+    const Compositor::ZoneSlot* slot = compositor->findSlot(zoneId);
+    return slot ? slot->pixelCount : 0;
+}
+
+void RenderLayer::setPixel(uint8_t zoneId, uint16_t pixel, CRGB color) {
+    Compositor::ZoneSlot* slot;
+    if (!compositor->beginPixelWrite(index, zoneId, slot) || pixel >= slot->pixelCount) return;
+
+    CRGB* pixels = compositor->layerPixels(*slot, index);
+    if (pixels[pixel] != color) {
+        pixels[pixel] = color;
+        slot->dirty = true;
+    }
+}
+
+void RenderLayer::fillPixels(uint8_t zoneId, uint16_t start, uint16_t count, CRGB color) {
+    Compositor::ZoneSlot* slot;
+    if (!compositor->beginPixelWrite(index, zoneId, slot) || start >= slot->pixelCount) return;
+
+    CRGB* pixels = compositor->layerPixels(*slot, index);
+    uint16_t end = min<uint16_t>(start + count, slot->pixelCount);
+    for (uint16_t i = start; i < end; i++) {
+        if (pixels[i] != color) {
+            pixels[i] = color;
+            slot->dirty = true;
+        }
+    }
+}
+
+void RenderLayer::blitPixels(uint8_t zoneId, uint16_t start, const CRGB* colors, uint16_t count) {
+    Compositor::ZoneSlot* slot;
+    if (!colors || !compositor->beginPixelWrite(index, zoneId, slot) || start >= slot->pixelCount) return;
+
+    CRGB* pixels = compositor->layerPixels(*slot, index);
+    uint16_t end = min<uint16_t>(start + count, slot->pixelCount);
+    for (uint16_t i = start; i < end; i++) {
+        if (pixels[i] != colors[i - start]) {
+            pixels[i] = colors[i - start];
+            slot->dirty = true;
+        }
+    }
+}
+
+void RenderLayer::setZoneSmoothing(uint8_t zoneId, uint16_t timeConstantMs) {
+    Compositor::ZoneSlot* slot = compositor->findSlot(zoneId);
+    if (!slot || slot->cells[index].smoothingMs == timeConstantMs) return;
+
+    slot->cells[index].smoothingMs = timeConstantMs;
+    slot->dirty = true;
+}
+
+void RenderLayer::setZoneModulation(uint8_t zoneId, CRGB tint, uint8_t intensity) {
+    Compositor::ZoneSlot* slot = compositor->findSlot(zoneId);
+    if (!slot) return;
+
+    Compositor::LayerCell& cell = slot->cells[index];
+    if (cell.tint == tint && cell.intensity == intensity) return;
+
+    cell.tint = tint;
+    cell.intensity = intensity;
+    cell.modulated = tint != CRGB(CRGB::White) || intensity != 255;
+    slot->dirty = true;
+}
+
+bool RenderLayer::getZoneModulation(uint8_t zoneId, CRGB& tint, uint8_t& intensity) const {
+    const Compositor::ZoneSlot* slot = compositor->findSlot(zoneId);
+    tint = CRGB::White;
+    intensity = 255;
+    if (!slot) return false;
+
+    tint = slot->cells[index].tint;
+    intensity = slot->cells[index].intensity;
+    return true;
+}
+
+void RenderLayer::releaseZone(uint8_t zoneId) {
+    Compositor::ZoneSlot* slot = compositor->findSlot(zoneId);
+    if (!slot || !slot->cells[index].covered) return;
+
+    Compositor::LayerCell& cell = slot->cells[index];
+    cell.covered = false;
+    cell.smoothingMs = 0;
+    cell.tint = CRGB::White;
+    cell.intensity = 255;
+    cell.modulated = false;
+    slot->dirty = true;
+}
+
+void RenderLayer::releaseZones(const std::vector<Zone*>& zones) {
+    for (Zone* zone : zones) {
+        if (zone) releaseZone(zone->id);
+    }
+}
+
+// Compositor
+
+Compositor::Compositor(Configuration& config) : config(config) {
+    memset(slotIndex, NO_SLOT, sizeof(slotIndex));
+    for (uint8_t i = 0; i < LAYER_COUNT; i++) {
+        layers[i].compositor = this;
+        layers[i].index = i;
+    }
+}
+
+void Compositor::begin() {
+    const std::vector<Zone*>& zones = config.getAllZones();
+
+    slots.clear();
+    slots.reserve(zones.size());
+    memset(slotIndex, NO_SLOT, sizeof(slotIndex));
+
+    size_t pixelTotal = 0;
+    uint16_t longestStrip = 0;
+    for (Zone* zone : zones) {
+        if (slots.size() >= NO_SLOT) break;
+
+        ZoneSlot slot = {};
+        slot.zoneId = zone->id;
+        slot.isStrip = zone->type == ZoneType::WS2812B;
+        slot.pixelCount = slot.isStrip ? zone->ledCount : 0;
+        slot.pixelOffset = pixelTotal;
+        for (LayerCell& cell : slot.cells) {
+            cell.color = CRGB::White;  // Matches LedController's default target color
+            cell.tint = CRGB::White;
+            cell.intensity = 255;
+        }
+        slot.output = CRGB::Black;
+        slot.topLayer = NO_LAYER;
+        slot.smoothingMs = 0xFFFF;  // Unknown - sent on the first compose
+        slot.dirty = true;
+
+        pixelTotal += (size_t)slot.pixelCount * LAYER_COUNT;
+        if (slot.pixelCount > longestStrip) longestStrip = slot.pixelCount;
+
+        slotIndex[zone->id] = slots.size();
+        slots.push_back(slot);
+    }
+
+    pixelStore.assign(pixelTotal, CRGB::Black);
+    scratch.assign(longestStrip, CRGB::Black);
+
+    Serial.printf("Compositor: %d zones, %d layer pixels\n", slots.size(), pixelTotal);
+}
+
+RenderLayer& Compositor::getLayer(uint8_t layer) {
+    return layers[layer < LAYER_COUNT ? layer : 0];
+}
+
+void Compositor::setLayerConfig(uint8_t layer, const LayerConfig& layerConfig) {
+    if (layer >= LAYER_COUNT) return;
+
+    config.getDeviceConfig().layers[layer] = layerConfig;
+    for (ZoneSlot& slot : slots) {
+        slot.dirty = true;
+    }
+
+    Serial.printf("Compositor: Layer '%s' blend %s, opacity %d\n",
+                 layerName(layer), blendModeName(layerConfig.blend), layerConfig.opacity);
+}
+
+const LayerConfig& Compositor::getLayerConfig(uint8_t layer) const {
+    return config.getDeviceConfig().layers[layer < LAYER_COUNT ? layer : 0];
+}
+
+void Compositor::compose(LedController& ledController) {
+    const DeviceConfig& deviceConfig = config.getDeviceConfig();
+    const LayerConfig* layerConfigs = deviceConfig.layers;
+
+    for (ZoneSlot& slot : slots) {
+        if (!slot.dirty) continue;
+        slot.dirty = false;
+
+        bool anyPixelLayer = false;
+        uint8_t topLayer = NO_LAYER;
+        for (uint8_t layer = 0; layer < LAYER_COUNT; layer++) {
+            const LayerCell& cell = slot.cells[layer];
+            if (!cell.covered) continue;
+            if (cell.pixelMode) anyPixelLayer = true;
+            topLayer = layer;
+        }
+
+        // Fade when an effect ends or the zone is first drawn (NO_LAYER sorts
+        // above every layer, so both are a drop in the top layer)
+        if (topLayer != slot.topLayer) {
+            if (topLayer < slot.topLayer || topLayer == NO_LAYER) {
+                ledController.startTransition(slot.zoneId, deviceConfig.transitionMs,
+                                              deviceConfig.transitionEasing);
+            }
+            slot.topLayer = topLayer;
+        }
+
+        uint16_t smoothingMs = topLayer != NO_LAYER ? slot.cells[topLayer].smoothingMs : 0;
+        if (smoothingMs != slot.smoothingMs) {
+            ledController.setZoneSmoothing(slot.zoneId, smoothingMs);
+            slot.smoothingMs = smoothingMs;
+        }
+
+        if (!anyPixelLayer) {
+            // Solid zone: one blend per layer
+            CRGB out = CRGB::Black;
+            for (uint8_t layer = 0; layer < LAYER_COUNT; layer++) {
+                const LayerCell& cell = slot.cells[layer];
+                if (cell.covered) {
+                    out = blend(out, solidValue(slot, cell), layerConfigs[layer]);
+                }
+            }
+            slot.output = out;
+
+            // Brightness is already folded into the color, so strips get full
+            // brightness and LedController only applies the user limit
+            if (slot.isStrip) {
+                ledController.setZoneColorAndBrightness(slot.zoneId, out, 255);
+            } else {
+                ledController.setZoneBrightness(slot.zoneId, out.r);
+            }
+            continue;
+        }
+
+        // Strip with at least one pixel layer: blend per pixel
+        CRGB solid[LAYER_COUNT];
+        CRGB* pixels[LAYER_COUNT];
+        for (uint8_t layer = 0; layer < LAYER_COUNT; layer++) {
+            solid[layer] = solidValue(slot, slot.cells[layer]);
+            pixels[layer] = slot.cells[layer].pixelMode ? layerPixels(slot, layer) : nullptr;
+        }
+
+        for (uint16_t i = 0; i < slot.pixelCount; i++) {
+            CRGB out = CRGB::Black;
+            for (uint8_t layer = 0; layer < LAYER_COUNT; layer++) {
+                const LayerCell& cell = slot.cells[layer];
+                if (cell.covered) {
+                    CRGB value = pixels[layer] ? modulate(slot, cell, pixels[layer][i]) : solid[layer];
+                    out = blend(out, value, layerConfigs[layer]);
+                }
+            }
+            scratch[i] = out;
+        }
+        slot.output = slot.pixelCount > 0 ? scratch[0] : CRGB::Black;
+        ledController.blitPixels(slot.zoneId, 0, scratch.data(), slot.pixelCount);
+    }
+}
+
+void Compositor::printStatus() const {
+    Serial.println("=== Compositor Status ===");
+    Serial.printf("Zones: %d\n", slots.size());
+    for (uint8_t layer = 0; layer < LAYER_COUNT; layer++) {
+        const LayerConfig& layerConfig = getLayerConfig(layer);
+        uint8_t covered = 0;
+        for (const ZoneSlot& slot : slots) {
+            if (slot.cells[layer].covered) covered++;
+        }
+        Serial.printf("  Layer '%s': blend %s, opacity %d, %d zones drawn\n",
+                     layerName(layer), blendModeName(layerConfig.blend), layerConfig.opacity, covered);
+    }
+}
+
+// Private methods
+
+Compositor::ZoneSlot* Compositor::findSlot(uint8_t zoneId) {
+    uint8_t index = slotIndex[zoneId];
+    return index != NO_SLOT ? &slots[index] : nullptr;
+}
+
+const Compositor::ZoneSlot* Compositor::findSlot(uint8_t zoneId) const {
+    uint8_t index = slotIndex[zoneId];
+    return index != NO_SLOT ? &slots[index] : nullptr;
+}
+
+CRGB* Compositor::layerPixels(ZoneSlot& slot, uint8_t layer) {
+    return &pixelStore[slot.pixelOffset + (size_t)layer * slot.pixelCount];
+}
+
+Compositor::LayerCell* Compositor::beginPixelWrite(uint8_t layer, uint8_t zoneId, ZoneSlot*& slot) {
+    slot = findSlot(zoneId);
+    if (!slot || slot->pixelCount == 0) return nullptr;
+
+    LayerCell& cell = slot->cells[layer];
+    if (!cell.pixelMode || !cell.covered) {
+        // Entering pixel mode starts from a black strip, as LedController does
+        CRGB* pixels = layerPixels(*slot, layer);
+        for (uint16_t i = 0; i < slot->pixelCount; i++) {
+            pixels[i] = CRGB::Black;
+        }
+        cell.pixelMode = true;
+        cell.covered = true;
+        slot->dirty = true;
+    }
+    return &cell;
+}
+
+CRGB Compositor::solidValue(const ZoneSlot& slot, const LayerCell& cell) const {
+    if (!slot.isStrip) {
+        return modulate(slot, cell, CRGB(cell.brightness, cell.brightness, cell.brightness));
+    }
+    CRGB value = cell.color;
+    value.nscale8(cell.brightness);
+    return modulate(slot, cell, value);
+}
+
+CRGB Compositor::modulate(const ZoneSlot& slot, const LayerCell& cell, CRGB value) const {
+    if (!cell.modulated) return value;
+
+    // A PWM zone is one channel; a tint would only leave its red component
+    if (slot.isStrip) {
+        value = CRGB(scale8(value.r, cell.tint.r), scale8(value.g, cell.tint.g), scale8(value.b, cell.tint.b));
+    }
+    value.nscale8(cell.intensity);
+    return value;
+}
+
+CRGB Compositor::blend(CRGB below, CRGB above, const LayerConfig& layerConfig) const {
+    uint8_t opacity = layerConfig.opacity;
+
+    switch (layerConfig.blend) {
+        case BlendMode::ADD:
+            above.nscale8(opacity);
+            return CRGB(qadd8(below.r, above.r), qadd8(below.g, above.g), qadd8(below.b, above.b));
+
+        case BlendMode::MAX:
+            return mixColor(below, CRGB(max(below.r, above.r), max(below.g, above.g), max(below.b, above.b)),
+                            opacity);
+
+        case BlendMode::MULTIPLY:
+            return mixColor(below, CRGB(scale8(below.r, above.r), scale8(below.g, above.g), scale8(below.b, above.b)),
+                            opacity);
+
+        case BlendMode::REPLACE:
+        default:
+            return mixColor(below, above, opacity);
+    }
+}
+
+} // namespace BattleAura
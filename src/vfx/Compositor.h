@@ -0,0 +1,127 @@
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include <FastLED.h>
+#include "../config/Configuration.h"
+#include "../hardware/LedController.h"
+
+namespace BattleAura {
+
+class Compositor;
+
+// One compositing layer. Effects draw into it with the same calls they would
+// make on LedController. A zone is transparent in a layer until something
+// draws it, and again once it is released.
+class RenderLayer {
+public:
+    // Solid zone writes (same semantics as LedController)
+    void setZoneBrightness(uint8_t zoneId, uint8_t brightness);
+    void setZoneColor(uint8_t zoneId, CRGB color);
+    void setZoneColorAndBrightness(uint8_t zoneId, CRGB color, uint8_t brightness);
+
+    // What the zone currently shows after compositing all layers
+    uint8_t getZoneBrightness(uint8_t zoneId) const;
+    CRGB getZoneColor(uint8_t zoneId) const;
+
+    // Per-pixel writes (WS2812B zones only)
+    uint16_t getZonePixelCount(uint8_t zoneId) const;
+    void setPixel(uint8_t zoneId, uint16_t index, CRGB color);
+    void fillPixels(uint8_t zoneId, uint16_t start, uint16_t count, CRGB color);
+    void blitPixels(uint8_t zoneId, uint16_t start, const CRGB* colors, uint16_t count);
+
+    // Output smoothing for a zone while this layer is the top one drawing it
+    // (first-order time constant, 0 = off). Applied by LedController.
+    void setZoneSmoothing(uint8_t zoneId, uint16_t timeConstantMs);
+
+    // Scale whatever this layer draws in a zone: per-channel tint (strips
+    // only) and intensity. White/255 is off. Kept until the zone is released.
+    void setZoneModulation(uint8_t zoneId, CRGB tint, uint8_t intensity);
+    bool getZoneModulation(uint8_t zoneId, CRGB& tint, uint8_t& intensity) const;
+
+    // Make zones transparent in this layer so the layers below show through
+    void releaseZone(uint8_t zoneId);
+    void releaseZones(const std::vector<Zone*>& zones);
+
+private:
+    friend class Compositor;
+
+    Compositor* compositor = nullptr;
+    uint8_t index = 0;
+};
+
+// Merges the ambient, active and global layers per zone and pushes the result
+// to the LedController. Each layer keeps running underneath the ones above it,
+// so starting or ending a global effect is a change of blend input rather than
+// a disable/re-enable of everything below it.
+//
+// When the top layer of a zone drops (an effect ends) or a zone is first drawn,
+// LedController cross-fades to the new output over DeviceConfig's transition
+// time. An effect starting on a higher layer cuts in at once so flashes and
+// hits stay sharp.
+class Compositor {
+public:
+    Compositor(Configuration& config);
+
+    // Allocate layer buffers for the configured zones. Call again whenever the
+    // configuration's zone generation changes; all layers start transparent.
+    void begin();
+
+    RenderLayer& getLayer(uint8_t layer);
+
+    // Blend settings live in DeviceConfig; setting one recomposites every zone
+    void setLayerConfig(uint8_t layer, const LayerConfig& layerConfig);
+    const LayerConfig& getLayerConfig(uint8_t layer) const;
+
+    // Blend every zone that changed since the last call and write it out
+    void compose(LedController& ledController);
+
+    void printStatus() const;
+
+private:
+    friend class RenderLayer;
+
+    struct LayerCell {
+        CRGB color;             // Solid color (WS2812B zones)
+        uint8_t brightness;     // Solid brightness
+        bool covered;           // Layer has drawn this zone
+        bool pixelMode;         // Layer uses its pixel buffer for this zone
+        uint16_t smoothingMs;   // Output smoothing while this is the top layer
+        CRGB tint;              // Modulation applied on top of what was drawn
+        uint8_t intensity;
+        bool modulated;         // tint or intensity differ from white/255
+    };
+
+    struct ZoneSlot {
+        uint8_t zoneId;
+        bool isStrip;
+        uint16_t pixelCount;    // WS2812B LEDs, 0 for PWM
+        size_t pixelOffset;     // Start of this zone's pixels in pixelStore
+        LayerCell cells[LAYER_COUNT];
+        CRGB output;            // Last composited (solid) value
+        uint8_t topLayer;       // Highest covered layer at the last compose (NO_LAYER if none)
+        uint16_t smoothingMs;   // Smoothing last sent to LedController
+        bool dirty;
+    };
+
+    static const uint8_t NO_SLOT = 0xFF;
+    static const uint8_t NO_LAYER = 0xFF;
+
+    Configuration& config;
+    std::vector<ZoneSlot> slots;
+    std::vector<CRGB> pixelStore;         // LAYER_COUNT buffers per WS2812B zone
+    std::vector<CRGB> scratch;            // Composited strip pixels
+    uint8_t slotIndex[256];               // zoneId -> slot (NO_SLOT if absent)
+    RenderLayer layers[LAYER_COUNT];
+
+    ZoneSlot* findSlot(uint8_t zoneId);
+    const ZoneSlot* findSlot(uint8_t zoneId) const;
+    CRGB* layerPixels(ZoneSlot& slot, uint8_t layer);
+    LayerCell* beginPixelWrite(uint8_t layer, uint8_t zoneId, ZoneSlot*& slot);
+
+    CRGB solidValue(const ZoneSlot& slot, const LayerCell& cell) const;
+    CRGB modulate(const ZoneSlot& slot, const LayerCell& cell, CRGB value) const;
+    CRGB blend(CRGB below, CRGB above, const LayerConfig& layerConfig) const;
+};
+
+} // namespace BattleAura
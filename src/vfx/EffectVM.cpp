@@ -0,0 +1,118 @@
+#include "EffectVM.h"
+
+namespace BattleAura {
+
+namespace {
+
+int32_t readInt32(const uint8_t* data) {
+    return (int32_t)((uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+                     ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24));
+}
+
+uint8_t clamp8(int32_t value) {
+    return value < 0 ? 0 : value > 255 ? 255 : (uint8_t)value;
+}
+
+} // namespace
+
+bool EffectProgram::parse(const uint8_t* data, size_t length, String& error) {
+    clear();
+
+    if (length < HEADER_SIZE || memcmp(data, "BFX1", 4) != 0) {
+        error = "Not an effect program";
+        return false;
+    }
+
+    uint16_t instructionCount = data[4] | ((uint16_t)data[5] << 8);
+    uint16_t constantCount = data[6] | ((uint16_t)data[7] << 8);
+    if (instructionCount == 0 || instructionCount > MAX_INSTRUCTIONS || constantCount > MAX_CONSTANTS) {
+        error = "Program too large";
+        return false;
+    }
+    if (length != HEADER_SIZE + constantCount * 4 + instructionCount * 4) {
+        error = "Truncated program";
+        return false;
+    }
+
+    const uint8_t* constantData = data + HEADER_SIZE;
+    const uint8_t* codeData = constantData + constantCount * 4;
+
+    // Check every instruction before taking any, so run() needs no checks
+    for (uint16_t i = 0; i < instructionCount; i++) {
+        const uint8_t* in = codeData + i * 4;
+        bool valid = in[0] < (uint8_t)EffectOp::COUNT && in[1] >= R && in[1] < REGISTER_COUNT;
+        if ((EffectOp)in[0] == EffectOp::LOADK) {
+            valid = valid && (in[2] | ((uint16_t)in[3] << 8)) < constantCount;
+        } else {
+            valid = valid && in[2] < REGISTER_COUNT && in[3] < REGISTER_COUNT;
+        }
+        if (!valid) {
+            error = String("Invalid instruction ") + String(i);
+            return false;
+        }
+    }
+
+    memcpy(label, data + 8, LABEL_SIZE);
+    label[LABEL_SIZE] = '\0';
+
+    constants.resize(constantCount);
+    for (uint16_t i = 0; i < constantCount; i++) {
+        constants[i] = readInt32(constantData + i * 4);
+    }
+
+    code.resize(instructionCount);
+    memcpy(code.data(), codeData, instructionCount * 4);
+    return true;
+}
+
+void EffectProgram::clear() {
+    label[0] = '\0';
+    constants.clear();
+    code.clear();
+}
+
+void EffectProgram::run(int32_t* reg, VFXMath::Rng& rng) const {
+    for (const EffectInstruction& in : code) {
+        // Arithmetic wraps like the int32 it is, rather than being undefined.
+        // The mask only matters for LOADK, whose a/b are a constant index.
+        uint32_t a = (uint32_t)reg[in.a & (REGISTER_COUNT - 1)];
+        uint32_t b = (uint32_t)reg[in.b & (REGISTER_COUNT - 1)];
+        int32_t& dst = reg[in.dst];
+
+        switch ((EffectOp)in.op) {
+            case EffectOp::LOADK: dst = constants[in.a | (in.b << 8)]; break;
+            case EffectOp::MOV:   dst = (int32_t)a; break;
+            case EffectOp::ADD:   dst = (int32_t)(a + b); break;
+            case EffectOp::SUB:   dst = (int32_t)(a - b); break;
+            case EffectOp::MUL:   dst = (int32_t)(a * b); break;
+            case EffectOp::DIV:
+                dst = b == 0 ? 0 : (int32_t)b == -1 ? (int32_t)(0 - a) : (int32_t)a / (int32_t)b;
+                break;
+            case EffectOp::MOD:
+                dst = (b == 0 || (int32_t)b == -1) ? 0 : (int32_t)a % (int32_t)b;
+                break;
+            case EffectOp::MIN:   dst = min((int32_t)a, (int32_t)b); break;
+            case EffectOp::MAX:   dst = max((int32_t)a, (int32_t)b); break;
+            case EffectOp::LT:    dst = (int32_t)a < (int32_t)b; break;
+            case EffectOp::LE:    dst = (int32_t)a <= (int32_t)b; break;
+            case EffectOp::EQ:    dst = a == b; break;
+            case EffectOp::NE:    dst = a != b; break;
+            case EffectOp::AND:   dst = (int32_t)(a & b); break;
+            case EffectOp::OR:    dst = (int32_t)(a | b); break;
+            case EffectOp::NEG:   dst = (int32_t)(0 - a); break;
+            case EffectOp::NOT:   dst = a == 0; break;
+            case EffectOp::SEL:   dst = dst ? (int32_t)a : (int32_t)b; break;
+            case EffectOp::SIN:   dst = VFXMath::sin8((uint8_t)a); break;
+            case EffectOp::TRI:   dst = VFXMath::triangle8((uint8_t)a); break;
+            case EffectOp::NOISE: dst = VFXMath::noise8(a); break;
+            case EffectOp::RAND:
+                dst = (int32_t)a > 0 ? rng.below(a > 65535 ? 65535 : (uint16_t)a) : 0;
+                break;
+            case EffectOp::EASE:  dst = VFXMath::ease8(clamp8((int32_t)a)); break;
+            case EffectOp::CLAMP: dst = clamp8((int32_t)a); break;
+            case EffectOp::COUNT: break;
+        }
+    }
+}
+
+} // namespace BattleAura
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include "VFXMath.h"
+
+namespace BattleAura {
+
+// Effects uploaded as bytecode instead of built into the firmware. The text
+// language and its compiler live in tools/effect_compiler.py; this is the
+// loader and interpreter.
+//
+// A program is straight-line code over 32 integer registers, run once per
+// pixel with the inputs below loaded and the outputs read back afterwards.
+// There are no jumps, so a program always finishes in exactly size()
+// instructions, and every register and constant index is checked on load.
+
+enum class EffectOp : uint8_t {
+    LOADK,      // dst = constants[a | b << 8]
+    MOV,        // dst = a
+    ADD,
+    SUB,
+    MUL,
+    DIV,        // x / 0 = 0
+    MOD,        // x % 0 = 0
+    MIN,
+    MAX,
+    LT,         // dst = a < b ? 1 : 0
+    LE,
+    EQ,
+    NE,
+    AND,        // Bitwise
+    OR,
+    NEG,        // dst = -a
+    NOT,        // dst = a ? 0 : 1
+    SEL,        // dst = dst ? a : b
+    SIN,        // VFXMath::sin8(a), one turn per 256
+    TRI,        // VFXMath::triangle8(a)
+    NOISE,      // VFXMath::noise8(a), a in 8.8 fixed point
+    RAND,       // 0 <= dst < a
+    EASE,       // VFXMath::ease8() of a clamped to 0..255
+    CLAMP,      // a clamped to 0..255
+    COUNT
+};
+
+struct EffectInstruction {
+    uint8_t op;
+    uint8_t dst;
+    uint8_t a;
+    uint8_t b;
+};
+
+class EffectProgram {
+public:
+    // Register file, shared with the compiler
+    enum Register : uint8_t {
+        T,          // Milliseconds since the effect was triggered
+        I,          // Pixel index in the zone
+        N,          // Pixels in the zone (1 for PWM zones)
+        Z,          // Zone index in the effect's targets
+        D,          // Trigger duration in ms, 0 = continuous
+        P,          // Progress through the duration, 0..255
+        R,          // Outputs: colour, and brightness (PWM zones use only V)
+        G,
+        B,
+        V,
+        FIRST_LOCAL
+    };
+    static const uint8_t REGISTER_COUNT = 32;
+
+    static const uint16_t MAX_INSTRUCTIONS = 256;
+    static const uint16_t MAX_CONSTANTS = 64;
+    static const size_t LABEL_SIZE = 16;
+
+    // File layout (little endian):
+    //   0 "BFX1", 4 uint16 instruction count, 6 uint16 constant count,
+    //   8 char label[16] (NUL padded), 24 int32 constants[], then
+    //   instructions as op, dst, a, b
+    static const size_t HEADER_SIZE = 24;
+    static const size_t MAX_FILE_SIZE = HEADER_SIZE + MAX_CONSTANTS * 4 + MAX_INSTRUCTIONS * 4;
+
+    // Replaces this program; on failure it is left empty and error says why
+    bool parse(const uint8_t* data, size_t length, String& error);
+    void clear();
+
+    bool isLoaded() const { return !code.empty(); }
+    uint16_t size() const { return code.size(); }
+    const char* getLabel() const { return label; }
+
+    // Run once over registers[REGISTER_COUNT]
+    void run(int32_t* registers, VFXMath::Rng& rng) const;
+
+private:
+    char label[LABEL_SIZE + 1] = "";
+    std::vector<int32_t> constants;
+    std::vector<EffectInstruction> code;
+};
+
+} // namespace BattleAura
@@ -2,8 +2,10 @@
 
 namespace BattleAura {
 
-VFXManager::VFXManager(LedController& ledController, AudioController& audioController, Configuration& config)
-    : ledController(ledController), audioController(audioController), config(config) {
+VFXManager::VFXManager(LedController& ledController, AudioController& audioController, Configuration& config,
+                       FrameScheduler* frameScheduler)
+    : ledController(ledController), audioController(audioController), config(config),
+      frameScheduler(frameScheduler), compositor(config), envelopes(config) {
 }
 
 bool VFXManager::begin() {
@@ -11,107 +13,148 @@ bool VFXManager::begin() {
     
     // Clear existing VFX
     vfxInstances.clear();
-    vfxStates.clear();
-    currentGlobalVFX = nullptr;
+    scripts.clear();
+    
+    // Layer buffers for the configured zones
+    compositor.begin();
     
     // Create VFX instances
-    vfxInstances.push_back(std::unique_ptr<BaseVFX>(new CandleVFX(ledController, config)));
-    vfxInstances.push_back(std::unique_ptr<BaseVFX>(new EngineIdleVFX(ledController, config)));
-    vfxInstances.push_back(std::unique_ptr<BaseVFX>(new WeaponFireVFX(ledController, config)));
-    vfxInstances.push_back(std::unique_ptr<BaseVFX>(new DamageVFX(ledController, config)));
-    vfxInstances.push_back(std::unique_ptr<BaseVFX>(new FlamethrowerVFX(ledController, config)));
-    vfxInstances.push_back(std::unique_ptr<BaseVFX>(new EngineRevVFX(ledController, config)));
-    vfxInstances.push_back(std::unique_ptr<BaseVFX>(new DestroyedVFX(ledController, config)));
-    vfxInstances.push_back(std::unique_ptr<BaseVFX>(new RocketLauncherVFX(ledController, config)));
-    vfxInstances.push_back(std::unique_ptr<BaseVFX>(new VictoryVFX(ledController, config)));
-    
-    // Initialize VFX states for priority management
-    vfxStates.resize(vfxInstances.size());
-    for (size_t i = 0; i < vfxInstances.size(); i++) {
-        vfxStates[i].vfx = vfxInstances[i].get();
-        vfxStates[i].wasEnabledBeforeGlobal = false;
-        vfxStates[i].globalStartTime = 0;
+    // Active VFX get a pool so each weapon can fire on its own; ambient and
+    // global VFX cover the model once
+    addVFX<CandleVFX>(1);
+    addVFX<EngineIdleVFX>(1);
+    addVFX<WeaponFireVFX>(ACTIVE_POOL_SIZE);
+    addVFX<DamageVFX>(1);
+    addVFX<FlamethrowerVFX>(ACTIVE_POOL_SIZE);
+    addVFX<EngineRevVFX>(ACTIVE_POOL_SIZE);
+    addVFX<DestroyedVFX>(1);
+    addVFX<RocketLauncherVFX>(ACTIVE_POOL_SIZE);
+    addVFX<VictoryVFX>(ACTIVE_POOL_SIZE);
+    
+    // Uploaded effect programs, pooled like the other active VFX. Each
+    // slot's program is read once and shared by its instances.
+    for (uint8_t slot = 1; slot <= ScriptVFX::SLOT_COUNT; slot++) {
+        std::unique_ptr<EffectProgram>& program = programs[slot - 1];
+        program.reset(new EffectProgram());
+        if (!ScriptVFX::readProgram(slot, *program)) program.reset();
         
-        // Initialize each VFX
-        vfxInstances[i]->begin();
+        for (uint8_t i = 0; i < ACTIVE_POOL_SIZE; i++) {
+            ScriptVFX* script = new ScriptVFX(compositor, config, slot);
+            script->setProgram(program.get());
+            vfxInstances.push_back(std::unique_ptr<BaseVFX>(script));
+            scripts.push_back(script);
+        }
     }
     
+    // Scene IDs for TriggerServer, in getVFXNames() order
+    sceneFirst.clear();
+    for (uint8_t first = 0; first < vfxInstances.size(); first = instanceEnd(first)) {
+        sceneFirst.push_back(first);
+    }
+    
+    // Initialize each VFX with its scene's parameters. begin() on all zones
+    // sizes per-zone state for the whole model, so retargeting an instance
+    // later reuses that storage instead of allocating.
+    for (auto& vfx : vfxInstances) {
+        applySceneParameters(*vfx);
+        vfx->reserveZones(config.getAllZones().size());
+        vfx->begin();
+    }
+    
+    // Loudness envelopes for audio-reactive scenes
+    envelopes.begin();
+    
     // Start default ambient VFX based on configuration
     initializeDefaultVFX();
     
+    // Resolve configured target groups to zones
+    refreshTargetZones();
+    
     Serial.printf("VFXManager: Initialized with %d VFX\n", vfxInstances.size());
     return true;
 }
 
-void VFXManager::update() {
-    // Handle global VFX priority management
-    handleGlobalVFXPriority();
+void VFXManager::update(uint32_t now) {
+    // Commands queued by the web task since the last frame
+    applyCommands();
+    
+    // Re-resolve target zones if zones were added or removed, before anything
+    // draws through the old zone pointers
+    if (config.getZoneGeneration() != resolvedZoneGeneration) {
+        Serial.println("VFXManager: Zones changed, re-resolving VFX targets");
+        compositor.begin();
+        refreshTargetZones();
+    }
+    
+    runScheduled();
+    
+    // Audio that started, finished or was stopped since the last frame
+    handleAudioEvents(now);
     
-    // Check audio timeout
-    if (audioStartTime > 0 && audioTimeoutDuration > 0) {
-        uint32_t elapsed = millis() - audioStartTime;
-        if (elapsed >= audioTimeoutDuration) {
-            Serial.printf("VFXManager: Audio timeout reached for scene '%s' after %dms\n", 
-                         currentAudioScene.c_str(), elapsed);
-            audioController.stop();
-            audioStartTime = 0;
-            audioTimeoutDuration = 0;
-            currentAudioScene = "";
+    // Cut a cue that is still playing at its scene's audio timeout
+    if (cueFile != 0 && cueTimeout > 0) {
+        int32_t elapsed = (int32_t)(now - cueStartTime);
+        if (elapsed >= (int32_t)cueTimeout) {
+            Serial.printf("VFXManager: Audio timeout reached for track %d after %dms\n", cueFile, elapsed);
+            audioController.requestStopCue(AudioSource::RENDER, cueFile);
+            clearCue();
         }
     }
     
-    // Update all active VFX
+    // Timeline cues due this frame, before the effects they trigger draw
+    updateTimelines(now);
+    updateReactive(now);
+    
+    // Update all active VFX. Uploaded programs share one instruction budget.
+    ScriptVFX::resetFrameBudget();
     for (auto& vfx : vfxInstances) {
-        vfx->update();
+        vfx->update(now);
         
         // Auto-disable timed VFX that have completed
-        if (vfx->isEnabled() && vfx->shouldStop()) {
+        if (vfx->isEnabled() && vfx->shouldStop(now)) {
             vfx->stop();
-            Serial.printf("VFXManager: Auto-stopped timed VFX '%s'\n", vfx->getName().c_str());
         }
     }
+    
+    // Lower layers kept running underneath; merge them into the LED state
+    compositor.compose(ledController);
+    
+    // Publish which types are running for the web UI's live state
+    uint32_t enabledMask = 0;
+    uint8_t type = 0;
+    for (uint8_t first = 0; first < vfxInstances.size() && type < 32; first = instanceEnd(first), type++) {
+        for (uint8_t i = first; i < instanceEnd(first); i++) {
+            if (vfxInstances[i]->isEnabled()) {
+                enabledMask |= 1UL << type;
+                break;
+            }
+        }
+    }
+    enabledTypes.store(enabledMask);
 }
 
 bool VFXManager::triggerVFX(const String& vfxName, uint32_t duration) {
-    BaseVFX* vfx = findVFX(vfxName);
-    if (!vfx) {
+    uint8_t index = findVFXIndex(vfxName);
+    if (index == NO_VFX) {
         Serial.printf("VFXManager: VFX '%s' not found\n", vfxName.c_str());
         return false;
     }
     
-    // Get scene configuration to determine target groups
-    const SceneConfig* sceneConfig = config.getSceneConfig(vfxName);
-    if (!sceneConfig) {
-        Serial.printf("VFXManager: No configuration found for VFX '%s', applying to all zones\n", vfxName.c_str());
-        vfx->trigger(duration);
-        return true;
-    }
-    
-    // Get target zones based on configured groups
-    std::vector<Zone*> targetZones = getZonesForGroups(sceneConfig->targetGroups);
-    
-    if (targetZones.empty()) {
-        Serial.printf("VFXManager: No zones found for VFX '%s' target groups\n", vfxName.c_str());
+    return triggerPooled(index, duration, nullptr);
+}
+
+bool VFXManager::triggerVFXOnGroup(const String& vfxName, const String& groupName, uint32_t duration) {
+    uint8_t index = findVFXIndex(vfxName);
+    if (index == NO_VFX) {
+        Serial.printf("VFXManager: VFX '%s' not found\n", vfxName.c_str());
         return false;
     }
     
-    Serial.printf("VFXManager: Triggering VFX '%s' on %d zones for %dms\n", 
-                 vfxName.c_str(), targetZones.size(), duration);
-    
-    // Set target zones for this VFX
-    vfx->setTargetZones(targetZones);
-    vfx->trigger(duration);
-    
-    // Start audio timeout tracking if scene has audio timeout configured
-    if (sceneConfig->audioFile > 0 && sceneConfig->audioTimeout > 0) {
-        audioStartTime = millis();
-        audioTimeoutDuration = sceneConfig->audioTimeout;
-        currentAudioScene = vfxName;
-        Serial.printf("VFXManager: Started audio timeout tracking for scene '%s' (%dms)\n", 
-                     vfxName.c_str(), sceneConfig->audioTimeout);
+    ZoneMask zones;
+    for (Zone* zone : config.getZonesByGroup(groupName)) {
+        zones.add(zone->id);
     }
-    
-    return true;
+    return triggerPooled(index, duration, &zones);
 }
 
 bool VFXManager::enableVFX(const String& vfxName) {
@@ -133,14 +176,195 @@ bool VFXManager::disableVFX(const String& vfxName) {
         return false;
     }
     
-    vfx->setEnabled(false);
+    // Including every pooled instance that is running
+    uint8_t first = findVFXIndex(vfxName);
+    for (uint8_t i = first; i < instanceEnd(first); i++) {
+        vfxInstances[i]->setEnabled(false);
+    }
     Serial.printf("VFXManager: Disabled VFX '%s'\n", vfxName.c_str());
     return true;
 }
 
 bool VFXManager::isVFXEnabled(const String& vfxName) const {
+    uint8_t first = findVFXIndex(vfxName);
+    if (first == NO_VFX) return false;
+    
+    for (uint8_t i = first; i < instanceEnd(first); i++) {
+        if (vfxInstances[i]->isEnabled()) return true;
+    }
+    return false;
+}
+
+bool VFXManager::hasVFX(const String& vfxName) const {
+    return findVFX(vfxName) != nullptr;
+}
+
+bool VFXManager::requestTrigger(const String& vfxName, uint32_t duration, const String& groupName) {
+    uint8_t index = findVFXIndex(vfxName);
+    if (index == NO_VFX) return false;
+    
+    // The group is resolved here so the command carries no strings
+    VFXCommand command = {VFXCommand::Type::TRIGGER, index, 0, 0, duration, 0};
+    if (!groupName.isEmpty()) {
+        auto lock = config.lock();
+        for (Zone* zone : config.getZonesByGroup(groupName)) {
+            command.zones.add(zone->id);
+        }
+        if (command.zones.empty()) return false;
+    }
+    return post(command);
+}
+
+bool VFXManager::requestStop(const String& vfxName) {
+    uint8_t index = findVFXIndex(vfxName);
+    if (index == NO_VFX) return false;
+    return post({VFXCommand::Type::STOP, index, 0, 0, 0, 0});
+}
+
+bool VFXManager::requestStopAll() {
+    return post({VFXCommand::Type::STOP_ALL, NO_VFX, 0, 0, 0, 0});
+}
+
+bool VFXManager::requestEnable(const String& vfxName, bool enabled) {
+    uint8_t index = findVFXIndex(vfxName);
+    if (index == NO_VFX) return false;
+    VFXCommand::Type type = enabled ? VFXCommand::Type::ENABLE : VFXCommand::Type::DISABLE;
+    return post({type, index, 0, 0, 0, 0});
+}
+
+bool VFXManager::requestBrightness(uint8_t zoneId, uint8_t brightness) {
+    return post({VFXCommand::Type::SET_BRIGHTNESS, NO_VFX, zoneId, brightness, 0, 0});
+}
+
+bool VFXManager::requestGlobalBrightness(uint8_t brightness) {
+    return post({VFXCommand::Type::SET_GLOBAL_BRIGHTNESS, NO_VFX, 0, brightness, 0, 0});
+}
+
+bool VFXManager::requestEnvelope(uint16_t fileNumber, const AudioEnvelope& envelope) {
+    VFXCommand command = {VFXCommand::Type::SET_ENVELOPE, NO_VFX, 0, 0, 0, 0, fileNumber};
+    command.envelope = new AudioEnvelope(envelope);
+    return postOwned(command);
+}
+
+bool VFXManager::requestScript(uint8_t slot, const EffectProgram& program) {
+    if (slot < 1 || slot > ScriptVFX::SLOT_COUNT) return false;
+    VFXCommand command = {VFXCommand::Type::SET_SCRIPT, NO_VFX, 0, 0, 0, 0, slot};
+    command.program = new EffectProgram(program);
+    return postOwned(command);
+}
+
+bool VFXManager::requestAddZone(const Zone& zone) {
+    VFXCommand command = {VFXCommand::Type::ADD_ZONE, NO_VFX, zone.id, 0, 0, 0};
+    command.zone = new Zone(zone);
+    return postOwned(command);
+}
+
+bool VFXManager::requestRemoveZone(uint8_t zoneId) {
+    return post({VFXCommand::Type::REMOVE_ZONE, NO_VFX, zoneId, 0, 0, 0});
+}
+
+bool VFXManager::requestClearZones() {
+    return post({VFXCommand::Type::CLEAR_ZONES, NO_VFX, 0, 0, 0, 0});
+}
+
+bool VFXManager::requestSetScene(const SceneConfig& sceneConfig) {
+    VFXCommand command = {VFXCommand::Type::SET_SCENE, findVFXIndex(sceneConfig.name), 0, 0, 0, 0};
+    command.scene = new SceneConfig(sceneConfig);
+    return postOwned(command);
+}
+
+bool VFXManager::requestRemoveScene(const String& sceneName) {
+    VFXCommand command = {VFXCommand::Type::REMOVE_SCENE, findVFXIndex(sceneName), 0, 0, 0, 0};
+    command.scene = new SceneConfig();
+    command.scene->name = sceneName;
+    return postOwned(command);
+}
+
+bool VFXManager::requestFrameRate(uint8_t fps) {
+    return post({VFXCommand::Type::SET_FRAME_RATE, NO_VFX, 0, 0, 0, 0, fps});
+}
+
+bool VFXManager::requestLayerConfig(uint8_t layer, const LayerConfig& layerConfig) {
+    if (layer >= LAYER_COUNT) return false;
+    VFXCommand command = {VFXCommand::Type::SET_LAYER, NO_VFX, layer, 0, 0, 0};
+    command.layer = layerConfig;
+    return post(command);
+}
+
+bool VFXManager::requestTransition(uint16_t transitionMs, Easing easing) {
+    VFXCommand command = {VFXCommand::Type::SET_TRANSITION, NO_VFX, 0, 0, transitionMs, 0};
+    command.easing = easing;
+    return post(command);
+}
+
+bool VFXManager::requestAudioPolicy(const AudioPolicy (&policies)[AUDIO_PRIORITY_COUNT], uint16_t retriggerMs) {
+    VFXCommand command = {VFXCommand::Type::SET_AUDIO_POLICY, NO_VFX, 0, 0, retriggerMs, 0};
+    memcpy(command.audioPolicies, policies, sizeof(command.audioPolicies));
+    return post(command);
+}
+
+bool VFXManager::requestAddAudioTrack(const AudioTrack& track) {
+    VFXCommand command = {VFXCommand::Type::ADD_AUDIO_TRACK, NO_VFX, 0, 0, 0, 0, track.fileNumber};
+    command.track = new AudioTrack(track);
+    return postOwned(command);
+}
+
+bool VFXManager::requestRemoveAudioTrack(uint16_t fileNumber) {
+    return post({VFXCommand::Type::REMOVE_AUDIO_TRACK, NO_VFX, 0, 0, 0, 0, fileNumber});
+}
+
+bool VFXManager::requestFactoryReset() {
+    return post({VFXCommand::Type::FACTORY_RESET, NO_VFX, 0, 0, 0, 0});
+}
+
+bool VFXManager::requestTriggerById(uint8_t sceneId, uint32_t duration) {
+    if (sceneId >= sceneFirst.size()) return false;
+    return post({VFXCommand::Type::TRIGGER, sceneFirst[sceneId], 0, 0, duration, 0}, CommandSource::UDP);
+}
+
+bool VFXManager::requestStopById(uint8_t sceneId) {
+    if (sceneId >= sceneFirst.size()) return false;
+    return post({VFXCommand::Type::STOP, sceneFirst[sceneId], 0, 0, 0, 0}, CommandSource::UDP);
+}
+
+bool VFXManager::requestTriggerAt(const String& vfxName, uint32_t duration, uint32_t executeAtUs, uint16_t tag) {
+    uint8_t index = findVFXIndex(vfxName);
+    if (index == NO_VFX) return false;
+    
+    VFXCommand command = {VFXCommand::Type::TRIGGER_AT, index, 0, 0, duration, 0, tag};
+    command.executeAtUs = executeAtUs;
+    return post(command, CommandSource::SYNC);
+}
+
+bool VFXManager::requestApplyParameters(const String& vfxName) {
+    uint8_t index = findVFXIndex(vfxName);
+    if (index == NO_VFX) return false;
+    return post({VFXCommand::Type::APPLY_PARAMS, index, 0, 0, 0, 0});
+}
+
+const ParamSchema* VFXManager::getParamSchema(const String& vfxName) const {
     const BaseVFX* vfx = findVFX(vfxName);
-    return vfx ? vfx->isEnabled() : false;
+    return vfx ? &vfx->getParamSchema() : nullptr;
+}
+
+bool VFXManager::validateParameters(const String& vfxName, JsonVariantConst parameters, String& error) const {
+    const ParamSchema* schema = getParamSchema(vfxName);
+    if (!schema) {
+        error = "Unknown VFX";
+        return false;
+    }
+    
+    std::vector<uint32_t> scratch((schema->size + 3) / 4);
+    return schema->validate(parameters, scratch.data(), error);
+}
+
+void VFXManager::writeParameterValues(const String& vfxName, JsonVariantConst parameters, JsonObject values) const {
+    const ParamSchema* schema = getParamSchema(vfxName);
+    if (!schema) return;
+    
+    std::vector<uint32_t> scratch((schema->size + 3) / 4);
+    schema->apply(parameters, scratch.data());
+    schema->writeValues(scratch.data(), values);
 }
 
 void VFXManager::enableAmbientVFX() {
@@ -177,8 +401,6 @@ void VFXManager::stopGlobalVFX() {
             vfx->stop();
         }
     }
-    currentGlobalVFX = nullptr;
-    restorePreGlobalVFX();
 }
 
 void VFXManager::stopAllVFX() {
@@ -186,28 +408,53 @@ void VFXManager::stopAllVFX() {
     for (auto& vfx : vfxInstances) {
         vfx->stop();
     }
-    currentGlobalVFX = nullptr;
+    for (TimelineRun& run : timelines) {
+        run.vfxIndex = NO_VFX;
+    }
+    stopReactive();
 }
 
 void VFXManager::printStatus() const {
     Serial.println("=== VFXManager Status ===");
     Serial.printf("Total VFX: %d\n", vfxInstances.size());
-    Serial.printf("Current global VFX: %s\n", currentGlobalVFX ? currentGlobalVFX->getName().c_str() : "None");
     
-    for (const auto& vfx : vfxInstances) {
+    for (uint8_t first = 0; first < vfxInstances.size(); first = instanceEnd(first)) {
+        const BaseVFX* vfx = vfxInstances[first].get();
         String priorityStr = (vfx->getPriority() == VFXPriority::AMBIENT) ? "AMBIENT" :
                             (vfx->getPriority() == VFXPriority::ACTIVE) ? "ACTIVE" : "GLOBAL";
-        Serial.printf("  '%s': %s (%s)\n", 
+        uint8_t running = 0;
+        for (uint8_t i = first; i < instanceEnd(first); i++) {
+            if (vfxInstances[i]->isEnabled()) running++;
+        }
+        Serial.printf("  '%s': %s (%s), %d of %d instances running\n", 
                      vfx->getName().c_str(), 
-                     vfx->isEnabled() ? "ENABLED" : "DISABLED",
-                     priorityStr.c_str());
+                     running > 0 ? "ENABLED" : "DISABLED",
+                     priorityStr.c_str(), running, instanceEnd(first) - first);
+    }
+    
+    Serial.printf("Commands: %lu applied, %lu overflowed, %u pending | Latency: %lu us avg, %lu us max\n",
+                 (unsigned long)commandStats.applied, (unsigned long)commandOverflows.load(),
+                 (unsigned)getPendingCommands(), (unsigned long)commandStats.avgLatencyUs,
+                 (unsigned long)commandStats.maxLatencyUs);
+    Serial.printf("Timelines: %d running, audio start latency %dms\n",
+                 getRunningTimelines(), audioController.getStartLatency());
+    Serial.printf("Envelopes: %d loaded, reactive track %d\n", envelopes.count(), reactiveFile);
+    
+    compositor.printStatus();
+}
+
+uint8_t VFXManager::getRunningTimelines() const {
+    uint8_t running = 0;
+    for (const TimelineRun& run : timelines) {
+        if (run.vfxIndex != NO_VFX) running++;
     }
+    return running;
 }
 
 std::vector<String> VFXManager::getVFXNames() const {
     std::vector<String> names;
-    for (const auto& vfx : vfxInstances) {
-        names.push_back(vfx->getName());
+    for (uint8_t first = 0; first < vfxInstances.size(); first = instanceEnd(first)) {
+        names.push_back(vfxInstances[first]->getName());
     }
     return names;
 }
@@ -232,52 +479,584 @@ const BaseVFX* VFXManager::findVFX(const String& vfxName) const {
     return nullptr;
 }
 
-void VFXManager::handleGlobalVFXPriority() {
-    // Check if any global VFX is active
-    BaseVFX* activeGlobal = nullptr;
-    for (auto& vfx : vfxInstances) {
-        if (vfx->getPriority() == VFXPriority::GLOBAL && vfx->isEnabled()) {
-            activeGlobal = vfx.get();
-            break;
+uint8_t VFXManager::findVFXIndex(const String& vfxName) const {
+    for (size_t i = 0; i < vfxInstances.size(); i++) {
+        if (vfxInstances[i]->getName() == vfxName) {
+            return (uint8_t)i;
         }
     }
+    return NO_VFX;
+}
+
+uint8_t VFXManager::instanceEnd(uint8_t first) const {
+    uint8_t end = first + 1;
+    while (end < vfxInstances.size() && vfxInstances[end]->getName() == vfxInstances[first]->getName()) {
+        end++;
+    }
+    return end;
+}
+
+template <typename T>
+void VFXManager::addVFX(uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        vfxInstances.push_back(std::unique_ptr<BaseVFX>(new T(compositor, config)));
+    }
+}
+
+bool VFXManager::triggerPooled(uint8_t first, uint32_t duration, const ZoneMask* zones) {
+    const String& vfxName = vfxInstances[first]->getName();
+    
+    // Get scene configuration to determine target groups
+    const SceneConfig* sceneConfig = config.getSceneConfig(vfxName);
+    if (!sceneConfig && !zones) {
+        vfxInstances[first]->trigger(duration);
+        return true;
+    }
+    
+    // Zones asked for by the trigger, otherwise the scene's groups
+    const std::vector<Zone*>& targetZones = zones ? getZonesInMask(*zones)
+                                                  : getZonesForGroups(sceneConfig->targetGroups);
+    
+    if (targetZones.empty()) {
+        return false;
+    }
+    
+    ZoneMask targetMask;
+    for (Zone* zone : targetZones) {
+        targetMask.add(zone->id);
+    }
+    uint8_t index = acquireInstance(first, targetMask, millis());
+    BaseVFX* vfx = vfxInstances[index].get();
+    
+    // Set target zones for this instance
+    vfx->setTargetZones(targetZones);
+    vfx->trigger(duration);
+    
+    if (!sceneConfig) return true;
     
-    // Global VFX started
-    if (activeGlobal && currentGlobalVFX != activeGlobal) {
-        Serial.printf("VFXManager: Global VFX '%s' taking priority\n", activeGlobal->getName().c_str());
+    // Start the scene's audio; its finished event can end the VFX
+    if (sceneConfig->hasAudio()) {
+        const AudioTrack* track = config.getAudioTrack(sceneConfig->audioFile);
+        bool loop = track && track->isLoop;
         
-        // Store current VFX states
-        for (size_t i = 0; i < vfxInstances.size(); i++) {
-            vfxStates[i].wasEnabledBeforeGlobal = vfxInstances[i]->isEnabled();
-            vfxStates[i].globalStartTime = millis();
+        AudioPriority priority = (AudioPriority)vfx->getPriority();
+        if (audioController.requestCue(AudioSource::RENDER, sceneConfig->audioFile, priority, loop)) {
+            cueFile = sceneConfig->audioFile;
+            cueVfx = index;
+            cueEndsVfx = duration == 0 && !loop && vfx->getPriority() != VFXPriority::AMBIENT;
+            cueStartTime = millis();
+            cueTimeout = sceneConfig->audioTimeout;
+        }
+    }
+    
+    if (sceneConfig->hasTimeline()) {
+        startTimeline(index, *sceneConfig);
+    }
+    
+    return true;
+}
+
+uint8_t VFXManager::acquireInstance(uint8_t first, const ZoneMask& zones, uint32_t now) {
+    uint8_t end = instanceEnd(first);
+    auto overlaps = [&zones](const BaseVFX* vfx) {
+        for (Zone* zone : vfx->getActiveZones()) {
+            if (zones.has(zone->id)) return true;
+        }
+        return false;
+    };
+    
+    // A retrigger on zones an instance already covers restarts that instance;
+    // otherwise take a free one, or failing that the longest running
+    uint8_t chosen = NO_VFX;
+    for (uint8_t i = first; i < end && chosen == NO_VFX; i++) {
+        if (vfxInstances[i]->isEnabled() && overlaps(vfxInstances[i].get())) chosen = i;
+    }
+    for (uint8_t i = first; i < end && chosen == NO_VFX; i++) {
+        if (!vfxInstances[i]->isEnabled()) chosen = i;
+    }
+    if (chosen == NO_VFX) {
+        chosen = first;
+        for (uint8_t i = first + 1; i < end; i++) {
+            if (now - vfxInstances[i]->getTriggerTime() > now - vfxInstances[chosen]->getTriggerTime()) chosen = i;
+        }
+    }
+    
+    // Other instances on these zones would draw over the new one
+    for (uint8_t i = first; i < end; i++) {
+        if (i != chosen && vfxInstances[i]->isEnabled() && overlaps(vfxInstances[i].get())) {
+            vfxInstances[i]->stop();
+            stopTimeline(i);
+        }
+    }
+    
+    return chosen;
+}
+
+bool VFXManager::post(VFXCommand command, CommandSource source) {
+    command.enqueuedUs = micros();
+    if (commandQueues[(uint8_t)source].push(command)) {
+        return true;
+    }
+    
+    commandOverflows++;
+    return false;
+}
+
+bool VFXManager::postOwned(VFXCommand command) {
+    if (post(command)) return true;
+    
+    // Never reached the render loop, so it's still ours to free
+    delete command.zone;
+    delete command.scene;
+    delete command.envelope;
+    delete command.program;
+    delete command.track;
+    return false;
+}
+
+void VFXManager::applyCommands() {
+    VFXCommand command;
+    for (uint8_t source = 0; source < SOURCE_COUNT; source++) {
+        while (commandQueues[source].pop(command)) {
+            runCommand(command);
             
-            // Disable non-global VFX
-            if (vfxInstances[i]->getPriority() != VFXPriority::GLOBAL) {
-                vfxInstances[i]->setEnabled(false);
+            uint32_t latencyUs = micros() - command.enqueuedUs;
+            commandStats.applied++;
+            commandStats.lastLatencyUs = latencyUs;
+            commandStats.avgLatencyUs = commandStats.avgLatencyUs - (commandStats.avgLatencyUs >> 4) + (latencyUs >> 4);
+            if (latencyUs > commandStats.maxLatencyUs) {
+                commandStats.maxLatencyUs = latencyUs;
+            }
+            if ((CommandSource)source == CommandSource::UDP) {
+                triggerLatency.record(latencyUs);
+            }
+        }
+    }
+}
+
+size_t VFXManager::getPendingCommands() const {
+    size_t pending = 0;
+    for (const auto& queue : commandQueues) {
+        pending += queue.size();
+    }
+    return pending;
+}
+
+void VFXManager::runCommand(const VFXCommand& command) {
+    BaseVFX* vfx = command.vfxIndex < vfxInstances.size() ? vfxInstances[command.vfxIndex].get() : nullptr;
+    
+    switch (command.type) {
+        case VFXCommand::Type::TRIGGER:
+            if (vfx) triggerPooled(command.vfxIndex, command.duration, command.zones.empty() ? nullptr : &command.zones);
+            break;
+        case VFXCommand::Type::STOP:
+            // Every pooled instance of the VFX
+            if (!vfx) break;
+            for (uint8_t i = command.vfxIndex; i < instanceEnd(command.vfxIndex); i++) {
+                vfxInstances[i]->stop();
+                stopTimeline(i);
+            }
+            break;
+        case VFXCommand::Type::STOP_ALL:
+            stopAllVFX();
+            break;
+        case VFXCommand::Type::ENABLE:
+            if (vfx) vfx->setEnabled(true);
+            break;
+        case VFXCommand::Type::DISABLE:
+            if (vfx) disableVFX(vfx->getName());
+            break;
+        case VFXCommand::Type::SET_BRIGHTNESS:
+            ledController.setUserBrightness(command.zoneId, command.brightness);
+            break;
+        case VFXCommand::Type::SET_GLOBAL_BRIGHTNESS: {
+            // Proportional to each zone's own maximum
+            for (Zone* zone : config.getAllZones()) {
+                ledController.setZoneBrightness(zone->id, (command.brightness * zone->brightness) / 255);
+            }
+            auto lock = config.lock();
+            config.getDeviceConfig().globalBrightness = command.brightness;
+            config.markChanged();
+            break;
+        }
+        case VFXCommand::Type::SET_ENVELOPE:
+            // Parsed by the web task, so this only swaps it in. The running
+            // envelope may be the one replaced.
+            if (command.fileNumber == reactiveFile) stopReactive();
+            envelopes.set(command.fileNumber, std::move(*command.envelope));
+            delete command.envelope;
+            Serial.printf("VFXManager: Swapped in envelope for track %d\n", command.fileNumber);
+            break;
+        case VFXCommand::Type::APPLY_PARAMS:
+            if (vfx) applyInstanceParameters(command.vfxIndex);
+            break;
+        case VFXCommand::Type::SET_SCRIPT:
+            // Parsed by the web task. Running instances draw with the new
+            // program from this frame on, so the old one can go.
+            for (ScriptVFX* script : scripts) {
+                if (script->getSlot() == command.fileNumber) script->setProgram(command.program);
+            }
+            programs[command.fileNumber - 1].reset(command.program);
+            break;
+        case VFXCommand::Type::TRIGGER_AT:
+            // runScheduled() fires it in its frame; with no room left, fire now
+            if (!vfx) break;
+            if (scheduledCount < MAX_SCHEDULED) {
+                scheduled[scheduledCount++] = command;
+                break;
+            }
+            triggerPooled(command.vfxIndex, command.duration, nullptr);
+            scheduledRuns.push({command.fileNumber, micros()});
+            break;
+        case VFXCommand::Type::ADD_ZONE: {
+            // Effects are retargeted by update() once the zone generation moves
+            auto lock = config.lock();
+            if (config.addZone(*command.zone)) {
+                ledController.addZone(*command.zone);
+                config.markChanged();
+            }
+            delete command.zone;
+            break;
+        }
+        case VFXCommand::Type::REMOVE_ZONE: {
+            auto lock = config.lock();
+            if (config.removeZone(command.zoneId)) {
+                ledController.removeZone(command.zoneId);
+                config.markChanged();
             }
+            break;
+        }
+        case VFXCommand::Type::CLEAR_ZONES:
+            clearZones();
+            break;
+        case VFXCommand::Type::SET_SCENE: {
+            auto lock = config.lock();
+            config.addSceneConfig(*command.scene);
+            delete command.scene;
+            config.markChanged();
+            lock.unlock();
+            // Running effects pick up changed parameters without a restart
+            if (vfx) applyInstanceParameters(command.vfxIndex);
+            break;
+        }
+        case VFXCommand::Type::REMOVE_SCENE: {
+            // Timelines look their scene up every frame and end without it
+            auto lock = config.lock();
+            if (config.removeSceneConfig(command.scene->name)) config.markChanged();
+            delete command.scene;
+            lock.unlock();
+            if (vfx) applyInstanceParameters(command.vfxIndex);
+            break;
+        }
+        case VFXCommand::Type::SET_FRAME_RATE: {
+            if (frameScheduler) frameScheduler->setTargetFps(command.fileNumber);
+            auto lock = config.lock();
+            config.getDeviceConfig().frameRate = command.fileNumber;
+            config.markChanged();
+            break;
+        }
+        case VFXCommand::Type::SET_LAYER: {
+            auto lock = config.lock();
+            compositor.setLayerConfig(command.zoneId, command.layer);
+            config.markChanged();
+            break;
+        }
+        case VFXCommand::Type::SET_TRANSITION: {
+            // Read by the compositor whenever an effect ends on a zone
+            auto lock = config.lock();
+            config.getDeviceConfig().transitionMs = command.duration;
+            config.getDeviceConfig().transitionEasing = command.easing;
+            config.markChanged();
+            break;
+        }
+        case VFXCommand::Type::SET_AUDIO_POLICY: {
+            // Read by the audio task's arbiter, under the lock
+            auto lock = config.lock();
+            DeviceConfig& deviceConfig = config.getDeviceConfig();
+            memcpy(deviceConfig.audioPolicies, command.audioPolicies, sizeof(deviceConfig.audioPolicies));
+            deviceConfig.audioRetriggerMs = command.duration;
+            config.markChanged();
+            break;
+        }
+        case VFXCommand::Type::ADD_AUDIO_TRACK: {
+            auto lock = config.lock();
+            config.addAudioTrack(*command.track);
+            delete command.track;
+            config.markChanged();
+            break;
+        }
+        case VFXCommand::Type::REMOVE_AUDIO_TRACK: {
+            auto lock = config.lock();
+            if (config.removeAudioTrack(command.fileNumber)) config.markChanged();
+            break;
+        }
+        case VFXCommand::Type::FACTORY_RESET: {
+            // The defaults have no zones or scenes
+            stopAllVFX();
+            clearZones();
+            auto lock = config.lock();
+            config.factoryReset();
+            config.markChanged();
+            break;
+        }
+    }
+}
+
+void VFXManager::clearZones() {
+    auto lock = config.lock();
+    
+    // Collected first, since each removal rebuilds the list being walked
+    ZoneMask cleared;
+    for (Zone* zone : config.getAllZones()) {
+        cleared.add(zone->id);
+    }
+    for (uint16_t zoneId = 0; zoneId < 256; zoneId++) {
+        if (!cleared.has(zoneId)) continue;
+        ledController.removeZone(zoneId);
+        config.removeZone(zoneId);
+    }
+    config.markChanged();
+}
+
+void VFXManager::runScheduled() {
+    uint32_t nowUs = micros();
+    uint8_t waiting = 0;
+    
+    for (uint8_t i = 0; i < scheduledCount; i++) {
+        if ((int32_t)(nowUs - scheduled[i].executeAtUs) < 0) {
+            scheduled[waiting++] = scheduled[i];
+            continue;
+        }
+        triggerPooled(scheduled[i].vfxIndex, scheduled[i].duration, nullptr);
+        scheduledRuns.push({scheduled[i].fileNumber, nowUs});
+    }
+    scheduledCount = waiting;
+}
+
+void VFXManager::applyInstanceParameters(uint8_t first) {
+    // begin() rebuilds per-zone state from the new values
+    for (uint8_t i = first; i < instanceEnd(first); i++) {
+        applySceneParameters(*vfxInstances[i]);
+        vfxInstances[i]->begin();
+    }
+    Serial.printf("VFXManager: Applied parameters to '%s'\n", vfxInstances[first]->getName().c_str());
+}
+
+void VFXManager::applySceneParameters(BaseVFX& vfx) {
+    // Without a scene config the effect runs on its defaults
+    const SceneConfig* sceneConfig = config.getSceneConfig(vfx.getName());
+    vfx.applyParameters(sceneConfig ? sceneConfig->parameters.as<JsonVariantConst>() : JsonVariantConst());
+}
+
+void VFXManager::handleAudioEvents(uint32_t now) {
+    AudioEvent event;
+    while (audioController.pollEvent(event)) {
+        if (event.type == AudioEvent::Type::STARTED) {
+            startReactive(event.fileNumber, now);
+            continue;
         }
         
-        currentGlobalVFX = activeGlobal;
+        if (event.fileNumber == reactiveFile) stopReactive();
+        
+        if (cueFile == 0 || event.fileNumber != cueFile) continue;
+        
+        if (event.type == AudioEvent::Type::FINISHED && cueEndsVfx && cueVfx < vfxInstances.size()) {
+            BaseVFX* vfx = vfxInstances[cueVfx].get();
+            if (vfx->isEnabled()) {
+                vfx->stop();
+            }
+        }
+        clearCue();
+    }
+}
+
+void VFXManager::clearCue() {
+    cueFile = 0;
+    cueVfx = NO_VFX;
+    cueEndsVfx = false;
+    cueTimeout = 0;
+}
+
+void VFXManager::startTimeline(uint8_t vfxIndex, const SceneConfig& scene) {
+    if (vfxIndex == NO_VFX) return;
+    
+    // A retrigger restarts the scene's timeline in place
+    TimelineRun* slot = nullptr;
+    for (TimelineRun& run : timelines) {
+        if (run.vfxIndex == vfxIndex) {
+            slot = &run;
+            break;
+        }
+        if (!slot && run.vfxIndex == NO_VFX) slot = &run;
+    }
+    if (!slot) {
+        Serial.printf("VFXManager: No free timeline slot for '%s'\n", scene.name.c_str());
+        return;
+    }
+    
+    bool hasAudio = scene.hasAudio();
+    for (const TimelineCue& cue : scene.timeline) {
+        if (cue.isAudio()) hasAudio = true;
     }
     
-    // Global VFX ended
-    if (!activeGlobal && currentGlobalVFX) {
-        Serial.printf("VFXManager: Global VFX '%s' ended, restoring previous VFX\n", 
-                     currentGlobalVFX->getName().c_str());
-        currentGlobalVFX = nullptr;
-        restorePreGlobalVFX();
+    // Only a looping track with a known length gives the loop period
+    const AudioTrack* track = scene.hasAudio() ? config.getAudioTrack(scene.audioFile) : nullptr;
+    
+    slot->vfxIndex = vfxIndex;
+    slot->startTime = millis();
+    slot->visualLead = hasAudio ? audioController.getStartLatency() : 0;
+    slot->loopMs = track && track->isLoop ? track->duration : 0;
+    slot->nextAudio = 0;
+    slot->nextVisual = 0;
+}
+
+void VFXManager::stopTimeline(uint8_t vfxIndex) {
+    for (TimelineRun& run : timelines) {
+        if (run.vfxIndex == vfxIndex) run.vfxIndex = NO_VFX;
     }
 }
 
-void VFXManager::restorePreGlobalVFX() {
-    // Restore VFX that were enabled before global VFX started
-    for (size_t i = 0; i < vfxInstances.size(); i++) {
-        if (vfxInstances[i]->getPriority() != VFXPriority::GLOBAL) {
-            vfxInstances[i]->setEnabled(vfxStates[i].wasEnabledBeforeGlobal);
+void VFXManager::updateTimelines(uint32_t now) {
+    for (TimelineRun& run : timelines) {
+        if (run.vfxIndex == NO_VFX) continue;
+        
+        BaseVFX* vfx = vfxInstances[run.vfxIndex].get();
+        const SceneConfig* scene = config.getSceneConfig(vfx->getName());
+        if (!scene) {
+            run.vfxIndex = NO_VFX;
+            continue;
+        }
+        
+        const std::vector<TimelineCue>& timeline = scene->timeline;
+        int32_t elapsed = (int32_t)(now - run.startTime);
+        
+        while (run.nextAudio < timeline.size()) {
+            const TimelineCue& cue = timeline[run.nextAudio];
+            if (cue.isAudio()) {
+                if (elapsed < (int32_t)cue.atMs) break;
+                runTimelineCue(vfx, *scene, cue);
+            }
+            run.nextAudio++;
+        }
+        
+        while (run.nextVisual < timeline.size()) {
+            const TimelineCue& cue = timeline[run.nextVisual];
+            if (!cue.isAudio()) {
+                if (elapsed < (int32_t)(cue.atMs + run.visualLead)) break;
+                runTimelineCue(vfx, *scene, cue);
+            }
+            run.nextVisual++;
+        }
+        
+        // Cues fired above may have stopped everything
+        if (run.vfxIndex == NO_VFX) continue;
+        
+        if (run.nextAudio >= timeline.size() && run.nextVisual >= timeline.size()) {
+            // Scenes on a looping track go round with it while they run
+            if (run.loopMs > 0 && vfx->isEnabled()) {
+                if (elapsed >= (int32_t)run.loopMs) {
+                    run.startTime += run.loopMs;
+                    run.visualLead = audioController.getStartLatency();
+                    run.nextAudio = 0;
+                    run.nextVisual = 0;
+                }
+            } else {
+                run.vfxIndex = NO_VFX;
+            }
+        }
+    }
+}
+
+void VFXManager::runTimelineCue(BaseVFX* vfx, const SceneConfig& scene, const TimelineCue& cue) {
+    switch (cue.action) {
+        case TimelineCue::Action::AUDIO:
+            audioController.requestCue(AudioSource::RENDER, cue.fileNumber, (AudioPriority)vfx->getPriority());
+            break;
+            
+        case TimelineCue::Action::TRIGGER:
+            // A scene that triggers itself would restart its own timeline forever
+            if (cue.vfxName == scene.name) break;
+            triggerVFX(cue.vfxName, cue.duration);
+            break;
+            
+        case TimelineCue::Action::COLOR:
+        case TimelineCue::Action::INTENSITY: {
+            if (!vfx->isEnabled()) break;
+            
+            // Colour and intensity cues each keep the other's last setting
+            RenderLayer& layer = compositor.getLayer((uint8_t)vfx->getPriority());
+            for (Zone* zone : vfx->getActiveZones()) {
+                CRGB tint;
+                uint8_t intensity;
+                layer.getZoneModulation(zone->id, tint, intensity);
+                if (cue.action == TimelineCue::Action::COLOR) {
+                    tint = CRGB(cue.color);
+                } else {
+                    intensity = cue.intensity;
+                }
+                layer.setZoneModulation(zone->id, tint, intensity);
+            }
+            break;
         }
     }
 }
 
+void VFXManager::startReactive(uint16_t fileNumber, uint32_t now) {
+    // Whatever was playing before has been replaced
+    stopReactive();
+    
+    const AudioEnvelope* envelope = envelopes.get(fileNumber);
+    if (!envelope) return;
+    
+    for (size_t i = 0; i < vfxInstances.size(); i++) {
+        BaseVFX* vfx = vfxInstances[i].get();
+        if (!vfx->isEnabled()) continue;
+        
+        const SceneConfig* scene = config.getSceneConfig(vfx->getName());
+        if (!scene || !scene->audioReactive || scene->audioFile != fileNumber) continue;
+        
+        const AudioTrack* track = config.getAudioTrack(fileNumber);
+        reactiveEnvelope = envelope;
+        reactiveVfx = (uint8_t)i;
+        reactiveFile = fileNumber;
+        reactiveStart = now;
+        reactiveLoop = track && track->isLoop;
+        return;
+    }
+}
+
+void VFXManager::updateReactive(uint32_t now) {
+    if (!reactiveEnvelope) return;
+    
+    BaseVFX* vfx = vfxInstances[reactiveVfx].get();
+    if (!vfx->isEnabled()) {
+        stopReactive();
+        return;
+    }
+    
+    setIntensity(vfx, reactiveEnvelope->levelAt(now - reactiveStart, reactiveLoop));
+}
+
+void VFXManager::stopReactive() {
+    if (reactiveEnvelope && reactiveVfx < vfxInstances.size()) {
+        setIntensity(vfxInstances[reactiveVfx].get(), 255);
+    }
+    reactiveEnvelope = nullptr;
+    reactiveVfx = NO_VFX;
+    reactiveFile = 0;
+}
+
+void VFXManager::setIntensity(BaseVFX* vfx, uint8_t intensity) {
+    // Keeps any tint a timeline cue set
+    RenderLayer& layer = compositor.getLayer((uint8_t)vfx->getPriority());
+    for (Zone* zone : vfx->getActiveZones()) {
+        CRGB tint;
+        uint8_t current;
+        layer.getZoneModulation(zone->id, tint, current);
+        layer.setZoneModulation(zone->id, tint, intensity);
+    }
+}
+
 void VFXManager::initializeDefaultVFX() {
     // Enable default ambient VFX based on configured scene configs
     auto sceneConfigs = config.getAllSceneConfigs();
@@ -286,6 +1065,15 @@ void VFXManager::initializeDefaultVFX() {
         if (sceneConfig->type == SceneType::AMBIENT) {
             // Enable ambient VFX by default
             enableVFX(sceneConfig->name);
+            
+            // Its audio becomes the loop that one-shots return to
+            if (sceneConfig->hasAudio()) {
+                audioController.requestCue(AudioSource::RENDER, sceneConfig->audioFile, AudioPriority::AMBIENT, true);
+            }
+            
+            if (sceneConfig->hasTimeline()) {
+                startTimeline(findVFXIndex(sceneConfig->name), *sceneConfig);
+            }
         }
     }
     
@@ -295,27 +1083,54 @@ void VFXManager::initializeDefaultVFX() {
     }
 }
 
-std::vector<Zone*> VFXManager::getZonesForGroups(const std::vector<String>& groupNames) {
-    std::vector<Zone*> targetZones;
+const std::vector<Zone*>& VFXManager::getZonesForGroups(const std::vector<String>& groupNames) {
+    // Result lives in a reused scratch vector - valid until the next call
+    zoneScratch.clear();
+    
+    // Skips zones that appear in several target groups
+    ZoneMask seen;
     
     for (const String& groupName : groupNames) {
-        auto groupZones = config.getZonesByGroup(groupName);
-        for (Zone* zone : groupZones) {
-            // Avoid duplicates if zone is in multiple target groups
-            bool alreadyAdded = false;
-            for (Zone* existing : targetZones) {
-                if (existing->id == zone->id) {
-                    alreadyAdded = true;
-                    break;
-                }
+        for (Zone* zone : config.getZonesByGroup(groupName)) {
+            if (!seen.has(zone->id)) {
+                seen.add(zone->id);
+                zoneScratch.push_back(zone);
             }
-            if (!alreadyAdded) {
-                targetZones.push_back(zone);
+        }
+    }
+    
+    return zoneScratch;
+}
+
+const std::vector<Zone*>& VFXManager::getZonesInMask(const ZoneMask& zones) {
+    // Same scratch vector as getZonesForGroups()
+    zoneScratch.clear();
+    for (Zone* zone : config.getAllZones()) {
+        if (zones.has(zone->id)) zoneScratch.push_back(zone);
+    }
+    return zoneScratch;
+}
+
+void VFXManager::refreshTargetZones() {
+    for (uint8_t first = 0; first < vfxInstances.size(); first = instanceEnd(first)) {
+        const SceneConfig* sceneConfig = config.getSceneConfig(vfxInstances[first]->getName());
+        
+        for (uint8_t i = first; i < instanceEnd(first); i++) {
+            BaseVFX* vfx = vfxInstances[i].get();
+            
+            // Pooled instances may be running on groups the change removed
+            if (i != first) vfx->stop();
+            vfx->reserveZones(config.getAllZones().size());
+            
+            if (sceneConfig) {
+                vfx->setTargetZones(getZonesForGroups(sceneConfig->targetGroups));
+            } else {
+                vfx->begin(); // Renders all zones - resize per-zone state
             }
         }
     }
     
-    return targetZones;
+    resolvedZoneGeneration = config.getZoneGeneration();
 }
 
 } // namespace BattleAura
\ No newline at end of file
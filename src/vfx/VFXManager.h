@@ -3,7 +3,9 @@
 #include <Arduino.h>
 #include <vector>
 #include <memory>
+#include <atomic>
 #include "BaseVFX.h"
+#include "Compositor.h"
 #include "library/CandleVFX.h"
 #include "library/EngineIdleVFX.h"
 #include "library/WeaponFireVFX.h"
@@ -13,28 +15,186 @@
 #include "library/DestroyedVFX.h"
 #include "library/RocketLauncherVFX.h"
 #include "library/VictoryVFX.h"
+#include "library/ScriptVFX.h"
 #include "../hardware/LedController.h"
 #include "../audio/AudioController.h"
+#include "../audio/AudioEnvelope.h"
 #include "../config/Configuration.h"
+#include "../core/FrameScheduler.h"
+#include "../core/SpscQueue.h"
 
 namespace BattleAura {
 
+// Set of zone IDs small enough to travel in a queued command
+struct ZoneMask {
+    uint32_t bits[256 / 32] = {0};
+    
+    void add(uint8_t zoneId) { bits[zoneId >> 5] |= 1UL << (zoneId & 31); }
+    bool has(uint8_t zoneId) const { return bits[zoneId >> 5] & (1UL << (zoneId & 31)); }
+    bool empty() const {
+        for (uint32_t word : bits) {
+            if (word) return false;
+        }
+        return true;
+    }
+};
+
+// Task that posts a VFX command. Each source gets its own single-producer
+// queue into the render loop.
+enum class CommandSource : uint8_t {
+    WEB = 0,        // Web server handlers
+    UDP = 1,        // Trigger datagrams (TriggerServer)
+    SYNC = 2        // Triggers shared with other devices (SyncGroup)
+};
+
+// Control command queued by another task and applied by the render loop
+struct VFXCommand {
+    enum class Type : uint8_t {
+        TRIGGER,
+        STOP,
+        STOP_ALL,
+        ENABLE,
+        DISABLE,
+        SET_BRIGHTNESS,
+        SET_GLOBAL_BRIGHTNESS,
+        SET_ENVELOPE,
+        APPLY_PARAMS,
+        SET_SCRIPT,
+        TRIGGER_AT,         // TRIGGER held until the first frame at or after executeAtUs
+        ADD_ZONE,
+        REMOVE_ZONE,
+        CLEAR_ZONES,
+        SET_SCENE,          // Add or replace a scene config
+        REMOVE_SCENE,
+        SET_FRAME_RATE,
+        SET_LAYER,
+        SET_TRANSITION,     // duration is the cross-fade in ms
+        SET_AUDIO_POLICY,   // duration is the retrigger window in ms
+        ADD_AUDIO_TRACK,
+        REMOVE_AUDIO_TRACK,
+        FACTORY_RESET
+    };
+    
+    Type type;
+    uint8_t vfxIndex;       // Into the VFX list, which is fixed after begin()
+    uint8_t zoneId;
+    uint8_t brightness;
+    uint32_t duration;
+    uint32_t enqueuedUs;    // micros() when queued, for latency
+    uint16_t fileNumber = 0;    // SET_ENVELOPE, REMOVE_AUDIO_TRACK, the slot for SET_SCRIPT, TRIGGER_AT's tag or SET_FRAME_RATE's FPS
+    ZoneMask zones;             // TRIGGER on these zones instead of the scene's groups
+    uint32_t executeAtUs = 0;   // TRIGGER_AT, in micros()
+    LayerConfig layer;          // SET_LAYER, for the layer in zoneId
+    Easing easing = Easing::LINEAR;                         // SET_TRANSITION
+    AudioPolicy audioPolicies[AUDIO_PRIORITY_COUNT] = {};   // SET_AUDIO_POLICY
+    
+    // Configuration too big to copy through the queue. Allocated by the
+    // posting task and freed by the render loop once applied.
+    Zone* zone = nullptr;           // ADD_ZONE
+    SceneConfig* scene = nullptr;   // SET_SCENE, or just the name for REMOVE_SCENE
+    AudioEnvelope* envelope = nullptr;  // SET_ENVELOPE, already parsed
+    EffectProgram* program = nullptr;   // SET_SCRIPT, likewise
+    AudioTrack* track = nullptr;        // ADD_AUDIO_TRACK
+};
+
+// A TRIGGER_AT that has run, for whoever scheduled it
+struct ScheduledRun {
+    uint16_t tag;
+    uint32_t executedUs;        // micros() in the frame it ran
+};
+
+struct CommandStats {
+    uint32_t applied;           // Commands applied by the render loop
+    uint32_t lastLatencyUs;     // Enqueue to apply time of the most recent command
+    uint32_t avgLatencyUs;      // Smoothed enqueue to apply time
+    uint32_t maxLatencyUs;      // Worst enqueue to apply time seen
+};
+
+// Enqueue to apply times in power-of-two buckets: bucket n counts times
+// under 256 << n us, and the last bucket everything slower
+struct LatencyHistogram {
+    static const uint8_t BUCKET_COUNT = 9;      // Up to 32 ms, then the rest
+    uint32_t buckets[BUCKET_COUNT] = {0};
+    
+    void record(uint32_t latencyUs) {
+        uint8_t bucket = 0;
+        while (bucket < BUCKET_COUNT - 1 && latencyUs >= (256UL << bucket)) {
+            bucket++;
+        }
+        buckets[bucket]++;
+    }
+    // Exclusive upper bound of a bucket, 0 for the last (unbounded) one
+    static uint32_t bucketLimitUs(uint8_t bucket) {
+        return bucket < BUCKET_COUNT - 1 ? 256UL << bucket : 0;
+    }
+};
+
 class VFXManager {
 public:
-    VFXManager(LedController& ledController, AudioController& audioController, Configuration& config);
+    VFXManager(LedController& ledController, AudioController& audioController, Configuration& config,
+               FrameScheduler* frameScheduler = nullptr);
     ~VFXManager() = default;
     
     // Initialization
     bool begin();
     
-    // Main update loop
-    void update();
+    // Main update loop - called once per frame with the shared frame timestamp
+    void update(uint32_t now);
     
     // VFX control by name
     bool triggerVFX(const String& vfxName, uint32_t duration = 0);
+    bool triggerVFXOnGroup(const String& vfxName, const String& groupName, uint32_t duration = 0);
     bool enableVFX(const String& vfxName);
     bool disableVFX(const String& vfxName);
     bool isVFXEnabled(const String& vfxName) const;
+    bool hasVFX(const String& vfxName) const;
+    
+    // Queued control for the web task. Commands are applied at the start of
+    // the next update(), so they never race the render loop. Each returns
+    // false if the VFX is unknown or the queue is full.
+    bool requestTrigger(const String& vfxName, uint32_t duration = 0, const String& groupName = "");
+    bool requestStop(const String& vfxName);
+    bool requestStopAll();
+    bool requestEnable(const String& vfxName, bool enabled);
+    bool requestBrightness(uint8_t zoneId, uint8_t brightness);
+    bool requestGlobalBrightness(uint8_t brightness);
+    bool requestEnvelope(uint16_t fileNumber, const AudioEnvelope& envelope); // After a new envelope file was stored
+    bool requestApplyParameters(const String& vfxName); // After the scene's parameters changed
+    bool requestScript(uint8_t slot, const EffectProgram& program); // After a new effect program was stored
+    
+    // Configuration the render loop reads every frame is changed through the
+    // queue as well, and marked changed once applied so the loop task saves
+    // it off the render task. Global brightness and frame rate are stored too.
+    bool requestAddZone(const Zone& zone);              // Also added to the LedController
+    bool requestRemoveZone(uint8_t zoneId);
+    bool requestClearZones();
+    bool requestSetScene(const SceneConfig& sceneConfig); // Running effects pick up its parameters
+    bool requestRemoveScene(const String& sceneName);
+    bool requestFrameRate(uint8_t fps);
+    bool requestLayerConfig(uint8_t layer, const LayerConfig& layerConfig);
+    bool requestTransition(uint16_t transitionMs, Easing easing);
+    bool requestAudioPolicy(const AudioPolicy (&policies)[AUDIO_PRIORITY_COUNT], uint16_t retriggerMs);
+    bool requestAddAudioTrack(const AudioTrack& track);
+    bool requestRemoveAudioTrack(uint16_t fileNumber);
+    bool requestFactoryReset();                         // Zones are removed from the LedController too
+    
+    // The same by scene ID, the index into getVFXNames(), for TriggerServer.
+    // These post to the UDP queue, so only call them from its task.
+    bool requestTriggerById(uint8_t sceneId, uint32_t duration);
+    bool requestStopById(uint8_t sceneId);
+    uint8_t getSceneCount() const { return sceneFirst.size(); }
+    
+    // Trigger at a given micros(), for SyncGroup: only call from its task.
+    // Each run is reported once through popScheduledRun() with the tag.
+    bool requestTriggerAt(const String& vfxName, uint32_t duration, uint32_t executeAtUs, uint16_t tag);
+    bool popScheduledRun(ScheduledRun& run) { return scheduledRuns.pop(run); }
+    
+    // Effect tunables for the web task. The schemas are fixed after begin(),
+    // so these never touch the running effects.
+    const ParamSchema* getParamSchema(const String& vfxName) const;
+    bool validateParameters(const String& vfxName, JsonVariantConst parameters, String& error) const;
+    // Values the effect runs with for the given scene parameters, defaults filled in
+    void writeParameterValues(const String& vfxName, JsonVariantConst parameters, JsonObject values) const;
     
     // VFX control by type
     void enableAmbientVFX();
@@ -43,39 +203,127 @@ public:
     void stopGlobalVFX();
     void stopAllVFX();
     
+    // Layer compositing (ambient, active, global)
+    Compositor& getCompositor() { return compositor; }
+    
     // Status and debugging
     void printStatus() const;
     std::vector<String> getVFXNames() const;
+    // Bit n set while getVFXNames()[n] has an instance running; updated at
+    // the end of every frame, so other tasks can poll it cheaply
+    uint32_t getEnabledTypes() const { return enabledTypes.load(); }
+    const CommandStats& getCommandStats() const { return commandStats; }
+    uint32_t getCommandOverflows() const { return commandOverflows.load(); }
+    size_t getPendingCommands() const;
+    const LatencyHistogram& getTriggerLatency() const { return triggerLatency; }
+    uint8_t getRunningTimelines() const;
+    size_t getEnvelopeCount() const { return envelopes.count(); }
     
 private:
+    static const uint8_t NO_VFX = 0xFF;
+    static const size_t COMMAND_QUEUE_SIZE = 32;
+    static const uint8_t MAX_TIMELINES = 4;
+    static const uint8_t ACTIVE_POOL_SIZE = 3;     // Instances per active VFX, e.g. one per weapon
+    
     LedController& ledController;
     AudioController& audioController;
     Configuration& config;
+    FrameScheduler* frameScheduler;     // For SET_FRAME_RATE; nullptr = fixed rate
     
-    // VFX instances
+    // VFX instances. Each VFX has one or more adjacent instances, the first
+    // of which stands for the VFX by name (enable, ambient, parameters).
+    // Triggers take an instance from its pool, so the same VFX can run on
+    // several groups at once, each with its own zones and state.
     std::vector<std::unique_ptr<BaseVFX>> vfxInstances;
     
-    // Priority management
-    struct VFXState {
-        BaseVFX* vfx;
-        bool wasEnabledBeforeGlobal;
-        uint32_t globalStartTime;
-    };
+    // Instances that run uploaded programs, and the program of each slot
+    // they share (index slot - 1; nullptr = empty)
+    std::vector<ScriptVFX*> scripts;
+    std::unique_ptr<EffectProgram> programs[ScriptVFX::SLOT_COUNT];
+    
+    // Each priority draws into its own layer; blended once per frame
+    Compositor compositor;
+    
+    // Zone resolution - target lists are rebuilt only when the config's zones change
+    std::vector<Zone*> zoneScratch;
+    uint32_t resolvedZoneGeneration = 0;
+    
+    // Web, UDP and sync tasks -> render loop commands, one queue per CommandSource
+    static const uint8_t SOURCE_COUNT = 3;
+    SpscQueue<VFXCommand, COMMAND_QUEUE_SIZE> commandQueues[SOURCE_COUNT];
+    std::atomic<uint32_t> commandOverflows{0};
+    CommandStats commandStats = {};
+    LatencyHistogram triggerLatency;    // UDP commands only
+    std::vector<uint8_t> sceneFirst;    // First instance of each VFX type, by scene ID
     
-    std::vector<VFXState> vfxStates;
-    BaseVFX* currentGlobalVFX = nullptr;
+    // TRIGGER_AT commands waiting for their frame, and those that have run
+    static const uint8_t MAX_SCHEDULED = 8;
+    VFXCommand scheduled[MAX_SCHEDULED];
+    uint8_t scheduledCount = 0;
+    SpscQueue<ScheduledRun, 16> scheduledRuns;
+    
+    std::atomic<uint32_t> enabledTypes{0};
+    
+    // Audio cue of the last triggered scene, ended by the player's own
+    // finished/stopped events or by the scene's audio timeout
+    uint16_t cueFile = 0;               // 0 = no cue playing
+    uint8_t cueVfx = NO_VFX;
+    bool cueEndsVfx = false;            // Untimed scene: the VFX lasts as long as its audio
+    uint32_t cueStartTime = 0;
+    uint32_t cueTimeout = 0;            // 0 = play to the end
+    
+    // Scene timelines in progress. Audio cues go out at their time; visual
+    // cues wait as long again as the player takes to start a track, so both
+    // land on the same frame. Scenes are looked up by VFX name every frame
+    // rather than held, since the web task may replace them.
+    struct TimelineRun {
+        uint8_t vfxIndex = NO_VFX;      // NO_VFX = free slot
+        uint32_t startTime = 0;
+        uint32_t visualLead = 0;        // Audio start latency when the scene has audio
+        uint32_t loopMs = 0;            // Restart period for scenes on a looping track (0 = once)
+        uint16_t nextAudio = 0;         // Next cue to check, per kind
+        uint16_t nextVisual = 0;
+    };
+    TimelineRun timelines[MAX_TIMELINES];
     
-    // Audio timeout tracking
-    uint32_t audioStartTime = 0;
-    uint32_t audioTimeoutDuration = 0;
-    String currentAudioScene = "";
+    // Audio-reactive scene following the track that is playing. Timed from
+    // the player's ACK, so the envelope lines up with what is heard.
+    EnvelopeStore envelopes;
+    const AudioEnvelope* reactiveEnvelope = nullptr;   // nullptr = none running
+    uint8_t reactiveVfx = NO_VFX;
+    uint16_t reactiveFile = 0;
+    uint32_t reactiveStart = 0;
+    bool reactiveLoop = false;
     
     // Helper methods
     BaseVFX* findVFX(const String& vfxName);
     const BaseVFX* findVFX(const String& vfxName) const;
-    std::vector<Zone*> getZonesForGroups(const std::vector<String>& groupNames);
-    void handleGlobalVFXPriority();
-    void restorePreGlobalVFX();
+    uint8_t findVFXIndex(const String& vfxName) const;
+    uint8_t instanceEnd(uint8_t first) const;
+    template <typename T> void addVFX(uint8_t count);
+    bool triggerPooled(uint8_t first, uint32_t duration, const ZoneMask* zones);
+    uint8_t acquireInstance(uint8_t first, const ZoneMask& zones, uint32_t now);
+    bool post(VFXCommand command, CommandSource source = CommandSource::WEB);
+    bool postOwned(VFXCommand command);
+    void applyCommands();
+    void runCommand(const VFXCommand& command);
+    void clearZones();      // From the configuration and the LedController
+    void runScheduled();
+    void applyInstanceParameters(uint8_t first);
+    void applySceneParameters(BaseVFX& vfx);
+    void handleAudioEvents(uint32_t now);
+    void clearCue();
+    void startTimeline(uint8_t vfxIndex, const SceneConfig& scene);
+    void stopTimeline(uint8_t vfxIndex);
+    void updateTimelines(uint32_t now);
+    void runTimelineCue(BaseVFX* vfx, const SceneConfig& scene, const TimelineCue& cue);
+    void startReactive(uint16_t fileNumber, uint32_t now);
+    void updateReactive(uint32_t now);
+    void stopReactive();
+    void setIntensity(BaseVFX* vfx, uint8_t intensity);
+    const std::vector<Zone*>& getZonesForGroups(const std::vector<String>& groupNames);
+    const std::vector<Zone*>& getZonesInMask(const ZoneMask& zones);
+    void refreshTargetZones();
     void initializeDefaultVFX();
 };
 
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace BattleAura {
+
+// Integer waveform and random kernels for VFX.
+// Everything here is integer-only, so it stays cheap on cores where double
+// sin() is a software library call. Angles are 16-bit (65536 = one full
+// turn), phases are 32-bit accumulators that wrap for free, and random
+// numbers come from a per-effect xorshift generator instead of random().
+namespace VFXMath {
+
+extern const int16_t SINE_TABLE[256];
+
+// sin() of a 16-bit angle, -32767..32767
+int16_t sin16(uint16_t angle);
+
+// sin() of an 8-bit angle mapped to 0..255 (128 = zero crossing)
+inline uint8_t sin8(uint8_t angle) {
+    return (uint8_t)((SINE_TABLE[angle] >> 8) + 128);
+}
+
+// Triangle wave of an 8-bit angle, 0..254
+inline uint8_t triangle8(uint8_t angle) {
+    return angle < 128 ? angle * 2 : (255 - angle) * 2;
+}
+
+// Smoothstep on 0..255
+inline uint8_t ease8(uint8_t t) {
+    return (uint8_t)((((uint16_t)t * t) >> 8) * (768 - 2 * (uint16_t)t) >> 8);
+}
+
+// 16-bit angle for a value in radians, evaluated at compile time. Also a rate:
+// sin16(elapsed * toAngle(0.01)) is sin(elapsed * 0.01) for elapsed in ms.
+constexpr uint16_t toAngle(double radians) {
+    return (uint16_t)(radians * 65536.0 / 6.283185307179586 + 0.5);
+}
+
+// wave * amplitude / 32768 for a sin16() result
+inline int16_t scaleWave(int16_t wave, int16_t amplitude) {
+    return (int16_t)(((int32_t)wave * amplitude) >> 15);
+}
+
+// Linear ramp from 'from' to 'to' over duration, clamped at both ends.
+// Unlike map() it never overshoots when elapsed runs past duration.
+inline int32_t ramp(uint32_t elapsed, uint32_t duration, int32_t from, int32_t to) {
+    if (duration == 0 || elapsed >= duration) return to;
+    return from + ((to - from) * (int32_t)elapsed) / (int32_t)duration;
+}
+
+// Oscillator phase: a full turn is 2^32 so it wraps without a modulo
+struct Phase {
+    uint32_t value;
+    uint32_t step;      // Advance per millisecond
+
+    // Rate in millihertz (1000 = one turn per second)
+    void setRate(uint32_t milliHz) {
+        step = (uint32_t)(((uint64_t)milliHz << 32) / 1000000);
+    }
+    void advance(uint32_t deltaMs) { value += step * deltaMs; }
+    uint16_t angle() const { return value >> 16; }
+    int16_t sine() const { return sin16(angle()); }
+};
+
+// Integer hash, good enough to decorrelate neighbouring inputs
+inline uint8_t hash8(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352dUL;
+    x ^= x >> 15;
+    x *= 0x846ca68bUL;
+    x ^= x >> 16;
+    return (uint8_t)x;
+}
+
+// Smooth 1D value noise, 0..255. x is in 8.8 fixed point: the output changes
+// direction roughly once per 256 steps of x.
+uint8_t noise8(uint32_t x);
+
+// xorshift32 PRNG. Seeded from random() so the host simulation stays
+// repeatable for a given seed.
+class Rng {
+public:
+    void seed(uint32_t value) { state = value ? value : 0x9E3779B9UL; }
+
+    uint32_t next() {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    // 0 <= result < bound, by multiply rather than modulo
+    uint16_t below(uint16_t bound) { return (uint16_t)(((next() >> 16) * bound) >> 16); }
+
+    // low <= result < high, like random(low, high)
+    int16_t range(int16_t low, int16_t high) { return low + (int16_t)below(high - low); }
+
+    // True with probability perMille / 1000
+    bool chance(uint16_t perMille) { return below(1000) < perMille; }
+
+private:
+    uint32_t state = 0x9E3779B9UL;
+};
+
+} // namespace VFXMath
+
+} // namespace BattleAura
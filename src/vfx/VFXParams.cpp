@@ -0,0 +1,105 @@
+#include "VFXParams.h"
+
+namespace BattleAura {
+
+namespace {
+
+void store(const ParamSpec& spec, void* params, uint32_t value) {
+    uint8_t* field = (uint8_t*)params + spec.offset;
+    switch (spec.type) {
+        case ParamType::U8:  *field = (uint8_t)value; break;
+        case ParamType::U16: *(uint16_t*)field = (uint16_t)value; break;
+        case ParamType::U32: *(uint32_t*)field = value; break;
+    }
+}
+
+uint32_t load(const ParamSpec& spec, const void* params) {
+    const uint8_t* field = (const uint8_t*)params + spec.offset;
+    switch (spec.type) {
+        case ParamType::U8:  return *field;
+        case ParamType::U16: return *(const uint16_t*)field;
+        case ParamType::U32: return *(const uint32_t*)field;
+    }
+    return 0;
+}
+
+const char* typeName(ParamType type) {
+    switch (type) {
+        case ParamType::U16: return "u16";
+        case ParamType::U32: return "u32";
+        default:             return "u8";
+    }
+}
+
+} // namespace
+
+const ParamSchema NO_PARAMS = {nullptr, 0, 0};
+
+const ParamSpec* ParamSchema::find(const char* name) const {
+    for (uint8_t i = 0; i < count; i++) {
+        if (strcmp(specs[i].name, name) == 0) return &specs[i];
+    }
+    return nullptr;
+}
+
+void ParamSchema::apply(JsonVariantConst json, void* params) const {
+    for (uint8_t i = 0; i < count; i++) {
+        const ParamSpec& spec = specs[i];
+        uint32_t value = spec.defaultValue;
+
+        JsonVariantConst item = json[spec.name];
+        if (item.is<long>()) {
+            long requested = item.as<long>();
+            value = requested < (long)spec.minValue ? spec.minValue :
+                    (uint32_t)requested > spec.maxValue ? spec.maxValue : (uint32_t)requested;
+        }
+        store(spec, params, value);
+    }
+}
+
+bool ParamSchema::validate(JsonVariantConst json, void* params, String& error) const {
+    if (!json.isNull() && !json.is<JsonObjectConst>()) {
+        error = "Parameters must be an object";
+        return false;
+    }
+
+    for (JsonPairConst pair : json.as<JsonObjectConst>()) {
+        const ParamSpec* spec = find(pair.key().c_str());
+        if (!spec) {
+            error = String("Unknown parameter '") + pair.key().c_str() + "'";
+            return false;
+        }
+
+        JsonVariantConst item = pair.value();
+        long value = item.as<long>();
+        if (!item.is<long>() || value < (long)spec->minValue || (uint32_t)value > spec->maxValue) {
+            error = String("Parameter '") + spec->name + "' must be " + String(spec->minValue) +
+                    "-" + String(spec->maxValue);
+            return false;
+        }
+    }
+
+    apply(json, params);
+    return true;
+}
+
+void ParamSchema::writeValues(const void* params, JsonObject json) const {
+    for (uint8_t i = 0; i < count; i++) {
+        json[specs[i].name] = load(specs[i], params);
+    }
+}
+
+void ParamSchema::writeSpecs(JsonArray json) const {
+    for (uint8_t i = 0; i < count; i++) {
+        const ParamSpec& spec = specs[i];
+        JsonObject specObj = json.add<JsonObject>();
+        specObj["name"] = spec.name;
+        specObj["type"] = typeName(spec.type);
+        specObj["min"] = spec.minValue;
+        specObj["max"] = spec.maxValue;
+        specObj["default"] = spec.defaultValue;
+        specObj["unit"] = spec.unit;
+    }
+}
+
+} // namespace BattleAura
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <stddef.h>
+
+namespace BattleAura {
+
+enum class ParamType : uint8_t {
+    U8,
+    U16,
+    U32
+};
+
+// One tunable of an effect: where it lives in the effect's Params struct,
+// its range and its default. Scene parameters are copied into the struct
+// when a scene is applied, so effects read plain fields every frame.
+struct ParamSpec {
+    const char* name;           // Key in SceneConfig::parameters
+    ParamType type;
+    uint16_t offset;            // offsetof() in the Params struct
+    uint32_t minValue;
+    uint32_t maxValue;
+    uint32_t defaultValue;
+    const char* unit;           // "ms", "level", "per s", "count"
+};
+
+struct ParamSchema {
+    const ParamSpec* specs;
+    uint8_t count;
+    uint16_t size;              // sizeof() the Params struct
+
+    const ParamSpec* find(const char* name) const;
+
+    // Defaults, then every known key in json, clamped to its range
+    void apply(JsonVariantConst json, void* params) const;
+
+    // Like apply(), but fails on an unknown key, a non-number or a value
+    // out of range - for user input
+    bool validate(JsonVariantConst json, void* params, String& error) const;
+
+    void writeValues(const void* params, JsonObject json) const;
+    void writeSpecs(JsonArray json) const;
+};
+
+// Schema of an effect without tunables
+extern const ParamSchema NO_PARAMS;
+
+} // namespace BattleAura
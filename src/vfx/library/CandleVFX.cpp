@@ -3,15 +3,21 @@
 
 namespace BattleAura {
 
-CandleVFX::CandleVFX(LedController& ledController, Configuration& config) 
-    : BaseVFX(ledController, config, "CandleFlicker", VFXPriority::AMBIENT) {
+const ParamSpec CandleVFX::PARAM_SPECS[] = {
+    {"smoothingMs", ParamType::U16, offsetof(Params, smoothingMs), 0, 2000, 56, "ms"},
+    {"minBrightness", ParamType::U8, offsetof(Params, minBrightness), 0, 255, 40, "level"},
+    {"brightnessVariance", ParamType::U8, offsetof(Params, brightnessVariance), 0, 255, 80, "level"},
+};
+
+const ParamSchema CandleVFX::PARAM_SCHEMA = {PARAM_SPECS, sizeof(PARAM_SPECS) / sizeof(PARAM_SPECS[0]), sizeof(Params)};
+
+CandleVFX::CandleVFX(Compositor& compositor, Configuration& config) 
+    : BaseVFX(compositor, config, "CandleFlicker", VFXPriority::AMBIENT) {
+    bindParams(PARAM_SCHEMA, &params);
 }
 
 void CandleVFX::begin() {
-    Serial.println("CandleFlicker: Initializing...");
-    
-    // Use target zones if set, otherwise fall back to all zones
-    std::vector<Zone*> zones = hasTargetZones() ? getTargetZones() : config.getAllZones();
+    const std::vector<Zone*>& zones = getActiveZones();
     
     // Initialize flicker state for each target zone
     flickerStates.clear();
@@ -20,22 +26,19 @@ void CandleVFX::begin() {
     for (size_t i = 0; i < zones.size(); i++) {
         FlickerState& state = flickerStates[i];
         state.lastUpdate = millis();
-        state.currentBrightness = MIN_BRIGHTNESS;
-        state.baseBrightness = MIN_BRIGHTNESS + random(0, 30);  // Vary base brightness
-        state.flickerPhase = random(0, 628) / 100.0;  // Random starting phase (0-2π)
-        state.flickerSpeed = random(50, 200) / 100.0; // Random speed multiplier
-        state.nextChange = millis() + random(500, 2000); // Change pattern every 0.5-2s
+        state.baseBrightness = qadd8(params.minBrightness, rng.below(30));  // Vary base brightness, up to full
+        state.flicker.value = rng.next();                   // Random starting phases
+        state.microFlicker.value = rng.next();
+        state.drift.value = rng.next();
+        setFlickerRate(state, rng.range(250, 1000));        // 0.25-1 flickers per second
+        state.nextChange = millis() + rng.range(500, 2000); // Change pattern every 0.5-2s
     }
-    
-    Serial.printf("CandleFlicker: Initialized for %d zones (targeting: %s)\n", 
-                 zones.size(), hasTargetZones() ? "configured groups" : "all zones");
 }
 
-void CandleVFX::update() {
+void CandleVFX::update(uint32_t now) {
     if (!enabled) return;
     
-    // Use target zones if set, otherwise fall back to all zones
-    std::vector<Zone*> zones = hasTargetZones() ? getTargetZones() : config.getAllZones();
+    const std::vector<Zone*>& zones = getActiveZones();
     
     // Ensure we have flicker states for current target zones
     if (flickerStates.size() != zones.size()) {
@@ -44,7 +47,7 @@ void CandleVFX::update() {
     
     for (size_t i = 0; i < zones.size(); i++) {
         if (i < flickerStates.size()) {
-            updateFlickerForZone(i, zones[i]);
+            updateFlickerForZone(i, zones[i], now);
         }
     }
 }
@@ -60,69 +63,65 @@ void CandleVFX::setEnabled(bool enabled) {
     }
 }
 
-void CandleVFX::updateFlickerForZone(size_t zoneIndex, Zone* zone) {
+void CandleVFX::setFlickerRate(FlickerState& state, uint16_t milliHz) {
+    state.flicker.setRate(milliHz);
+    state.microFlicker.setRate(milliHz * 73 / 10);
+    state.drift.setRate(milliHz * 2 / 5);
+}
+
+void CandleVFX::updateFlickerForZone(size_t zoneIndex, Zone* zone, uint32_t now) {
     if (!zone || !zone->enabled) return;
     
     FlickerState& state = flickerStates[zoneIndex];
-    uint32_t currentTime = millis();
+    uint32_t deltaMs = elapsedSince(now, state.lastUpdate);
+    state.lastUpdate = now;
     
-    // Only update every UPDATE_INTERVAL ms for smooth animation
-    if (currentTime - state.lastUpdate < UPDATE_INTERVAL) {
-        return;
-    }
-    
-    float deltaTime = (currentTime - state.lastUpdate) / 1000.0; // Time in seconds
-    
-    // Update flicker phase
-    state.flickerPhase += deltaTime * state.flickerSpeed * 3.14159; // Advance phase
+    // Update flicker phases
+    state.flicker.advance(deltaMs);
+    state.microFlicker.advance(deltaMs);
+    state.drift.advance(deltaMs);
     
-    // Generate realistic candle flicker using multiple frequencies
-    float baseWave = sin(state.flickerPhase) * 0.3;                    // Main flicker
-    float microFlicker = sin(state.flickerPhase * 7.3) * 0.15;        // Fast micro-flicker
-    float slowDrift = sin(state.flickerPhase * 0.4) * 0.2;            // Slow drift
+    // Generate realistic candle flicker using multiple frequencies, in 1/256
+    // brightness steps
+    const int32_t variance = params.brightnessVariance * 256;
+    int32_t flicker = VFXMath::scaleWave(state.flicker.sine(), variance * 3 / 10);        // Main flicker
+    flicker += VFXMath::scaleWave(state.microFlicker.sine(), variance * 15 / 100);        // Fast micro-flicker
+    flicker += VFXMath::scaleWave(state.drift.sine(), variance * 2 / 10);                 // Slow drift
     
     // Add some random noise
-    float noise = (random(-100, 100) / 1000.0) * 0.1; // Small random component
-    
-    // Combine all components
-    float flickerAmount = baseWave + microFlicker + slowDrift + noise;
+    flicker += rng.range(-205, 205); // +/-0.8 brightness
     
     // Calculate final brightness
-    float maxBrightness = (float)zone->brightness;
-    float targetBrightness = state.baseBrightness + (flickerAmount * BRIGHTNESS_VARIANCE);
+    int32_t targetBrightness = ((int32_t)state.baseBrightness * 256 + flicker + 128) >> 8;
     
     // Clamp to valid range
-    targetBrightness = max((float)MIN_BRIGHTNESS, min(maxBrightness, targetBrightness));
-    
-    // Smooth interpolation toward target
-    float smoothing = 0.3; // Adjust for responsiveness (0.1 = slow, 0.9 = fast)
-    state.currentBrightness = state.currentBrightness * (1.0 - smoothing) + targetBrightness * smoothing;
+    targetBrightness = max((int32_t)params.minBrightness, min((int32_t)zone->brightness, targetBrightness));
     
     // Occasionally change the base parameters for variety
-    if (currentTime >= state.nextChange) {
-        state.baseBrightness = MIN_BRIGHTNESS + random(0, 40);
-        state.flickerSpeed = random(50, 200) / 100.0;
-        state.nextChange = currentTime + random(1000, 3000);
+    if (now >= state.nextChange) {
+        state.baseBrightness = qadd8(params.minBrightness, rng.below(40));
+        setFlickerRate(state, rng.range(250, 1000));
+        state.nextChange = now + rng.range(1000, 3000);
     }
     
-    // Apply brightness to LED controller - adapt to zone type
-    uint8_t brightness = (uint8_t)round(state.currentBrightness);
+    // Apply brightness to LED controller - adapt to zone type. The output stage
+    // smooths the jumps between frames.
+    uint8_t brightness = (uint8_t)targetBrightness;
+    layer.setZoneSmoothing(zone->id, params.smoothingMs);
     
     if (zone->type == ZoneType::PWM) {
         // PWM zones: just set brightness
-        ledController.setZoneBrightness(zone->id, brightness);
+        layer.setZoneBrightness(zone->id, brightness);
     } else if (zone->type == ZoneType::WS2812B) {
         // RGB zones: set warm flickering candle color with brightness
         // Candle flame colors: orange-yellow with some red variation
         uint8_t red = 255;
-        uint8_t green = map(brightness, 0, 255, 60, 180);  // Varies with flicker
-        uint8_t blue = map(brightness, 0, 255, 0, 30);     // Minimal blue for warmth
+        uint8_t green = 60 + scale8(brightness, 120);  // Varies with flicker
+        uint8_t blue = scale8(brightness, 30);         // Minimal blue for warmth
         
         CRGB candleColor = CRGB(red, green, blue);
-        ledController.setZoneColorAndBrightness(zone->id, candleColor, brightness);
+        layer.setZoneColorAndBrightness(zone->id, candleColor, brightness);
     }
-    
-    state.lastUpdate = currentTime;
 }
 
 
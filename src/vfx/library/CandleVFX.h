@@ -7,11 +7,11 @@ namespace BattleAura {
 
 class CandleVFX : public BaseVFX {
 public:
-    CandleVFX(LedController& ledController, Configuration& config);
+    CandleVFX(Compositor& compositor, Configuration& config);
     
     // BaseVFX implementation
     void begin() override;
-    void update() override;
+    void update(uint32_t now) override;
     void setEnabled(bool enabled) override;
     
 private:
@@ -19,21 +19,28 @@ private:
     // Per-zone flicker state
     struct FlickerState {
         uint32_t lastUpdate;
-        float currentBrightness;    // Use float for smooth interpolation
-        float baseBrightness;       // Base flickering level
-        float flickerPhase;         // Phase for sine wave component
-        float flickerSpeed;         // Random flicker speed
-        uint32_t nextChange;        // When to change flicker pattern
+        uint8_t baseBrightness;         // Base flickering level
+        VFXMath::Phase flicker;         // Main flicker
+        VFXMath::Phase microFlicker;    // Fast micro-flicker
+        VFXMath::Phase drift;           // Slow drift
+        uint32_t nextChange;            // When to change flicker pattern
     };
     
     std::vector<FlickerState> flickerStates;
     
     // VFX parameters - realistic candle flicker
-    static const uint16_t UPDATE_INTERVAL = 20;    // Update every 20ms for smoothness
-    static const uint8_t MIN_BRIGHTNESS = 40;      // Minimum candle brightness
-    static const uint8_t BRIGHTNESS_VARIANCE = 80;  // Maximum flicker range
+    // Set from the scene's parameters; PARAM_SPECS has the ranges and defaults
+    struct Params {
+        uint16_t smoothingMs;        // Output smoothing time constant
+        uint8_t minBrightness;       // Minimum candle brightness
+        uint8_t brightnessVariance;  // Maximum flicker range
+    };
+    Params params;
+    static const ParamSpec PARAM_SPECS[];
+    static const ParamSchema PARAM_SCHEMA;
     
-    void updateFlickerForZone(size_t zoneIndex, Zone* zone);
+    void setFlickerRate(FlickerState& state, uint16_t milliHz);
+    void updateFlickerForZone(size_t zoneIndex, Zone* zone, uint32_t now);
 };
 
 } // namespace BattleAura
\ No newline at end of file
@@ -3,14 +3,20 @@
 
 namespace BattleAura {
 
-DamageVFX::DamageVFX(LedController& ledController, Configuration& config) 
-    : BaseVFX(ledController, config, "Damage", VFXPriority::GLOBAL) {
+const ParamSpec DamageVFX::PARAM_SPECS[] = {
+    {"flickerInterval", ParamType::U16, offsetof(Params, flickerInterval), 2, 2000, 80, "ms"},
+    {"damageBrightness", ParamType::U8, offsetof(Params, damageBrightness), 0, 255, 200, "level"},
+};
+
+const ParamSchema DamageVFX::PARAM_SCHEMA = {PARAM_SPECS, sizeof(PARAM_SPECS) / sizeof(PARAM_SPECS[0]), sizeof(Params)};
+
+DamageVFX::DamageVFX(Compositor& compositor, Configuration& config) 
+    : BaseVFX(compositor, config, "Damage", VFXPriority::GLOBAL) {
+    bindParams(PARAM_SCHEMA, &params);
 }
 
 void DamageVFX::begin() {
-    Serial.println("Damage: Initializing...");
-    
-    std::vector<Zone*> zones = hasTargetZones() ? getTargetZones() : config.getAllZones();
+    const std::vector<Zone*>& zones = getActiveZones();
     damageStates.clear();
     damageStates.resize(zones.size());
     
@@ -22,10 +28,8 @@ void DamageVFX::begin() {
         state.originalBrightness = 0;
         state.originalColor = CRGB::Black;
         state.hasOriginalState = false;
-        state.intensity = 1.0;
+        state.intensity = 255;
     }
-    
-    Serial.printf("Damage: Initialized for %d zones\n", zones.size());
 }
 
 void DamageVFX::trigger(uint32_t duration) {
@@ -33,23 +37,17 @@ void DamageVFX::trigger(uint32_t duration) {
     startDamage();
 }
 
-void DamageVFX::update() {
+void DamageVFX::update(uint32_t now) {
     if (!enabled) return;
     
     // Check if timed VFX should stop
-    if (shouldStop()) {
-        // Restore all zones before stopping
-        std::vector<Zone*> zones = hasTargetZones() ? getTargetZones() : config.getAllZones();
-        for (size_t i = 0; i < zones.size(); i++) {
-            if (i < damageStates.size()) {
-                restoreZone(i, zones[i]);
-            }
-        }
+    // Stopping releases the global layer, so the zones underneath reappear
+    if (shouldStop(now)) {
         stop();
         return;
     }
     
-    std::vector<Zone*> zones = hasTargetZones() ? getTargetZones() : config.getAllZones();
+    const std::vector<Zone*>& zones = getActiveZones();
     
     // Ensure we have damage states for all zones
     if (damageStates.size() != zones.size()) {
@@ -58,7 +56,7 @@ void DamageVFX::update() {
     
     for (size_t i = 0; i < zones.size(); i++) {
         if (i < damageStates.size()) {
-            updateDamageForZone(i, zones[i]);
+            updateDamageForZone(i, zones[i], now);
         }
     }
 }
@@ -67,7 +65,7 @@ void DamageVFX::startDamage() {
     if (!enabled) return;
     
     uint32_t currentTime = millis();
-    std::vector<Zone*> zones = hasTargetZones() ? getTargetZones() : config.getAllZones();
+    const std::vector<Zone*>& zones = getActiveZones();
     
     // Store original states and start damage VFX
     for (size_t i = 0; i < damageStates.size() && i < zones.size(); i++) {
@@ -75,46 +73,45 @@ void DamageVFX::startDamage() {
         Zone* zone = zones[i];
         
         if (zone && zone->enabled) {
-            // Store original state for restoration
-            state.originalBrightness = ledController.getZoneBrightness(zone->id);
-            state.originalColor = ledController.getZoneColor(zone->id);
+            // Snapshot what the zone shows now; dimmed between flashes
+            state.originalBrightness = layer.getZoneBrightness(zone->id);
+            state.originalColor = layer.getZoneColor(zone->id);
             state.hasOriginalState = true;
             
             state.damageStartTime = currentTime;
             state.lastFlicker = currentTime;
-            state.intensity = 1.0; // Start at full intensity
+            state.intensity = 255; // Start at full intensity
         }
     }
 }
 
-void DamageVFX::updateDamageForZone(size_t zoneIndex, Zone* zone) {
+void DamageVFX::updateDamageForZone(size_t zoneIndex, Zone* zone, uint32_t now) {
     if (!zone || !zone->enabled) return;
     
     DamageState& state = damageStates[zoneIndex];
-    uint32_t currentTime = millis();
     
     if (!state.hasOriginalState) return;
     
     // Calculate damage intensity (fades over time)
-    float elapsed = (currentTime - state.damageStartTime) / 1000.0;
-    state.intensity = max(0.0f, 1.0f - (elapsed / ((float)triggerDuration / 1000.0f)));
+    state.intensity = VFXMath::ramp(elapsedSince(now, state.damageStartTime), triggerDuration, 255, 0);
     
     // Damage flicker timing
-    bool shouldFlicker = (currentTime - state.lastFlicker) < (FLICKER_INTERVAL / 2);
-    if (currentTime - state.lastFlicker >= FLICKER_INTERVAL) {
-        state.lastFlicker = currentTime;
+    uint32_t sinceFlicker = elapsedSince(now, state.lastFlicker);
+    bool shouldFlicker = sinceFlicker < (params.flickerInterval / 2);
+    if (sinceFlicker >= params.flickerInterval) {
+        state.lastFlicker = now;
     }
     
     if (zone->type == ZoneType::PWM) {
         // PWM zones: rapid brightness flicker with red intensity
         uint8_t brightness;
         if (shouldFlicker) {
-            brightness = DAMAGE_BRIGHTNESS * state.intensity;
+            brightness = scale8(params.damageBrightness, state.intensity);
             if (brightness > zone->brightness) brightness = zone->brightness;
         } else {
-            brightness = state.originalBrightness * 0.3; // Dimmed between flickers
+            brightness = scale8(state.originalBrightness, 77); // Dimmed to 30% between flickers
         }
-        ledController.setZoneBrightness(zone->id, brightness);
+        layer.setZoneBrightness(zone->id, brightness);
         
     } else if (zone->type == ZoneType::WS2812B) {
         // RGB zones: red damage flashes
@@ -124,33 +121,17 @@ void DamageVFX::updateDamageForZone(size_t zoneIndex, Zone* zone) {
         if (shouldFlicker) {
             // Bright red damage flash
             damageColor = CRGB(255, 50, 0); // Bright red with slight orange
-            brightness = DAMAGE_BRIGHTNESS * state.intensity;
+            brightness = scale8(params.damageBrightness, state.intensity);
             if (brightness > zone->brightness) brightness = zone->brightness;
         } else {
             // Dimmed original color between flashes
             damageColor = state.originalColor;
             damageColor.nscale8(80); // Dim to 30% between flashes
-            brightness = state.originalBrightness * 0.3;
+            brightness = scale8(state.originalBrightness, 77);
         }
         
-        ledController.setZoneColorAndBrightness(zone->id, damageColor, brightness);
-    }
-}
-
-void DamageVFX::restoreZone(size_t zoneIndex, Zone* zone) {
-    if (!zone || zoneIndex >= damageStates.size()) return;
-    
-    DamageState& state = damageStates[zoneIndex];
-    if (!state.hasOriginalState) return;
-    
-    // Restore original state
-    if (zone->type == ZoneType::PWM) {
-        ledController.setZoneBrightness(zone->id, state.originalBrightness);
-    } else if (zone->type == ZoneType::WS2812B) {
-        ledController.setZoneColorAndBrightness(zone->id, state.originalColor, state.originalBrightness);
+        layer.setZoneColorAndBrightness(zone->id, damageColor, brightness);
     }
-    
-    state.hasOriginalState = false;
 }
 
 } // namespace BattleAura
\ No newline at end of file
@@ -7,11 +7,11 @@ namespace BattleAura {
 
 class DamageVFX : public BaseVFX {
 public:
-    DamageVFX(LedController& ledController, Configuration& config);
+    DamageVFX(Compositor& compositor, Configuration& config);
     
     // BaseVFX implementation
     void begin() override;
-    void update() override;
+    void update(uint32_t now) override;
     void trigger(uint32_t duration = 2000) override; // 2s default duration
     
 private:
@@ -22,18 +22,23 @@ private:
         uint8_t originalBrightness;
         CRGB originalColor;
         bool hasOriginalState;
-        float intensity;        // Damage intensity (1.0 = max)
+        uint8_t intensity;      // Damage intensity (255 = max)
     };
     
     std::vector<DamageState> damageStates;
     
     // Damage VFX parameters
-    static const uint16_t FLICKER_INTERVAL = 80;    // Fast damage flicker
-    static const uint8_t DAMAGE_BRIGHTNESS = 200;   // Bright damage flash
+    // Set from the scene's parameters; PARAM_SPECS has the ranges and defaults
+    struct Params {
+        uint16_t flickerInterval;  // Fast damage flicker
+        uint8_t damageBrightness;  // Bright damage flash
+    };
+    Params params;
+    static const ParamSpec PARAM_SPECS[];
+    static const ParamSchema PARAM_SCHEMA;
     
-    void updateDamageForZone(size_t zoneIndex, Zone* zone);
+    void updateDamageForZone(size_t zoneIndex, Zone* zone, uint32_t now);
     void startDamage();
-    void restoreZone(size_t zoneIndex, Zone* zone);
 };
 
 } // namespace BattleAura
\ No newline at end of file
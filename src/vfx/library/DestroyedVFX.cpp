@@ -3,16 +3,29 @@
 
 namespace BattleAura {
 
-DestroyedVFX::DestroyedVFX(LedController& ledController, Configuration& config)
-    : BaseVFX(ledController, config, "Destroyed", VFXPriority::GLOBAL) {
+const ParamSpec DestroyedVFX::PARAM_SPECS[] = {
+    {"explosionInterval", ParamType::U16, offsetof(Params, explosionInterval), 1, 5000, 300, "ms"},
+    {"maxExplosions", ParamType::U8, offsetof(Params, maxExplosions), 0, 50, 5, "count"},
+    {"maxIntensity", ParamType::U8, offsetof(Params, maxIntensity), 0, 255, 255, "level"},
+    {"explosionDecay", ParamType::U16, offsetof(Params, explosionDecay), 0, 2000, 200, "per s"},
+    {"sparkDecay", ParamType::U16, offsetof(Params, sparkDecay), 0, 2000, 100, "per s"},
+    {"explosionPhaseTime", ParamType::U32, offsetof(Params, explosionPhaseTime), 0, 60000, 2000, "ms"},
+    {"firePhaseTime", ParamType::U32, offsetof(Params, firePhaseTime), 0, 60000, 3000, "ms"},
+    {"sparkPhaseTime", ParamType::U32, offsetof(Params, sparkPhaseTime), 0, 60000, 2000, "ms"},
+    {"fadePhaseTime", ParamType::U32, offsetof(Params, fadePhaseTime), 0, 60000, 1000, "ms"},
+};
+
+const ParamSchema DestroyedVFX::PARAM_SCHEMA = {PARAM_SPECS, sizeof(PARAM_SPECS) / sizeof(PARAM_SPECS[0]), sizeof(Params)};
+
+DestroyedVFX::DestroyedVFX(Compositor& compositor, Configuration& config)
+    : BaseVFX(compositor, config, "Destroyed", VFXPriority::GLOBAL) {
+    bindParams(PARAM_SCHEMA, &params);
 }
 
 void DestroyedVFX::begin() {
-    Serial.println("DestroyedVFX: Initializing");
-    
     // Initialize destruction states for all zones
     destructionStates.clear();
-    destructionStates.resize(targetZones.size());
+    destructionStates.resize(getActiveZones().size());
     
     for (auto& state : destructionStates) {
         state.destructionStartTime = 0;
@@ -25,40 +38,34 @@ void DestroyedVFX::begin() {
     }
 }
 
-void DestroyedVFX::update() {
+void DestroyedVFX::update(uint32_t now) {
     if (!enabled) {
         return;
     }
     
-    uint32_t currentTime = millis();
-    
     // Check if duration has expired
-    if (shouldStop()) {
-        Serial.println("DestroyedVFX: Duration expired");
+    if (shouldStop(now)) {
         stop();
         return;
     }
     
     // Update destruction effect for each target zone
-    for (size_t i = 0; i < targetZones.size(); i++) {
-        Zone* zone = targetZones[i];
+    const std::vector<Zone*>& zones = getActiveZones();
+    for (size_t i = 0; i < zones.size(); i++) {
+        Zone* zone = zones[i];
         if (zone && zone->enabled) {
-            updateDestructionForZone(i, zone);
+            updateDestructionForZone(i, zone, now);
         }
     }
 }
 
 void DestroyedVFX::trigger(uint32_t duration) {
-    Serial.printf("DestroyedVFX: Triggered with duration %dms\n", duration);
-    
     BaseVFX::trigger(duration);
     
     startDestruction();
 }
 
 void DestroyedVFX::startDestruction() {
-    Serial.printf("DestroyedVFX: Starting destruction sequence on %d zones\n", targetZones.size());
-    
     uint32_t currentTime = millis();
     
     // Initialize destruction state for each zone with slight randomization
@@ -74,61 +81,55 @@ void DestroyedVFX::startDestruction() {
     }
 }
 
-void DestroyedVFX::updateDestructionForZone(size_t zoneIndex, Zone* zone) {
+void DestroyedVFX::updateDestructionForZone(size_t zoneIndex, Zone* zone, uint32_t now) {
     if (zoneIndex >= destructionStates.size()) return;
     
     auto& state = destructionStates[zoneIndex];
     if (!state.isDestroyed) return;
     
-    uint32_t currentTime = millis();
-    
-    // Update timing
-    if (currentTime - state.lastUpdate < UPDATE_INTERVAL) {
-        return; // Not time for update yet
-    }
-    
-    state.lastUpdate = currentTime;
-    uint32_t elapsed = currentTime - state.destructionStartTime;
+    uint32_t deltaMs = elapsedSince(now, state.lastUpdate);
+    state.lastUpdate = now;
+    uint32_t elapsed = elapsedSince(now, state.destructionStartTime);
     
     // Determine destruction phase based on elapsed time
-    if (elapsed <= EXPLOSION_PHASE_TIME) {
+    if (elapsed <= params.explosionPhaseTime) {
         state.destructionPhase = 0; // Explosions
         
         // Handle explosion timing
-        if (currentTime - state.lastExplosion >= EXPLOSION_INTERVAL && 
-            state.explosionCount < MAX_EXPLOSIONS) {
-            state.lastExplosion = currentTime;
+        if (elapsedSince(now, state.lastExplosion) >= params.explosionInterval && 
+            state.explosionCount < params.maxExplosions) {
+            state.lastExplosion = now;
             state.explosionCount++;
-            state.currentIntensity = MAX_INTENSITY; // Flash to max
+            state.currentIntensity = params.maxIntensity; // Flash to max
         } else {
             // Fade explosion
             if (state.currentIntensity > 0) {
-                state.currentIntensity = max(0, (int)state.currentIntensity - 20);
+                state.currentIntensity = max(0, (int)state.currentIntensity - scaledStep(params.explosionDecay, deltaMs));
             }
         }
         
-    } else if (elapsed <= EXPLOSION_PHASE_TIME + FIRE_PHASE_TIME) {
+    } else if (elapsed <= params.explosionPhaseTime + params.firePhaseTime) {
         state.destructionPhase = 1; // Fire phase
         // Flickering fire effect
-        uint32_t fireElapsed = elapsed - EXPLOSION_PHASE_TIME;
-        float fireIntensity = 0.7 + 0.3 * sin(fireElapsed * 0.01);
-        state.currentIntensity = (uint8_t)(fireIntensity * 200) + random(0, 40);
+        uint32_t fireElapsed = elapsed - params.explosionPhaseTime;
+        int16_t fireWave = VFXMath::scaleWave(VFXMath::sin16(fireElapsed * VFXMath::toAngle(0.01)), 60);
+        state.currentIntensity = 140 + fireWave + rng.below(40);
         
-    } else if (elapsed <= EXPLOSION_PHASE_TIME + FIRE_PHASE_TIME + SPARK_PHASE_TIME) {
+    } else if (elapsed <= params.explosionPhaseTime + params.firePhaseTime + params.sparkPhaseTime) {
         state.destructionPhase = 2; // Sparks phase
-        // Random sparking effect
-        if (random(0, 100) < 20) { // 20% chance of spark
-            state.currentIntensity = random(100, 200);
+        // Random sparking effect - 20% chance per 100ms
+        if (rng.chance(2 * deltaMs)) {
+            state.currentIntensity = rng.range(100, 200);
         } else {
-            state.currentIntensity = max(0, (int)state.currentIntensity - 10);
+            state.currentIntensity = max(0, (int)state.currentIntensity - scaledStep(params.sparkDecay, deltaMs));
         }
         
     } else {
         state.destructionPhase = 3; // Fade phase
-        uint32_t fadeElapsed = elapsed - EXPLOSION_PHASE_TIME - FIRE_PHASE_TIME - SPARK_PHASE_TIME;
-        state.currentIntensity = map(fadeElapsed, 0, FADE_PHASE_TIME, 50, 0);
+        uint32_t fadeElapsed = elapsed - params.explosionPhaseTime - params.firePhaseTime - params.sparkPhaseTime;
+        state.currentIntensity = VFXMath::ramp(fadeElapsed, params.fadePhaseTime, 50, 0);
         
-        if (fadeElapsed >= FADE_PHASE_TIME) {
+        if (fadeElapsed >= params.fadePhaseTime) {
             state.isDestroyed = false; // Effect complete
         }
     }
@@ -136,24 +137,38 @@ void DestroyedVFX::updateDestructionForZone(size_t zoneIndex, Zone* zone) {
     // Apply destruction effect based on zone type
     if (zone->type == ZoneType::PWM) {
         // For PWM zones, directly control brightness
-        ledController.setZoneBrightness(zone->id, state.currentIntensity);
+        layer.setZoneBrightness(zone->id, state.currentIntensity);
     } else if (zone->type == ZoneType::WS2812B) {
         // For RGB zones, use destruction colors
         CRGB destructionColor = getDestructionColor(state.destructionPhase, state.currentIntensity);
-        ledController.setZoneColor(zone->id, destructionColor);
+        uint16_t pixelCount = layer.getZonePixelCount(zone->id);
+        
+        if (state.destructionPhase == 2 && pixelCount > 1) {
+            // Individual sparks pop along the strip over dim embers
+            layer.fillPixels(zone->id, 0, pixelCount, getDestructionColor(3, 40));
+            uint8_t sparkSlots = 1 + pixelCount / 8;
+            for (uint8_t spark = 0; spark < sparkSlots; spark++) {
+                if (rng.chance(3 * deltaMs)) { // 30% per slot per 100ms
+                    layer.setPixel(zone->id, rng.below(pixelCount), 
+                                           getDestructionColor(2, rng.range(150, 256)));
+                }
+            }
+        } else {
+            layer.fillPixels(zone->id, 0, pixelCount, destructionColor);
+        }
     }
 }
 
 uint8_t DestroyedVFX::calculateExplosionIntensity(uint32_t elapsed, uint8_t phase) {
     switch (phase) {
         case 0: // Explosions - bright flashes
-            return (elapsed % EXPLOSION_INTERVAL < 100) ? MAX_INTENSITY : 0;
+            return (elapsed % params.explosionInterval < 100) ? params.maxIntensity : 0;
         case 1: // Fire - flickering
-            return 150 + random(0, 80);
+            return 150 + rng.below(80);
         case 2: // Sparks - random
-            return random(0, 100) < 30 ? random(80, 150) : 20;
+            return rng.below(100) < 30 ? rng.range(80, 150) : 20;
         case 3: // Fade - diminishing
-            return max(0, 50 - (int)(elapsed * 0.1));
+            return max(0, 50 - (int)(elapsed / 10));
         default:
             return 0;
     }
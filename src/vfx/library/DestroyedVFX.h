@@ -7,11 +7,11 @@ namespace BattleAura {
 
 class DestroyedVFX : public BaseVFX {
 public:
-    DestroyedVFX(LedController& ledController, Configuration& config);
+    DestroyedVFX(Compositor& compositor, Configuration& config);
     
     // BaseVFX implementation
     void begin() override;
-    void update() override;
+    void update(uint32_t now) override;
     void trigger(uint32_t duration = 8000) override; // 8s default duration
     
 private:
@@ -29,16 +29,23 @@ private:
     std::vector<DestructionState> destructionStates;
     
     // Destruction parameters
-    static const uint16_t UPDATE_INTERVAL = 100;       // 100ms update rate
-    static const uint16_t EXPLOSION_INTERVAL = 300;    // 300ms between explosions
-    static const uint8_t MAX_EXPLOSIONS = 5;           // Number of initial explosions
-    static const uint8_t MAX_INTENSITY = 255;          // Peak explosion intensity
-    static const uint32_t EXPLOSION_PHASE_TIME = 2000; // 2s of explosions
-    static const uint32_t FIRE_PHASE_TIME = 3000;      // 3s of fire
-    static const uint32_t SPARK_PHASE_TIME = 2000;     // 2s of sparks
-    static const uint32_t FADE_PHASE_TIME = 1000;      // 1s fade out
+    // Set from the scene's parameters; PARAM_SPECS has the ranges and defaults
+    struct Params {
+        uint16_t explosionInterval;   // 300ms between explosions
+        uint8_t maxExplosions;        // Number of initial explosions
+        uint8_t maxIntensity;         // Peak explosion intensity
+        uint16_t explosionDecay;      // Explosion fade per second
+        uint16_t sparkDecay;          // Spark fade per second
+        uint32_t explosionPhaseTime;  // 2s of explosions
+        uint32_t firePhaseTime;       // 3s of fire
+        uint32_t sparkPhaseTime;      // 2s of sparks
+        uint32_t fadePhaseTime;       // 1s fade out
+    };
+    Params params;
+    static const ParamSpec PARAM_SPECS[];
+    static const ParamSchema PARAM_SCHEMA;
     
-    void updateDestructionForZone(size_t zoneIndex, Zone* zone);
+    void updateDestructionForZone(size_t zoneIndex, Zone* zone, uint32_t now);
     void startDestruction();
     uint8_t calculateExplosionIntensity(uint32_t elapsed, uint8_t phase);
     CRGB getDestructionColor(uint8_t phase, uint8_t intensity);
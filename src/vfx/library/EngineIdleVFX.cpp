@@ -3,36 +3,38 @@
 
 namespace BattleAura {
 
-EngineIdleVFX::EngineIdleVFX(LedController& ledController, Configuration& config) 
-    : BaseVFX(ledController, config, "EngineIdle", VFXPriority::AMBIENT) {
+const ParamSpec EngineIdleVFX::PARAM_SPECS[] = {
+    {"smoothingMs", ParamType::U16, offsetof(Params, smoothingMs), 0, 2000, 134, "ms"},
+    {"baseBrightness", ParamType::U8, offsetof(Params, baseBrightness), 0, 255, 120, "level"},
+    {"pulseAmplitude", ParamType::U8, offsetof(Params, pulseAmplitude), 0, 255, 40, "level"},
+};
+
+const ParamSchema EngineIdleVFX::PARAM_SCHEMA = {PARAM_SPECS, sizeof(PARAM_SPECS) / sizeof(PARAM_SPECS[0]), sizeof(Params)};
+
+EngineIdleVFX::EngineIdleVFX(Compositor& compositor, Configuration& config) 
+    : BaseVFX(compositor, config, "EngineIdle", VFXPriority::AMBIENT) {
+    bindParams(PARAM_SCHEMA, &params);
 }
 
 void EngineIdleVFX::begin() {
-    Serial.println("EngineIdle: Initializing...");
-    
-    // Use target zones if set, otherwise fall back to all zones
-    std::vector<Zone*> zones = hasTargetZones() ? getTargetZones() : config.getAllZones();
+    const std::vector<Zone*>& zones = getActiveZones();
     idleStates.clear();
     idleStates.resize(zones.size());
     
     for (size_t i = 0; i < zones.size(); i++) {
         IdleState& state = idleStates[i];
         state.lastUpdate = millis();
-        state.currentBrightness = BASE_BRIGHTNESS;
-        state.baseBrightness = BASE_BRIGHTNESS + random(-20, 20); // Vary base slightly
-        state.pulsePhase = random(0, 628) / 100.0;  // Random starting phase (0-2π)
-        state.pulseSpeed = random(80, 120) / 100.0; // Vary pulse speed
-        state.nextVariation = millis() + random(2000, 5000); // Variation every 2-5s
+        state.baseBrightness = params.baseBrightness + rng.range(-20, 20); // Vary base slightly
+        state.pulse.value = rng.next();                 // Random starting phase
+        state.pulse.setRate(rng.range(255, 382));       // Vary pulse speed (0.25-0.38 Hz)
+        state.nextVariation = millis() + rng.range(2000, 5000); // Variation every 2-5s
     }
-    
-    Serial.printf("EngineIdle: Initialized for %d zones\n", zones.size());
 }
 
-void EngineIdleVFX::update() {
+void EngineIdleVFX::update(uint32_t now) {
     if (!enabled) return;
     
-    // Use target zones if set, otherwise fall back to all zones  
-    std::vector<Zone*> zones = hasTargetZones() ? getTargetZones() : config.getAllZones();
+    const std::vector<Zone*>& zones = getActiveZones();
     
     // Ensure we have idle states for current target zones
     if (idleStates.size() != zones.size()) {
@@ -41,52 +43,42 @@ void EngineIdleVFX::update() {
     
     for (size_t i = 0; i < zones.size(); i++) {
         if (i < idleStates.size()) {
-            updateIdleForZone(i, zones[i]);
+            updateIdleForZone(i, zones[i], now);
         }
     }
 }
 
-void EngineIdleVFX::updateIdleForZone(size_t zoneIndex, Zone* zone) {
+void EngineIdleVFX::updateIdleForZone(size_t zoneIndex, Zone* zone, uint32_t now) {
     if (!zone || !zone->enabled) return;
     
     IdleState& state = idleStates[zoneIndex];
-    uint32_t currentTime = millis();
+    uint32_t deltaMs = elapsedSince(now, state.lastUpdate);
+    state.lastUpdate = now;
     
-    // Only update every UPDATE_INTERVAL ms
-    if (currentTime - state.lastUpdate < UPDATE_INTERVAL) {
-        return;
-    }
+    // Update pulse phase - slow steady pulse
+    state.pulse.advance(deltaMs);
     
-    float deltaTime = (currentTime - state.lastUpdate) / 1000.0; // Time in seconds
-    
-    // Update pulse phase
-    state.pulsePhase += deltaTime * state.pulseSpeed * 2.0; // Slow steady pulse
-    
-    // Generate smooth engine idle pulse
-    float pulseWave = sin(state.pulsePhase) * 0.5 + 0.5; // 0-1 range
-    float targetBrightness = state.baseBrightness + (pulseWave * PULSE_AMPLITUDE);
+    // Generate smooth engine idle pulse (0 to params.pulseAmplitude)
+    int16_t pulseWave = (params.pulseAmplitude + VFXMath::scaleWave(state.pulse.sine(), params.pulseAmplitude)) / 2;
+    int16_t targetBrightness = state.baseBrightness + pulseWave;
     
     // Clamp to valid range
-    float maxBrightness = (float)zone->brightness;
-    targetBrightness = max(0.0f, min(maxBrightness, targetBrightness));
-    
-    // Smooth interpolation
-    float smoothing = 0.2;
-    state.currentBrightness = state.currentBrightness * (1.0 - smoothing) + targetBrightness * smoothing;
+    targetBrightness = max((int16_t)0, min((int16_t)zone->brightness, targetBrightness));
     
     // Occasional variation in base brightness
-    if (currentTime >= state.nextVariation) {
-        state.baseBrightness = BASE_BRIGHTNESS + random(-30, 30);
-        state.pulseSpeed = random(60, 140) / 100.0;
-        state.nextVariation = currentTime + random(3000, 8000);
+    if (now >= state.nextVariation) {
+        state.baseBrightness = params.baseBrightness + rng.range(-30, 30);
+        state.pulse.setRate(rng.range(191, 446));
+        state.nextVariation = now + rng.range(3000, 8000);
     }
     
-    // Apply to LED controller - adapt to zone type
-    uint8_t brightness = (uint8_t)round(state.currentBrightness);
+    // Apply to LED controller - adapt to zone type (smoothed by the output stage)
+    uint8_t brightness = (uint8_t)targetBrightness;
+    layer.setZoneSmoothing(zone->id, params.smoothingMs);
     
     if (zone->type == ZoneType::PWM) {
         // PWM zones: steady glow with subtle pulse
-        ledController.setZoneBrightness(zone->id, brightness);
+        layer.setZoneBrightness(zone->id, brightness);
     } else if (zone->type == ZoneType::WS2812B) {
         // RGB zones: blue engine glow with brightness variation
         uint8_t red = 50;
@@ -94,10 +86,8 @@ void EngineIdleVFX::updateIdleForZone(size_t zoneIndex, Zone* zone) {
         uint8_t blue = 255;
         
         CRGB engineColor = CRGB(red, green, blue);
-        ledController.setZoneColorAndBrightness(zone->id, engineColor, brightness);
+        layer.setZoneColorAndBrightness(zone->id, engineColor, brightness);
     }
-    
-    state.lastUpdate = currentTime;
 }
 
 } // namespace BattleAura
\ No newline at end of file
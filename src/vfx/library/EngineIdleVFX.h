@@ -7,31 +7,35 @@ namespace BattleAura {
 
 class EngineIdleVFX : public BaseVFX {
 public:
-    EngineIdleVFX(LedController& ledController, Configuration& config);
+    EngineIdleVFX(Compositor& compositor, Configuration& config);
     
     // BaseVFX implementation
     void begin() override;
-    void update() override;
+    void update(uint32_t now) override;
     
 private:
     // Per-zone engine idle state
     struct IdleState {
         uint32_t lastUpdate;
-        float currentBrightness;
-        float baseBrightness;
-        float pulsePhase;
-        float pulseSpeed;
+        int16_t baseBrightness;
+        VFXMath::Phase pulse;
         uint32_t nextVariation;
     };
     
     std::vector<IdleState> idleStates;
     
     // Engine idle parameters - steady pulse with subtle variation
-    static const uint16_t UPDATE_INTERVAL = 30;     // Update every 30ms
-    static const uint8_t BASE_BRIGHTNESS = 120;     // Base engine idle brightness
-    static const uint8_t PULSE_AMPLITUDE = 40;      // Pulse range
+    // Set from the scene's parameters; PARAM_SPECS has the ranges and defaults
+    struct Params {
+        uint16_t smoothingMs;    // Output smoothing time constant
+        uint8_t baseBrightness;  // Base engine idle brightness
+        uint8_t pulseAmplitude;  // Pulse range
+    };
+    Params params;
+    static const ParamSpec PARAM_SPECS[];
+    static const ParamSchema PARAM_SCHEMA;
     
-    void updateIdleForZone(size_t zoneIndex, Zone* zone);
+    void updateIdleForZone(size_t zoneIndex, Zone* zone, uint32_t now);
 };
 
 } // namespace BattleAura
\ No newline at end of file
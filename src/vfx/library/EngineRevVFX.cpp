@@ -3,119 +3,118 @@
 
 namespace BattleAura {
 
-EngineRevVFX::EngineRevVFX(LedController& ledController, Configuration& config)
-    : BaseVFX(ledController, config, "EngineRev", VFXPriority::ACTIVE) {
+const ParamSpec EngineRevVFX::PARAM_SPECS[] = {
+    {"minIntensity", ParamType::U8, offsetof(Params, minIntensity), 0, 255, 80, "level"},
+    {"maxIntensity", ParamType::U8, offsetof(Params, maxIntensity), 0, 255, 255, "level"},
+    {"rampRate", ParamType::U16, offsetof(Params, rampRate), 0, 2000, 160, "per s"},
+    {"rampUpTime", ParamType::U32, offsetof(Params, rampUpTime), 0, 60000, 1500, "ms"},
+    {"peakTime", ParamType::U32, offsetof(Params, peakTime), 0, 60000, 1000, "ms"},
+    {"rampDownTime", ParamType::U32, offsetof(Params, rampDownTime), 0, 60000, 1500, "ms"},
+};
+
+const ParamSchema EngineRevVFX::PARAM_SCHEMA = {PARAM_SPECS, sizeof(PARAM_SPECS) / sizeof(PARAM_SPECS[0]), sizeof(Params)};
+
+EngineRevVFX::EngineRevVFX(Compositor& compositor, Configuration& config)
+    : BaseVFX(compositor, config, "EngineRev", VFXPriority::ACTIVE) {
+    bindParams(PARAM_SCHEMA, &params);
 }
 
 void EngineRevVFX::begin() {
-    Serial.println("EngineRevVFX: Initializing");
-    
     // Initialize rev states for all zones
     revStates.clear();
-    revStates.resize(targetZones.size());
+    revStates.resize(getActiveZones().size());
     
     for (auto& state : revStates) {
         state.revStartTime = 0;
-        state.currentIntensity = MIN_INTENSITY;
-        state.targetIntensity = MIN_INTENSITY;
+        state.currentIntensity = params.minIntensity;
+        state.targetIntensity = params.minIntensity;
         state.lastUpdate = 0;
         state.isRevving = false;
         state.revPhase = 0;
     }
 }
 
-void EngineRevVFX::update() {
+void EngineRevVFX::update(uint32_t now) {
     if (!enabled) {
         return;
     }
     
-    uint32_t currentTime = millis();
-    
     // Check if duration has expired
-    if (shouldStop()) {
-        Serial.println("EngineRevVFX: Duration expired");
+    if (shouldStop(now)) {
         stop();
         return;
     }
     
     // Update rev effect for each target zone
-    for (size_t i = 0; i < targetZones.size(); i++) {
-        Zone* zone = targetZones[i];
+    const std::vector<Zone*>& zones = getActiveZones();
+    for (size_t i = 0; i < zones.size(); i++) {
+        Zone* zone = zones[i];
         if (zone && zone->enabled) {
-            updateRevForZone(i, zone);
+            updateRevForZone(i, zone, now);
         }
     }
 }
 
 void EngineRevVFX::trigger(uint32_t duration) {
-    Serial.printf("EngineRevVFX: Triggered with duration %dms\n", duration);
-    
     BaseVFX::trigger(duration);
     
     startRevving();
 }
 
 void EngineRevVFX::startRevving() {
-    Serial.printf("EngineRevVFX: Starting engine rev effect on %d zones\n", targetZones.size());
-    
     uint32_t currentTime = millis();
     
     // Initialize rev state for each zone
     for (size_t i = 0; i < revStates.size(); i++) {
         auto& state = revStates[i];
         state.revStartTime = currentTime;
-        state.currentIntensity = MIN_INTENSITY;
-        state.targetIntensity = MIN_INTENSITY;
+        state.currentIntensity = params.minIntensity;
+        state.targetIntensity = params.minIntensity;
         state.lastUpdate = currentTime;
         state.isRevving = true;
         state.revPhase = 0; // Start with ramp up
     }
 }
 
-void EngineRevVFX::updateRevForZone(size_t zoneIndex, Zone* zone) {
+void EngineRevVFX::updateRevForZone(size_t zoneIndex, Zone* zone, uint32_t now) {
     if (zoneIndex >= revStates.size()) return;
     
     auto& state = revStates[zoneIndex];
     if (!state.isRevving) return;
     
-    uint32_t currentTime = millis();
-    
-    // Update timing
-    if (currentTime - state.lastUpdate < UPDATE_INTERVAL) {
-        return; // Not time for update yet
-    }
-    
-    state.lastUpdate = currentTime;
-    uint32_t elapsed = currentTime - state.revStartTime;
+    uint32_t deltaMs = elapsedSince(now, state.lastUpdate);
+    state.lastUpdate = now;
+    uint32_t elapsed = elapsedSince(now, state.revStartTime);
     
     // Determine rev phase based on elapsed time
-    if (elapsed <= RAMP_UP_TIME) {
+    if (elapsed <= params.rampUpTime) {
         state.revPhase = 0; // Ramp up
-        state.targetIntensity = map(elapsed, 0, RAMP_UP_TIME, MIN_INTENSITY, MAX_INTENSITY);
-    } else if (elapsed <= RAMP_UP_TIME + PEAK_TIME) {
+        state.targetIntensity = VFXMath::ramp(elapsed, params.rampUpTime, params.minIntensity, params.maxIntensity);
+    } else if (elapsed <= params.rampUpTime + params.peakTime) {
         state.revPhase = 1; // Peak
-        state.targetIntensity = MAX_INTENSITY;
-    } else if (elapsed <= RAMP_UP_TIME + PEAK_TIME + RAMP_DOWN_TIME) {
+        state.targetIntensity = params.maxIntensity;
+    } else if (elapsed <= params.rampUpTime + params.peakTime + params.rampDownTime) {
         state.revPhase = 2; // Ramp down
-        uint32_t rampDownElapsed = elapsed - RAMP_UP_TIME - PEAK_TIME;
-        state.targetIntensity = map(rampDownElapsed, 0, RAMP_DOWN_TIME, MAX_INTENSITY, MIN_INTENSITY);
+        uint32_t rampDownElapsed = elapsed - params.rampUpTime - params.peakTime;
+        state.targetIntensity = VFXMath::ramp(rampDownElapsed, params.rampDownTime, params.maxIntensity, params.minIntensity);
     } else {
         // Rev complete
-        state.targetIntensity = MIN_INTENSITY;
+        state.targetIntensity = params.minIntensity;
         state.isRevving = false;
     }
     
     // Smoothly transition current intensity toward target
+    int rampStep = scaledStep(params.rampRate, deltaMs);
     if (state.currentIntensity < state.targetIntensity) {
-        state.currentIntensity = min((int)state.currentIntensity + RAMP_RATE, (int)state.targetIntensity);
+        state.currentIntensity = min((int)state.currentIntensity + rampStep, (int)state.targetIntensity);
     } else if (state.currentIntensity > state.targetIntensity) {
-        state.currentIntensity = max((int)state.currentIntensity - RAMP_RATE, (int)state.targetIntensity);
+        state.currentIntensity = max((int)state.currentIntensity - rampStep, (int)state.targetIntensity);
     }
     
     // Apply intensity based on zone type
     if (zone->type == ZoneType::PWM) {
         // For PWM zones, directly control brightness
-        ledController.setZoneBrightness(zone->id, state.currentIntensity);
+        layer.setZoneBrightness(zone->id, state.currentIntensity);
     } else if (zone->type == ZoneType::WS2812B) {
         // For RGB zones, create engine glow colors (blue/white)
         CRGB engineColor;
@@ -123,20 +122,20 @@ void EngineRevVFX::updateRevForZone(size_t zoneIndex, Zone* zone) {
         engineColor.g = (state.currentIntensity * 200) / 255;  
         engineColor.b = state.currentIntensity;                // Blue engine glow
         
-        ledController.setZoneColor(zone->id, engineColor);
+        layer.setZoneColor(zone->id, engineColor);
     }
 }
 
 uint8_t EngineRevVFX::calculateRevIntensity(uint32_t elapsed, uint8_t phase) {
     switch (phase) {
         case 0: // Ramp up
-            return map(elapsed, 0, RAMP_UP_TIME, MIN_INTENSITY, MAX_INTENSITY);
+            return VFXMath::ramp(elapsed, params.rampUpTime, params.minIntensity, params.maxIntensity);
         case 1: // Peak
-            return MAX_INTENSITY;
+            return params.maxIntensity;
         case 2: // Ramp down
-            return map(elapsed - RAMP_UP_TIME - PEAK_TIME, 0, RAMP_DOWN_TIME, MAX_INTENSITY, MIN_INTENSITY);
+            return VFXMath::ramp(elapsed - params.rampUpTime - params.peakTime, params.rampDownTime, params.maxIntensity, params.minIntensity);
         default:
-            return MIN_INTENSITY;
+            return params.minIntensity;
     }
 }
 
@@ -7,11 +7,11 @@ namespace BattleAura {
 
 class EngineRevVFX : public BaseVFX {
 public:
-    EngineRevVFX(LedController& ledController, Configuration& config);
+    EngineRevVFX(Compositor& compositor, Configuration& config);
     
     // BaseVFX implementation
     void begin() override;
-    void update() override;
+    void update(uint32_t now) override;
     void trigger(uint32_t duration = 4000) override; // 4s default duration
     
 private:
@@ -28,15 +28,20 @@ private:
     std::vector<RevState> revStates;
     
     // Engine rev parameters
-    static const uint16_t UPDATE_INTERVAL = 50;        // 50ms update rate
-    static const uint8_t MIN_INTENSITY = 80;           // Starting intensity
-    static const uint8_t MAX_INTENSITY = 255;          // Peak intensity
-    static const uint8_t RAMP_RATE = 8;                // Intensity change per update
-    static const uint32_t RAMP_UP_TIME = 1500;         // 1.5s ramp up
-    static const uint32_t PEAK_TIME = 1000;            // 1s at peak
-    static const uint32_t RAMP_DOWN_TIME = 1500;       // 1.5s ramp down
+    // Set from the scene's parameters; PARAM_SPECS has the ranges and defaults
+    struct Params {
+        uint8_t minIntensity;   // Starting intensity
+        uint8_t maxIntensity;   // Peak intensity
+        uint16_t rampRate;      // Intensity change per second
+        uint32_t rampUpTime;    // 1.5s ramp up
+        uint32_t peakTime;      // 1s at peak
+        uint32_t rampDownTime;  // 1.5s ramp down
+    };
+    Params params;
+    static const ParamSpec PARAM_SPECS[];
+    static const ParamSchema PARAM_SCHEMA;
     
-    void updateRevForZone(size_t zoneIndex, Zone* zone);
+    void updateRevForZone(size_t zoneIndex, Zone* zone, uint32_t now);
     void startRevving();
     uint8_t calculateRevIntensity(uint32_t elapsed, uint8_t phase);
 };
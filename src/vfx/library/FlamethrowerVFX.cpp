@@ -3,52 +3,56 @@
 
 namespace BattleAura {
 
-FlamethrowerVFX::FlamethrowerVFX(LedController& ledController, Configuration& config)
-    : BaseVFX(ledController, config, "Flamethrower", VFXPriority::ACTIVE) {
+const ParamSpec FlamethrowerVFX::PARAM_SPECS[] = {
+    {"flickerInterval", ParamType::U16, offsetof(Params, flickerInterval), 1, 1000, 30, "ms"},
+    {"minIntensity", ParamType::U8, offsetof(Params, minIntensity), 0, 255, 180, "level"},
+    {"maxIntensity", ParamType::U8, offsetof(Params, maxIntensity), 0, 255, 255, "level"},
+    {"intensityRange", ParamType::U8, offsetof(Params, intensityRange), 0, 255, 50, "level"},
+};
+
+const ParamSchema FlamethrowerVFX::PARAM_SCHEMA = {PARAM_SPECS, sizeof(PARAM_SPECS) / sizeof(PARAM_SPECS[0]), sizeof(Params)};
+
+FlamethrowerVFX::FlamethrowerVFX(Compositor& compositor, Configuration& config)
+    : BaseVFX(compositor, config, "Flamethrower", VFXPriority::ACTIVE) {
+    bindParams(PARAM_SCHEMA, &params);
 }
 
 void FlamethrowerVFX::begin() {
-    Serial.println("FlamethrowerVFX: Initializing");
-    
     // Initialize flame states for all zones
     flameStates.clear();
-    flameStates.resize(targetZones.size());
+    flameStates.resize(getActiveZones().size());
     
     for (auto& state : flameStates) {
         state.flameStartTime = 0;
-        state.baseIntensity = MIN_INTENSITY;
+        state.baseIntensity = params.minIntensity;
         state.lastFlicker = 0;
         state.flickerPhase = 0;
         state.isFlaming = false;
     }
 }
 
-void FlamethrowerVFX::update() {
+void FlamethrowerVFX::update(uint32_t now) {
     if (!enabled) {
         return;
     }
     
-    uint32_t currentTime = millis();
-    
     // Check if duration has expired
-    if (shouldStop()) {
-        Serial.println("FlamethrowerVFX: Duration expired");
+    if (shouldStop(now)) {
         stop();
         return;
     }
     
     // Update flame effect for each target zone
-    for (size_t i = 0; i < targetZones.size(); i++) {
-        Zone* zone = targetZones[i];
+    const std::vector<Zone*>& zones = getActiveZones();
+    for (size_t i = 0; i < zones.size(); i++) {
+        Zone* zone = zones[i];
         if (zone && zone->enabled) {
-            updateFlameForZone(i, zone);
+            updateFlameForZone(i, zone, now);
         }
     }
 }
 
 void FlamethrowerVFX::trigger(uint32_t duration) {
-    Serial.printf("FlamethrowerVFX: Triggered with duration %dms\n", duration);
-    
     // BaseVFX::trigger handles the timing
     BaseVFX::trigger(duration);
     
@@ -56,42 +60,39 @@ void FlamethrowerVFX::trigger(uint32_t duration) {
 }
 
 void FlamethrowerVFX::startFlaming() {
-    Serial.printf("FlamethrowerVFX: Starting flame effect on %d zones\n", targetZones.size());
-    
     uint32_t currentTime = millis();
     
     // Initialize flame state for each zone
     for (size_t i = 0; i < flameStates.size(); i++) {
         auto& state = flameStates[i];
         state.flameStartTime = currentTime;
-        state.baseIntensity = MIN_INTENSITY;
+        state.baseIntensity = params.minIntensity;
         state.lastFlicker = currentTime;
-        state.flickerPhase = random(0, 100);  // Random starting phase for variety
+        state.flickerPhase = rng.below(100);  // Random starting phase for variety
         state.isFlaming = true;
     }
 }
 
-void FlamethrowerVFX::updateFlameForZone(size_t zoneIndex, Zone* zone) {
+void FlamethrowerVFX::updateFlameForZone(size_t zoneIndex, Zone* zone, uint32_t now) {
     if (zoneIndex >= flameStates.size()) return;
     
     auto& state = flameStates[zoneIndex];
     if (!state.isFlaming) return;
     
-    uint32_t currentTime = millis();
-    
     // Update flicker timing
-    if (currentTime - state.lastFlicker >= FLICKER_INTERVAL) {
-        state.lastFlicker = currentTime;
+    if (elapsedSince(now, state.lastFlicker) >= params.flickerInterval) {
+        state.lastFlicker = now;
         state.flickerPhase = (state.flickerPhase + 1) % 100;
     }
     
     // Calculate flame intensity with flickering
-    uint8_t flameIntensity = calculateFlameIntensity(state.flickerPhase);
+    // Each zone samples its own stretch of the noise
+    uint8_t flameIntensity = calculateFlameIntensity(state.flickerPhase, now * 8 + zoneIndex * 0x1000);
     
     // Apply flame intensity based on zone type
     if (zone->type == ZoneType::PWM) {
         // For PWM zones, directly control brightness
-        ledController.setZoneBrightness(zone->id, flameIntensity);
+        layer.setZoneBrightness(zone->id, flameIntensity);
     } else if (zone->type == ZoneType::WS2812B) {
         // For RGB zones, create orange/red flame colors with intensity
         CRGB flameColor;
@@ -99,24 +100,23 @@ void FlamethrowerVFX::updateFlameForZone(size_t zoneIndex, Zone* zone) {
         flameColor.g = (flameIntensity * 60) / 255;  // Orange tint
         flameColor.b = 0;  // No blue for flame
         
-        ledController.setZoneColor(zone->id, flameColor);
+        layer.setZoneColor(zone->id, flameColor);
     }
 }
 
-uint8_t FlamethrowerVFX::calculateFlameIntensity(uint8_t phase) {
+uint8_t FlamethrowerVFX::calculateFlameIntensity(uint8_t phase, uint32_t noiseInput) {
     // Create realistic flame flickering using sine wave with noise
-    float baseWave = sin(phase * 0.1) * 0.3 + 0.7;  // Base wave between 0.4-1.0
+    // Base wave between 0.4-1.0 of full intensity
+    int16_t baseWave = 178 + VFXMath::scaleWave(VFXMath::sin16(phase * VFXMath::toAngle(0.1)), 77);
     
-    // Add some random variation for flame irregularity
-    uint8_t randomNoise = random(0, 20) - 10;  // -10 to +10
+    // Add smooth noise for flame irregularity, -10 to +10
+    int16_t noise = ((int16_t)VFXMath::noise8(noiseInput) - 128) * 10 / 128;
     
     // Calculate final intensity
-    float intensity = baseWave * MAX_INTENSITY + randomNoise;
+    int16_t intensity = baseWave + noise;
     
     // Clamp to valid range
-    intensity = constrain(intensity, MIN_INTENSITY, MAX_INTENSITY);
-    
-    return (uint8_t)intensity;
+    return constrain(intensity, params.minIntensity, params.maxIntensity);
 }
 
 } // namespace BattleAura
\ No newline at end of file
@@ -7,11 +7,11 @@ namespace BattleAura {
 
 class FlamethrowerVFX : public BaseVFX {
 public:
-    FlamethrowerVFX(LedController& ledController, Configuration& config);
+    FlamethrowerVFX(Compositor& compositor, Configuration& config);
     
     // BaseVFX implementation
     void begin() override;
-    void update() override;
+    void update(uint32_t now) override;
     void trigger(uint32_t duration = 3000) override; // 3s default duration
     
 private:
@@ -27,14 +27,20 @@ private:
     std::vector<FlameState> flameStates;
     
     // Flamethrower parameters
-    static const uint16_t FLICKER_INTERVAL = 30;       // 30ms flicker rate
-    static const uint8_t MIN_INTENSITY = 180;          // Minimum flame intensity
-    static const uint8_t MAX_INTENSITY = 255;          // Maximum flame intensity
-    static const uint8_t INTENSITY_RANGE = 50;         // Range of intensity variation
+    // Set from the scene's parameters; PARAM_SPECS has the ranges and defaults
+    struct Params {
+        uint16_t flickerInterval;  // 30ms flicker rate
+        uint8_t minIntensity;      // Minimum flame intensity
+        uint8_t maxIntensity;      // Maximum flame intensity
+        uint8_t intensityRange;    // Range of intensity variation
+    };
+    Params params;
+    static const ParamSpec PARAM_SPECS[];
+    static const ParamSchema PARAM_SCHEMA;
     
-    void updateFlameForZone(size_t zoneIndex, Zone* zone);
+    void updateFlameForZone(size_t zoneIndex, Zone* zone, uint32_t now);
     void startFlaming();
-    uint8_t calculateFlameIntensity(uint8_t phase);
+    uint8_t calculateFlameIntensity(uint8_t phase, uint32_t noiseInput);
 };
 
 } // namespace BattleAura
\ No newline at end of file
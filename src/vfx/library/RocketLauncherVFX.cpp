@@ -3,60 +3,62 @@
 
 namespace BattleAura {
 
-RocketLauncherVFX::RocketLauncherVFX(LedController& ledController, Configuration& config)
-    : BaseVFX(ledController, config, "RocketLauncher", VFXPriority::ACTIVE) {
+const ParamSpec RocketLauncherVFX::PARAM_SPECS[] = {
+    {"maxIntensity", ParamType::U8, offsetof(Params, maxIntensity), 0, 255, 255, "level"},
+    {"chargeTime", ParamType::U32, offsetof(Params, chargeTime), 0, 60000, 300, "ms"},
+    {"flashTime", ParamType::U32, offsetof(Params, flashTime), 0, 60000, 200, "ms"},
+    {"afterglowTime", ParamType::U32, offsetof(Params, afterglowTime), 0, 60000, 800, "ms"},
+    {"fadeTime", ParamType::U32, offsetof(Params, fadeTime), 0, 60000, 700, "ms"},
+};
+
+const ParamSchema RocketLauncherVFX::PARAM_SCHEMA = {PARAM_SPECS, sizeof(PARAM_SPECS) / sizeof(PARAM_SPECS[0]), sizeof(Params)};
+
+RocketLauncherVFX::RocketLauncherVFX(Compositor& compositor, Configuration& config)
+    : BaseVFX(compositor, config, "RocketLauncher", VFXPriority::ACTIVE) {
+    bindParams(PARAM_SCHEMA, &params);
 }
 
 void RocketLauncherVFX::begin() {
-    Serial.println("RocketLauncherVFX: Initializing");
-    
     // Initialize launch states for all zones
     launchStates.clear();
-    launchStates.resize(targetZones.size());
+    launchStates.resize(getActiveZones().size());
     
     for (auto& state : launchStates) {
         state.launchStartTime = 0;
         state.currentIntensity = 0;
-        state.lastUpdate = 0;
         state.isLaunching = false;
         state.launchPhase = 0;
     }
 }
 
-void RocketLauncherVFX::update() {
+void RocketLauncherVFX::update(uint32_t now) {
     if (!enabled) {
         return;
     }
     
-    uint32_t currentTime = millis();
-    
     // Check if duration has expired
-    if (shouldStop()) {
-        Serial.println("RocketLauncherVFX: Duration expired");
+    if (shouldStop(now)) {
         stop();
         return;
     }
     
     // Update launch effect for each target zone
-    for (size_t i = 0; i < targetZones.size(); i++) {
-        Zone* zone = targetZones[i];
+    const std::vector<Zone*>& zones = getActiveZones();
+    for (size_t i = 0; i < zones.size(); i++) {
+        Zone* zone = zones[i];
         if (zone && zone->enabled) {
-            updateLaunchForZone(i, zone);
+            updateLaunchForZone(i, zone, now);
         }
     }
 }
 
 void RocketLauncherVFX::trigger(uint32_t duration) {
-    Serial.printf("RocketLauncherVFX: Triggered with duration %dms\n", duration);
-    
     BaseVFX::trigger(duration);
     
     startLaunching();
 }
 
 void RocketLauncherVFX::startLaunching() {
-    Serial.printf("RocketLauncherVFX: Starting rocket launch effect on %d zones\n", targetZones.size());
-    
     uint32_t currentTime = millis();
     
     // Initialize launch state for each zone
@@ -64,46 +66,37 @@ void RocketLauncherVFX::startLaunching() {
         auto& state = launchStates[i];
         state.launchStartTime = currentTime;
         state.currentIntensity = 0;
-        state.lastUpdate = currentTime;
         state.isLaunching = true;
         state.launchPhase = 0; // Start with charge phase
     }
 }
 
-void RocketLauncherVFX::updateLaunchForZone(size_t zoneIndex, Zone* zone) {
+void RocketLauncherVFX::updateLaunchForZone(size_t zoneIndex, Zone* zone, uint32_t now) {
     if (zoneIndex >= launchStates.size()) return;
     
     auto& state = launchStates[zoneIndex];
     if (!state.isLaunching) return;
     
-    uint32_t currentTime = millis();
-    
-    // Update timing
-    if (currentTime - state.lastUpdate < UPDATE_INTERVAL) {
-        return; // Not time for update yet
-    }
-    
-    state.lastUpdate = currentTime;
-    uint32_t elapsed = currentTime - state.launchStartTime;
+    uint32_t elapsed = elapsedSince(now, state.launchStartTime);
     
     // Determine launch phase based on elapsed time
-    if (elapsed <= CHARGE_TIME) {
+    if (elapsed <= params.chargeTime) {
         state.launchPhase = 0; // Charge phase
-        state.currentIntensity = map(elapsed, 0, CHARGE_TIME, 0, 120);
+        state.currentIntensity = VFXMath::ramp(elapsed, params.chargeTime, 0, 120);
         
-    } else if (elapsed <= CHARGE_TIME + FLASH_TIME) {
+    } else if (elapsed <= params.chargeTime + params.flashTime) {
         state.launchPhase = 1; // Flash phase
-        state.currentIntensity = MAX_INTENSITY; // Full brightness flash
+        state.currentIntensity = params.maxIntensity; // Full brightness flash
         
-    } else if (elapsed <= CHARGE_TIME + FLASH_TIME + AFTERGLOW_TIME) {
+    } else if (elapsed <= params.chargeTime + params.flashTime + params.afterglowTime) {
         state.launchPhase = 2; // Afterglow phase
-        uint32_t afterglowElapsed = elapsed - CHARGE_TIME - FLASH_TIME;
-        state.currentIntensity = map(afterglowElapsed, 0, AFTERGLOW_TIME, 200, 80);
+        uint32_t afterglowElapsed = elapsed - params.chargeTime - params.flashTime;
+        state.currentIntensity = VFXMath::ramp(afterglowElapsed, params.afterglowTime, 200, 80);
         
-    } else if (elapsed <= CHARGE_TIME + FLASH_TIME + AFTERGLOW_TIME + FADE_TIME) {
+    } else if (elapsed <= params.chargeTime + params.flashTime + params.afterglowTime + params.fadeTime) {
         state.launchPhase = 3; // Fade phase
-        uint32_t fadeElapsed = elapsed - CHARGE_TIME - FLASH_TIME - AFTERGLOW_TIME;
-        state.currentIntensity = map(fadeElapsed, 0, FADE_TIME, 80, 0);
+        uint32_t fadeElapsed = elapsed - params.chargeTime - params.flashTime - params.afterglowTime;
+        state.currentIntensity = VFXMath::ramp(fadeElapsed, params.fadeTime, 80, 0);
         
     } else {
         // Launch complete
@@ -114,24 +107,34 @@ void RocketLauncherVFX::updateLaunchForZone(size_t zoneIndex, Zone* zone) {
     // Apply launch effect based on zone type
     if (zone->type == ZoneType::PWM) {
         // For PWM zones, directly control brightness
-        ledController.setZoneBrightness(zone->id, state.currentIntensity);
+        layer.setZoneBrightness(zone->id, state.currentIntensity);
     } else if (zone->type == ZoneType::WS2812B) {
         // For RGB zones, use launch colors
         CRGB launchColor = getLaunchColor(state.launchPhase, state.currentIntensity);
-        ledController.setZoneColor(zone->id, launchColor);
+        uint16_t pixelCount = layer.getZonePixelCount(zone->id);
+        
+        if (state.launchPhase == 0 && pixelCount > 1) {
+            // Charge sweeps along the strip with a white-hot leading edge
+            uint16_t lit = VFXMath::ramp(elapsed, params.chargeTime, 1, pixelCount);
+            layer.fillPixels(zone->id, 0, lit, launchColor);
+            layer.fillPixels(zone->id, lit, pixelCount - lit, CRGB::Black);
+            layer.setPixel(zone->id, lit - 1, getLaunchColor(1, params.maxIntensity));
+        } else {
+            layer.fillPixels(zone->id, 0, pixelCount, launchColor);
+        }
     }
 }
 
 uint8_t RocketLauncherVFX::calculateLaunchIntensity(uint32_t elapsed, uint8_t phase) {
     switch (phase) {
         case 0: // Charge - gradual buildup
-            return map(elapsed, 0, CHARGE_TIME, 0, 120);
+            return VFXMath::ramp(elapsed, params.chargeTime, 0, 120);
         case 1: // Flash - maximum intensity
-            return MAX_INTENSITY;
+            return params.maxIntensity;
         case 2: // Afterglow - bright but fading
-            return map(elapsed - CHARGE_TIME - FLASH_TIME, 0, AFTERGLOW_TIME, 200, 80);
+            return VFXMath::ramp(elapsed - params.chargeTime - params.flashTime, params.afterglowTime, 200, 80);
         case 3: // Fade - diminishing
-            return map(elapsed - CHARGE_TIME - FLASH_TIME - AFTERGLOW_TIME, 0, FADE_TIME, 80, 0);
+            return VFXMath::ramp(elapsed - params.chargeTime - params.flashTime - params.afterglowTime, params.fadeTime, 80, 0);
         default:
             return 0;
     }
@@ -7,11 +7,11 @@ namespace BattleAura {
 
 class RocketLauncherVFX : public BaseVFX {
 public:
-    RocketLauncherVFX(LedController& ledController, Configuration& config);
+    RocketLauncherVFX(Compositor& compositor, Configuration& config);
     
     // BaseVFX implementation
     void begin() override;
-    void update() override;
+    void update(uint32_t now) override;
     void trigger(uint32_t duration = 2000) override; // 2s default duration
     
 private:
@@ -19,7 +19,6 @@ private:
     struct LaunchState {
         uint32_t launchStartTime;
         uint8_t currentIntensity;
-        uint32_t lastUpdate;
         bool isLaunching;
         uint8_t launchPhase;           // 0=charge, 1=flash, 2=afterglow, 3=fade
     };
@@ -27,14 +26,19 @@ private:
     std::vector<LaunchState> launchStates;
     
     // Rocket launcher parameters
-    static const uint16_t UPDATE_INTERVAL = 50;        // 50ms update rate
-    static const uint8_t MAX_INTENSITY = 255;          // Peak flash intensity
-    static const uint32_t CHARGE_TIME = 300;           // 300ms charge up
-    static const uint32_t FLASH_TIME = 200;            // 200ms bright flash
-    static const uint32_t AFTERGLOW_TIME = 800;        // 800ms afterglow
-    static const uint32_t FADE_TIME = 700;             // 700ms fade out
+    // Set from the scene's parameters; PARAM_SPECS has the ranges and defaults
+    struct Params {
+        uint8_t maxIntensity;    // Peak flash intensity
+        uint32_t chargeTime;     // 300ms charge up
+        uint32_t flashTime;      // 200ms bright flash
+        uint32_t afterglowTime;  // 800ms afterglow
+        uint32_t fadeTime;       // 700ms fade out
+    };
+    Params params;
+    static const ParamSpec PARAM_SPECS[];
+    static const ParamSchema PARAM_SCHEMA;
     
-    void updateLaunchForZone(size_t zoneIndex, Zone* zone);
+    void updateLaunchForZone(size_t zoneIndex, Zone* zone, uint32_t now);
     void startLaunching();
     uint8_t calculateLaunchIntensity(uint32_t elapsed, uint8_t phase);
     CRGB getLaunchColor(uint8_t phase, uint8_t intensity);
@@ -0,0 +1,111 @@
+#include "ScriptVFX.h"
+#include <FastLED.h>
+#include <LittleFS.h>
+
+namespace BattleAura {
+
+const char* const ScriptVFX::DIRECTORY = "/effects";
+
+uint32_t ScriptVFX::frameBudget = ScriptVFX::FRAME_BUDGET;
+
+ScriptVFX::ScriptVFX(Compositor& compositor, Configuration& config, uint8_t slot)
+    : BaseVFX(compositor, config, nameFor(slot), VFXPriority::ACTIVE), slot(slot) {
+}
+
+void ScriptVFX::begin() {
+    // Programs keep no state between frames, so there is nothing per zone
+}
+
+bool ScriptVFX::readProgram(uint8_t slot, EffectProgram& program) {
+    String path = pathFor(slot);
+    if (!LittleFS.exists(path)) return false;
+    
+    File file = LittleFS.open(path, "r");
+    if (!file) return false;
+    
+    size_t size = file.size();
+    if (size > EffectProgram::MAX_FILE_SIZE) {
+        Serial.printf("%s: %s is too large (%d bytes)\n", nameFor(slot).c_str(), path.c_str(), size);
+        file.close();
+        return false;
+    }
+    
+    std::vector<uint8_t> data(size);
+    size_t bytesRead = file.read(data.data(), size);
+    file.close();
+    if (bytesRead != size) return false;
+    
+    String error;
+    if (!program.parse(data.data(), size, error)) {
+        Serial.printf("%s: Program rejected: %s\n", nameFor(slot).c_str(), error.c_str());
+        return false;
+    }
+    
+    Serial.printf("%s: Loaded '%s', %d instructions\n", nameFor(slot).c_str(), program.getLabel(), program.size());
+    return true;
+}
+
+void ScriptVFX::update(uint32_t now) {
+    if (!enabled || !program) return;
+    
+    // Check if timed VFX should stop
+    if (shouldStop(now)) {
+        stop();
+        return;
+    }
+    
+    registers[EffectProgram::T] = elapsedSince(now, triggerTime);
+    registers[EffectProgram::D] = triggerDuration;
+    registers[EffectProgram::P] = triggerDuration > 0 ?
+        VFXMath::ramp(registers[EffectProgram::T], triggerDuration, 0, 255) : 0;
+    
+    const std::vector<Zone*>& zones = getActiveZones();
+    uint16_t programSize = program->size();
+    
+    for (size_t z = 0; z < zones.size(); z++) {
+        Zone* zone = zones[z];
+        if (!zone || !zone->enabled) continue;
+    
+        bool isStrip = zone->type == ZoneType::WS2812B;
+        uint16_t pixelCount = isStrip ? layer.getZonePixelCount(zone->id) : 1;
+        registers[EffectProgram::N] = pixelCount;
+        registers[EffectProgram::Z] = z;
+    
+        for (uint16_t i = 0; i < pixelCount; i++) {
+            if (frameBudget < programSize) {
+                budgetOverruns++;
+                return;
+            }
+            frameBudget -= programSize;
+    
+            // Outputs start black at full brightness for every pixel
+            registers[EffectProgram::I] = i;
+            registers[EffectProgram::R] = 0;
+            registers[EffectProgram::G] = 0;
+            registers[EffectProgram::B] = 0;
+            registers[EffectProgram::V] = 255;
+            program->run(registers, rng);
+    
+            uint8_t brightness = constrain(registers[EffectProgram::V], 0, 255);
+            if (!isStrip) {
+                layer.setZoneBrightness(zone->id, min(brightness, zone->brightness));
+                continue;
+            }
+    
+            CRGB color(constrain(registers[EffectProgram::R], 0, 255),
+                       constrain(registers[EffectProgram::G], 0, 255),
+                       constrain(registers[EffectProgram::B], 0, 255));
+            layer.setPixel(zone->id, i, color.nscale8(brightness));
+        }
+    }
+}
+
+String ScriptVFX::nameFor(uint8_t slot) {
+    return String("Script") + String(slot);
+}
+
+String ScriptVFX::pathFor(uint8_t slot) {
+    return String(DIRECTORY) + "/" + String(slot) + ".bfx";
+}
+
+} // namespace BattleAura
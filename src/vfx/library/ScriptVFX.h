@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Arduino.h>
+#include "../BaseVFX.h"
+#include "../EffectVM.h"
+
+namespace BattleAura {
+
+// Runs an uploaded bytecode program (see EffectVM.h) from /effects/N.bfx.
+// Slots have fixed names, Script1..Script4, so scene configs can refer to
+// them before anything is uploaded; the program's label is for display.
+// The program is owned by VFXManager and shared by the slot's pooled
+// instances, so a new one is swapped in without copying or reading flash.
+class ScriptVFX : public BaseVFX {
+public:
+    ScriptVFX(Compositor& compositor, Configuration& config, uint8_t slot);
+    
+    // BaseVFX implementation
+    void begin() override;
+    void update(uint32_t now) override;
+    
+    // Program to run; nullptr (an empty slot) draws nothing
+    void setProgram(const EffectProgram* program) { this->program = program; }
+    
+    uint8_t getSlot() const { return slot; }
+    uint32_t getBudgetOverruns() const { return budgetOverruns; }
+    
+    // Read a slot's stored program, e.g. at startup; false if there is none
+    static bool readProgram(uint8_t slot, EffectProgram& program);
+    
+    static String nameFor(uint8_t slot);
+    static String pathFor(uint8_t slot);
+    
+    static const char* const DIRECTORY;
+    static const uint8_t SLOT_COUNT = 4;
+    
+    // Instructions per frame across every ScriptVFX instance and zone. Once
+    // it runs out, the rest of the frame is left as it was.
+    static const uint32_t FRAME_BUDGET = 32768;
+    static void resetFrameBudget() { frameBudget = FRAME_BUDGET; }  // Once per frame
+    
+private:
+    uint8_t slot;
+    const EffectProgram* program = nullptr;
+    int32_t registers[EffectProgram::REGISTER_COUNT];
+    uint32_t budgetOverruns = 0;    // Frames cut short by FRAME_BUDGET
+    
+    static uint32_t frameBudget;    // Left this frame, shared by all instances
+};
+
+} // namespace BattleAura
@@ -3,16 +3,27 @@
 
 namespace BattleAura {
 
-VictoryVFX::VictoryVFX(LedController& ledController, Configuration& config)
-    : BaseVFX(ledController, config, "Victory", VFXPriority::ACTIVE) {
+const ParamSpec VictoryVFX::PARAM_SPECS[] = {
+    {"pulseInterval", ParamType::U16, offsetof(Params, pulseInterval), 1, 5000, 400, "ms"},
+    {"maxPulses", ParamType::U8, offsetof(Params, maxPulses), 0, 50, 6, "count"},
+    {"maxIntensity", ParamType::U8, offsetof(Params, maxIntensity), 0, 255, 255, "level"},
+    {"pulseDecay", ParamType::U16, offsetof(Params, pulseDecay), 0, 2000, 312, "per s"},
+    {"triumphPhaseTime", ParamType::U32, offsetof(Params, triumphPhaseTime), 0, 60000, 3000, "ms"},
+    {"glowPhaseTime", ParamType::U32, offsetof(Params, glowPhaseTime), 0, 60000, 1500, "ms"},
+    {"fadePhaseTime", ParamType::U32, offsetof(Params, fadePhaseTime), 0, 60000, 500, "ms"},
+};
+
+const ParamSchema VictoryVFX::PARAM_SCHEMA = {PARAM_SPECS, sizeof(PARAM_SPECS) / sizeof(PARAM_SPECS[0]), sizeof(Params)};
+
+VictoryVFX::VictoryVFX(Compositor& compositor, Configuration& config)
+    : BaseVFX(compositor, config, "Victory", VFXPriority::ACTIVE) {
+    bindParams(PARAM_SCHEMA, &params);
 }
 
 void VictoryVFX::begin() {
-    Serial.println("VictoryVFX: Initializing");
-    
     // Initialize victory states for all zones
     victoryStates.clear();
-    victoryStates.resize(targetZones.size());
+    victoryStates.resize(getActiveZones().size());
     
     for (auto& state : victoryStates) {
         state.victoryStartTime = 0;
@@ -25,40 +36,34 @@ void VictoryVFX::begin() {
     }
 }
 
-void VictoryVFX::update() {
+void VictoryVFX::update(uint32_t now) {
     if (!enabled) {
         return;
     }
     
-    uint32_t currentTime = millis();
-    
     // Check if duration has expired
-    if (shouldStop()) {
-        Serial.println("VictoryVFX: Duration expired");
+    if (shouldStop(now)) {
         stop();
         return;
     }
     
     // Update victory effect for each target zone
-    for (size_t i = 0; i < targetZones.size(); i++) {
-        Zone* zone = targetZones[i];
+    const std::vector<Zone*>& zones = getActiveZones();
+    for (size_t i = 0; i < zones.size(); i++) {
+        Zone* zone = zones[i];
         if (zone && zone->enabled) {
-            updateVictoryForZone(i, zone);
+            updateVictoryForZone(i, zone, now);
         }
     }
 }
 
 void VictoryVFX::trigger(uint32_t duration) {
-    Serial.printf("VictoryVFX: Triggered with duration %dms\n", duration);
-    
     BaseVFX::trigger(duration);
     
     startVictory();
 }
 
 void VictoryVFX::startVictory() {
-    Serial.printf("VictoryVFX: Starting victory celebration on %d zones\n", targetZones.size());
-    
     uint32_t currentTime = millis();
     
     // Initialize victory state for each zone
@@ -74,49 +79,44 @@ void VictoryVFX::startVictory() {
     }
 }
 
-void VictoryVFX::updateVictoryForZone(size_t zoneIndex, Zone* zone) {
+void VictoryVFX::updateVictoryForZone(size_t zoneIndex, Zone* zone, uint32_t now) {
     if (zoneIndex >= victoryStates.size()) return;
     
     auto& state = victoryStates[zoneIndex];
     if (!state.isCelebrating) return;
     
-    uint32_t currentTime = millis();
-    
-    // Update timing
-    if (currentTime - state.lastUpdate < UPDATE_INTERVAL) {
-        return; // Not time for update yet
-    }
-    
-    state.lastUpdate = currentTime;
-    uint32_t elapsed = currentTime - state.victoryStartTime;
+    uint32_t deltaMs = elapsedSince(now, state.lastUpdate);
+    state.lastUpdate = now;
+    uint32_t elapsed = elapsedSince(now, state.victoryStartTime);
     
     // Determine victory phase based on elapsed time
-    if (elapsed <= TRIUMPH_PHASE_TIME) {
+    if (elapsed <= params.triumphPhaseTime) {
         state.celebrationPhase = 0; // Triumph pulses
         
         // Handle pulse timing
-        if (currentTime - state.lastPulse >= PULSE_INTERVAL && 
-            state.pulseCount < MAX_PULSES) {
-            state.lastPulse = currentTime;
+        if (elapsedSince(now, state.lastPulse) >= params.pulseInterval && 
+            state.pulseCount < params.maxPulses) {
+            state.lastPulse = now;
             state.pulseCount++;
-            state.currentIntensity = MAX_INTENSITY; // Flash to max
+            state.currentIntensity = params.maxIntensity; // Flash to max
         } else {
             // Fade pulse
             if (state.currentIntensity > 0) {
-                state.currentIntensity = max(0, (int)state.currentIntensity - 25);
+                state.currentIntensity = max(0, (int)state.currentIntensity - scaledStep(params.pulseDecay, deltaMs));
             }
         }
         
-    } else if (elapsed <= TRIUMPH_PHASE_TIME + GLOW_PHASE_TIME) {
+    } else if (elapsed <= params.triumphPhaseTime + params.glowPhaseTime) {
         state.celebrationPhase = 1; // Victory glow
         // Steady bright glow with slight pulsing
-        float glowPulse = 0.85 + 0.15 * sin((elapsed - TRIUMPH_PHASE_TIME) * 0.008);
-        state.currentIntensity = (uint8_t)(glowPulse * 200);
+        uint32_t glowElapsed = elapsed - params.triumphPhaseTime;
+        int16_t glowPulse = VFXMath::scaleWave(VFXMath::sin16(glowElapsed * VFXMath::toAngle(0.008)), 30);
+        state.currentIntensity = 170 + glowPulse;
         
-    } else if (elapsed <= TRIUMPH_PHASE_TIME + GLOW_PHASE_TIME + FADE_PHASE_TIME) {
+    } else if (elapsed <= params.triumphPhaseTime + params.glowPhaseTime + params.fadePhaseTime) {
         state.celebrationPhase = 2; // Fade phase
-        uint32_t fadeElapsed = elapsed - TRIUMPH_PHASE_TIME - GLOW_PHASE_TIME;
-        state.currentIntensity = map(fadeElapsed, 0, FADE_PHASE_TIME, 200, 0);
+        uint32_t fadeElapsed = elapsed - params.triumphPhaseTime - params.glowPhaseTime;
+        state.currentIntensity = VFXMath::ramp(fadeElapsed, params.fadePhaseTime, 200, 0);
         
     } else {
         // Victory complete
@@ -127,22 +127,22 @@ void VictoryVFX::updateVictoryForZone(size_t zoneIndex, Zone* zone) {
     // Apply victory effect based on zone type
     if (zone->type == ZoneType::PWM) {
         // For PWM zones, directly control brightness
-        ledController.setZoneBrightness(zone->id, state.currentIntensity);
+        layer.setZoneBrightness(zone->id, state.currentIntensity);
     } else if (zone->type == ZoneType::WS2812B) {
         // For RGB zones, use victory colors
         CRGB victoryColor = getVictoryColor(state.celebrationPhase, state.currentIntensity);
-        ledController.setZoneColor(zone->id, victoryColor);
+        layer.setZoneColor(zone->id, victoryColor);
     }
 }
 
 uint8_t VictoryVFX::calculateVictoryIntensity(uint32_t elapsed, uint8_t phase, uint8_t pulseCount) {
     switch (phase) {
         case 0: // Triumph pulses
-            return (elapsed % PULSE_INTERVAL < 200) ? MAX_INTENSITY : 50;
+            return (elapsed % params.pulseInterval < 200) ? params.maxIntensity : 50;
         case 1: // Victory glow - steady with slight pulse
-            return 180 + (uint8_t)(30 * sin(elapsed * 0.005));
+            return 180 + VFXMath::scaleWave(VFXMath::sin16(elapsed * VFXMath::toAngle(0.005)), 30);
         case 2: // Fade
-            return map(elapsed - TRIUMPH_PHASE_TIME - GLOW_PHASE_TIME, 0, FADE_PHASE_TIME, 180, 0);
+            return VFXMath::ramp(elapsed - params.triumphPhaseTime - params.glowPhaseTime, params.fadePhaseTime, 180, 0);
         default:
             return 0;
     }
@@ -7,11 +7,11 @@ namespace BattleAura {
 
 class VictoryVFX : public BaseVFX {
 public:
-    VictoryVFX(LedController& ledController, Configuration& config);
+    VictoryVFX(Compositor& compositor, Configuration& config);
     
     // BaseVFX implementation
     void begin() override;
-    void update() override;
+    void update(uint32_t now) override;
     void trigger(uint32_t duration = 5000) override; // 5s default duration
     
 private:
@@ -29,15 +29,21 @@ private:
     std::vector<VictoryState> victoryStates;
     
     // Victory parameters
-    static const uint16_t UPDATE_INTERVAL = 80;        // 80ms update rate
-    static const uint16_t PULSE_INTERVAL = 400;        // 400ms between victory pulses
-    static const uint8_t MAX_PULSES = 6;               // Number of triumph pulses
-    static const uint8_t MAX_INTENSITY = 255;          // Peak intensity
-    static const uint32_t TRIUMPH_PHASE_TIME = 3000;   // 3s of triumph pulses
-    static const uint32_t GLOW_PHASE_TIME = 1500;      // 1.5s steady glow
-    static const uint32_t FADE_PHASE_TIME = 500;       // 0.5s fade out
+    // Set from the scene's parameters; PARAM_SPECS has the ranges and defaults
+    struct Params {
+        uint16_t pulseInterval;     // 400ms between victory pulses
+        uint8_t maxPulses;          // Number of triumph pulses
+        uint8_t maxIntensity;       // Peak intensity
+        uint16_t pulseDecay;        // Pulse fade per second
+        uint32_t triumphPhaseTime;  // 3s of triumph pulses
+        uint32_t glowPhaseTime;     // 1.5s steady glow
+        uint32_t fadePhaseTime;     // 0.5s fade out
+    };
+    Params params;
+    static const ParamSpec PARAM_SPECS[];
+    static const ParamSchema PARAM_SCHEMA;
     
-    void updateVictoryForZone(size_t zoneIndex, Zone* zone);
+    void updateVictoryForZone(size_t zoneIndex, Zone* zone, uint32_t now);
     void startVictory();
     uint8_t calculateVictoryIntensity(uint32_t elapsed, uint8_t phase, uint8_t pulseCount);
     CRGB getVictoryColor(uint8_t phase, uint8_t intensity);
@@ -3,14 +3,21 @@
 
 namespace BattleAura {
 
-WeaponFireVFX::WeaponFireVFX(LedController& ledController, Configuration& config) 
-    : BaseVFX(ledController, config, "MachineGun", VFXPriority::ACTIVE) {
+const ParamSpec WeaponFireVFX::PARAM_SPECS[] = {
+    {"flashInterval", ParamType::U16, offsetof(Params, flashInterval), 2, 1000, 50, "ms"},
+    {"maxFlashes", ParamType::U8, offsetof(Params, maxFlashes), 1, 50, 8, "count"},
+    {"flashBrightness", ParamType::U8, offsetof(Params, flashBrightness), 0, 255, 255, "level"},
+};
+
+const ParamSchema WeaponFireVFX::PARAM_SCHEMA = {PARAM_SPECS, sizeof(PARAM_SPECS) / sizeof(PARAM_SPECS[0]), sizeof(Params)};
+
+WeaponFireVFX::WeaponFireVFX(Compositor& compositor, Configuration& config) 
+    : BaseVFX(compositor, config, "MachineGun", VFXPriority::ACTIVE) {
+    bindParams(PARAM_SCHEMA, &params);
 }
 
 void WeaponFireVFX::begin() {
-    Serial.println("MachineGun: Initializing...");
-    
-    std::vector<Zone*> zones = hasTargetZones() ? getTargetZones() : config.getAllZones();
+    const std::vector<Zone*>& zones = getActiveZones();
     fireStates.clear();
     fireStates.resize(zones.size());
     
@@ -18,13 +25,11 @@ void WeaponFireVFX::begin() {
     for (size_t i = 0; i < zones.size(); i++) {
         FireState& state = fireStates[i];
         state.fireStartTime = 0;
-        state.flashPattern = random(0, 4); // Different flash patterns
+        state.flashPattern = rng.below(4); // Different flash patterns
         state.lastFlash = 0;
         state.flashCount = 0;
         state.isFlashing = false;
     }
-    
-    Serial.printf("MachineGun: Initialized for %d zones\n", zones.size());
 }
 
 void WeaponFireVFX::trigger(uint32_t duration) {
@@ -32,16 +37,16 @@ void WeaponFireVFX::trigger(uint32_t duration) {
     startFiring();
 }
 
-void WeaponFireVFX::update() {
+void WeaponFireVFX::update(uint32_t now) {
     if (!enabled) return;
     
     // Check if timed VFX should stop
-    if (shouldStop()) {
+    if (shouldStop(now)) {
         stop();
         return;
     }
     
-    std::vector<Zone*> zones = hasTargetZones() ? getTargetZones() : config.getAllZones();
+    const std::vector<Zone*>& zones = getActiveZones();
     
     // Ensure we have fire states for all zones
     if (fireStates.size() != zones.size()) {
@@ -50,7 +55,7 @@ void WeaponFireVFX::update() {
     
     for (size_t i = 0; i < zones.size(); i++) {
         if (i < fireStates.size()) {
-            updateFireForZone(i, zones[i]);
+            updateFireForZone(i, zones[i], now);
         }
     }
 }
@@ -69,36 +74,35 @@ void WeaponFireVFX::startFiring() {
     }
 }
 
-void WeaponFireVFX::updateFireForZone(size_t zoneIndex, Zone* zone) {
+void WeaponFireVFX::updateFireForZone(size_t zoneIndex, Zone* zone, uint32_t now) {
     if (!zone || !zone->enabled) return;
     
     FireState& state = fireStates[zoneIndex];
-    uint32_t currentTime = millis();
     
     if (!state.isFlashing) return;
     
     // Check if it's time for next flash
-    if (currentTime - state.lastFlash >= FLASH_INTERVAL) {
+    if (elapsedSince(now, state.lastFlash) >= params.flashInterval) {
         state.flashCount++;
-        state.lastFlash = currentTime;
+        state.lastFlash = now;
         
         // Stop flashing after max flashes
-        if (state.flashCount >= MAX_FLASHES) {
+        if (state.flashCount >= params.maxFlashes) {
             state.isFlashing = false;
         }
     }
     
     // Determine current brightness based on flash timing
     uint8_t brightness = 0;
-    uint32_t flashTime = currentTime - state.lastFlash;
+    uint32_t flashTime = elapsedSince(now, state.lastFlash);
     
-    if (state.isFlashing && flashTime < (FLASH_INTERVAL / 2)) {
+    if (state.isFlashing && flashTime < (params.flashInterval / 2)) {
         // Flash on for first half of interval
         switch (state.flashPattern) {
-            case 0: brightness = FLASH_BRIGHTNESS; break;                    // Full flash
-            case 1: brightness = FLASH_BRIGHTNESS * 0.8; break;             // Slightly dimmer
-            case 2: brightness = (state.flashCount % 2) ? FLASH_BRIGHTNESS : FLASH_BRIGHTNESS * 0.6; break; // Alternating
-            case 3: brightness = FLASH_BRIGHTNESS - (state.flashCount * 20); break; // Diminishing
+            case 0: brightness = params.flashBrightness; break;                    // Full flash
+            case 1: brightness = params.flashBrightness * 4 / 5; break;             // Slightly dimmer
+            case 2: brightness = (state.flashCount % 2) ? params.flashBrightness : params.flashBrightness * 3 / 5; break; // Alternating
+            case 3: brightness = max(0, params.flashBrightness - state.flashCount * 20); break; // Diminishing, down to off
         }
         
         // Clamp brightness
@@ -108,7 +112,7 @@ void WeaponFireVFX::updateFireForZone(size_t zoneIndex, Zone* zone) {
     // Apply to LED controller - adapt to zone type
     if (zone->type == ZoneType::PWM) {
         // PWM zones: rapid bright flashes
-        ledController.setZoneBrightness(zone->id, brightness);
+        layer.setZoneBrightness(zone->id, brightness);
     } else if (zone->type == ZoneType::WS2812B) {
         // RGB zones: bright white/yellow weapon flashes
         CRGB weaponColor;
@@ -117,7 +121,7 @@ void WeaponFireVFX::updateFireForZone(size_t zoneIndex, Zone* zone) {
         } else {
             weaponColor = CRGB::Black;
         }
-        ledController.setZoneColorAndBrightness(zone->id, weaponColor, brightness);
+        layer.setZoneColorAndBrightness(zone->id, weaponColor, brightness);
     }
 }
 
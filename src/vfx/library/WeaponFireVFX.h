@@ -7,11 +7,11 @@ namespace BattleAura {
 
 class WeaponFireVFX : public BaseVFX {
 public:
-    WeaponFireVFX(LedController& ledController, Configuration& config);
+    WeaponFireVFX(Compositor& compositor, Configuration& config);
     
     // BaseVFX implementation
     void begin() override;
-    void update() override;
+    void update(uint32_t now) override;
     void trigger(uint32_t duration = 1500) override; // 1.5s default duration
     
 private:
@@ -27,11 +27,17 @@ private:
     std::vector<FireState> fireStates;
     
     // Weapon fire parameters
-    static const uint16_t FLASH_INTERVAL = 50;      // 50ms between flashes
-    static const uint8_t MAX_FLASHES = 8;           // Up to 8 rapid flashes
-    static const uint8_t FLASH_BRIGHTNESS = 255;    // Maximum brightness during flash
+    // Set from the scene's parameters; PARAM_SPECS has the ranges and defaults
+    struct Params {
+        uint16_t flashInterval;   // 50ms between flashes
+        uint8_t maxFlashes;       // Up to 8 rapid flashes
+        uint8_t flashBrightness;  // Maximum brightness during flash
+    };
+    Params params;
+    static const ParamSpec PARAM_SPECS[];
+    static const ParamSchema PARAM_SCHEMA;
     
-    void updateFireForZone(size_t zoneIndex, Zone* zone);
+    void updateFireForZone(size_t zoneIndex, Zone* zone, uint32_t now);
     void startFiring();
 };
 
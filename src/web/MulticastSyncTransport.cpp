@@ -0,0 +1,28 @@
+#include "MulticastSyncTransport.h"
+
+namespace BattleAura {
+
+MulticastSyncTransport::MulticastSyncTransport(SyncGroup& group)
+    : group(group), groupAddress(239, 66, 65, 1) {
+}
+
+bool MulticastSyncTransport::begin() {
+    if (!udp.listenMulticast(groupAddress, SyncGroup::PORT)) {
+        Serial.printf("MulticastSyncTransport: Failed to join %s:%d\n", groupAddress.toString().c_str(), SyncGroup::PORT);
+        return false;
+    }
+    
+    // Stamp arrival here, before the datagram waits in the queue
+    udp.onPacket([this](AsyncUDPPacket& packet) {
+        group.receive(packet.data(), packet.length(), micros());
+    });
+    
+    Serial.printf("MulticastSyncTransport: Joined %s:%d\n", groupAddress.toString().c_str(), SyncGroup::PORT);
+    return true;
+}
+
+bool MulticastSyncTransport::send(const uint8_t* data, size_t length) {
+    return udp.writeTo(data, length, groupAddress, SyncGroup::PORT) == length;
+}
+
+} // namespace BattleAura
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AsyncUDP.h>
+#include "../sync/SyncGroup.h"
+
+namespace BattleAura {
+
+// Carries sync group messages as UDP multicast on the local network. Works
+// the same on a home network and on the device's own access point.
+class MulticastSyncTransport : public SyncTransport {
+public:
+    MulticastSyncTransport(SyncGroup& group);
+    
+    // Join the group address; call once WiFi is up
+    bool begin();
+    
+    bool send(const uint8_t* data, size_t length) override;
+
+private:
+    SyncGroup& group;
+    AsyncUDP udp;
+    const IPAddress groupAddress;
+};
+
+} // namespace BattleAura
@@ -0,0 +1,121 @@
+#include "TriggerServer.h"
+
+namespace BattleAura {
+
+TriggerServer::TriggerServer(VFXManager& vfxManager) : vfxManager(vfxManager) {
+}
+
+bool TriggerServer::begin() {
+    if (!udp.listen(PORT)) {
+        Serial.printf("TriggerServer: Failed to listen on UDP port %d\n", PORT);
+        return false;
+    }
+    
+    udp.onPacket([this](AsyncUDPPacket& packet) {
+        handlePacket(packet);
+    });
+    
+    Serial.printf("TriggerServer: Listening on UDP port %d, %d scenes\n", PORT, vfxManager.getSceneCount());
+    return true;
+}
+
+void TriggerServer::handlePacket(AsyncUDPPacket& packet) {
+    const uint8_t* data = packet.data();
+    if (packet.length() != REQUEST_SIZE || data[0] != 'B' || data[1] != 'T') {
+        stats.malformed++;
+        return;
+    }
+    stats.received++;
+    
+    uint8_t command = data[2] & ~ACK_REQUESTED;
+    uint8_t sceneId = data[3];
+    uint16_t sequence = data[4] | ((uint16_t)data[5] << 8);
+    uint32_t duration = (uint32_t)data[6] | ((uint32_t)data[7] << 8) |
+                        ((uint32_t)data[8] << 16) | ((uint32_t)data[9] << 24);
+    
+    TriggerStatus status;
+    Sender* sender = findSender(packet.remoteIP(), packet.remotePort());
+    if (sender && sender->sequences.isSettled(sequence)) {
+        status = TriggerStatus::DUPLICATE;
+        stats.duplicates++;
+    } else {
+        status = apply(command, sceneId, duration);
+        
+        // Only once it is settled; a BUSY trigger is still to be resent
+        if (status != TriggerStatus::BUSY) {
+            recordSequence(sender, packet.remoteIP(), packet.remotePort(), sequence);
+        }
+    }
+    
+    if (data[2] & ACK_REQUESTED) {
+        uint8_t ack[ACK_SIZE] = {'B', 'A', (uint8_t)status, sceneId, (uint8_t)sequence, (uint8_t)(sequence >> 8)};
+        packet.write(ack, sizeof(ack));
+        stats.acksSent++;
+    }
+}
+
+TriggerStatus TriggerServer::apply(uint8_t command, uint8_t sceneId, uint32_t duration) {
+    if (sceneId >= vfxManager.getSceneCount()) {
+        stats.rejected++;
+        return TriggerStatus::UNKNOWN_SCENE;
+    }
+    
+    bool queued;
+    switch ((TriggerCommand)command) {
+        case TriggerCommand::TRIGGER:
+            queued = vfxManager.requestTriggerById(sceneId, duration);
+            break;
+        case TriggerCommand::STOP:
+            queued = vfxManager.requestStopById(sceneId);
+            break;
+        default:
+            stats.rejected++;
+            return TriggerStatus::BAD_COMMAND;
+    }
+    
+    if (!queued) {
+        stats.rejected++;
+        return TriggerStatus::BUSY;
+    }
+    stats.applied++;
+    return TriggerStatus::OK;
+}
+
+TriggerServer::Sender* TriggerServer::findSender(const IPAddress& address, uint16_t port) {
+    for (Sender& sender : senders) {
+        if (sender.port == port && sender.address == address) {
+            sender.lastSeen = millis();
+            return &sender;
+        }
+    }
+    return nullptr;
+}
+
+void TriggerServer::recordSequence(Sender* sender, const IPAddress& address, uint16_t port, uint16_t sequence) {
+    uint32_t now = millis();
+    
+    // First settled datagram from this controller: take a free slot, or
+    // failing that the one idle longest
+    if (!sender) {
+        sender = &senders[0];
+        for (Sender& slot : senders) {
+            if (sender->port != 0 && (slot.port == 0 || now - slot.lastSeen > now - sender->lastSeen)) {
+                sender = &slot;
+            }
+        }
+        sender->address = address;
+        sender->port = port;
+        sender->sequences = SequenceWindow();
+    }
+    
+    sender->sequences.settle(sequence);
+    sender->lastSeen = now;
+}
+
+void TriggerServer::printStatus() const {
+    Serial.printf("TriggerServer: %lu received, %lu applied, %lu duplicates, %lu rejected, %lu malformed, %lu acks\n",
+                  (unsigned long)stats.received, (unsigned long)stats.applied, (unsigned long)stats.duplicates,
+                  (unsigned long)stats.rejected, (unsigned long)stats.malformed, (unsigned long)stats.acksSent);
+}
+
+} // namespace BattleAura
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AsyncUDP.h>
+#include "../vfx/VFXManager.h"
+#include "../core/SequenceWindow.h"
+
+namespace BattleAura {
+
+// Binary trigger protocol over UDP for table controllers: one datagram is one
+// trigger, with no connection setup and no JSON. Scenes are addressed by ID,
+// their index in GET /api/vfx.
+//
+// Request, 10 bytes little endian:
+//   0 "BT", 2 uint8 command (TriggerCommand, | ACK_REQUESTED for an ack),
+//   3 uint8 scene ID, 4 uint16 sequence, 6 uint32 duration ms (0 = continuous)
+// Ack, 6 bytes:
+//   0 "BA", 2 uint8 TriggerStatus, 3 uint8 scene ID, 4 uint16 sequence
+//
+// Sequence numbers count up per sender. A datagram whose sequence was already
+// settled is a retransmit and is acked again as DUPLICATE without being
+// applied, so a controller can resend until it sees an ack. A BUSY trigger
+// wasn't applied, so its sequence isn't settled and a resend can still run,
+// even after newer ones. One far behind is taken as the controller having
+// restarted (see SequenceWindow).
+
+enum class TriggerCommand : uint8_t {
+    TRIGGER = 1,
+    STOP = 2
+};
+
+enum class TriggerStatus : uint8_t {
+    OK = 0,
+    DUPLICATE = 1,      // Already applied
+    UNKNOWN_SCENE = 2,
+    BUSY = 3,           // Command queue full, try again
+    BAD_COMMAND = 4
+};
+
+struct TriggerStats {
+    uint32_t received;          // Well-formed datagrams
+    uint32_t applied;           // Queued for the render loop
+    uint32_t duplicates;        // Retransmits, acked but not applied
+    uint32_t rejected;          // Unknown scene, bad command or queue full
+    uint32_t malformed;         // Wrong size or magic, dropped without an ack
+    uint32_t acksSent;
+};
+
+class TriggerServer {
+public:
+    static const uint16_t PORT = 4210;
+    static const uint8_t ACK_REQUESTED = 0x80;
+    static const size_t REQUEST_SIZE = 10;
+    static const size_t ACK_SIZE = 6;
+    
+    TriggerServer(VFXManager& vfxManager);
+    
+    // Start listening; call once WiFi is up and VFXManager has begun
+    bool begin();
+    
+    // Status
+    const TriggerStats& getStats() const { return stats; }
+    void printStatus() const;
+
+private:
+    // Settled sequences per controller. Packets arrive on the UDP task only,
+    // so this needs no locking.
+    struct Sender {
+        IPAddress address;
+        uint16_t port = 0;
+        SequenceWindow sequences;
+        uint32_t lastSeen = 0;      // millis(), to pick a slot to reuse
+    };
+    static const uint8_t MAX_SENDERS = 4;
+    
+    VFXManager& vfxManager;
+    AsyncUDP udp;
+    Sender senders[MAX_SENDERS];
+    TriggerStats stats = {};
+    
+    void handlePacket(AsyncUDPPacket& packet);
+    TriggerStatus apply(uint8_t command, uint8_t sceneId, uint32_t duration);
+    Sender* findSender(const IPAddress& address, uint16_t port);
+    void recordSequence(Sender* sender, const IPAddress& address, uint16_t port, uint16_t sequence);
+};
+
+} // namespace BattleAura
@@ -1,1547 +1,447 @@
 #pragma once
 
+// Generated by tools/build_web.py from index.html - do not edit.
+// 67710 bytes, 42308 minified, 8636 gzipped
+
 #include <Arduino.h>
 
 namespace BattleAura {
 
-// Embedded web interface as PROGMEM strings
-const char MAIN_HTML[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>BattleAura Controller</title>
-    <style>
-        body { 
-            font-family: Arial, sans-serif; 
-            margin: 0; 
-            padding: 20px; 
-            background: #1a1a1a; 
-            color: #fff; 
-        }
-        .container { 
-            max-width: 600px; 
-            margin: 0 auto; 
-        }
-        h1 { 
-            text-align: center; 
-            color: #4CAF50; 
-            margin-bottom: 30px; 
-        }
-        .zone-card { 
-            background: #2d2d2d; 
-            border-radius: 8px; 
-            padding: 20px; 
-            margin: 10px 0; 
-            border: 1px solid #444; 
-        }
-        .zone-name { 
-            font-size: 18px; 
-            font-weight: bold; 
-            margin-bottom: 10px; 
-            color: #4CAF50; 
-        }
-        .zone-info { 
-            color: #aaa; 
-            font-size: 14px; 
-            margin-bottom: 15px; 
-        }
-        .brightness-control { 
-            display: flex; 
-            align-items: center; 
-            gap: 10px; 
-        }
-        .brightness-slider { 
-            flex: 1; 
-            height: 6px; 
-            border-radius: 3px; 
-            background: #444; 
-            outline: none; 
-        }
-        .brightness-value { 
-            min-width: 40px; 
-            text-align: right; 
-            font-weight: bold; 
-        }
-        .status { 
-            text-align: center; 
-            padding: 10px; 
-            margin: 20px 0; 
-            border-radius: 4px; 
-            background: #333; 
-            border: 1px solid #555; 
-        }
-        .loading { 
-            color: #ff9800; 
-        }
-        .error { 
-            color: #f44336; 
-            background: #2d1b1b; 
-            border-color: #f44336; 
-        }
-        .success { 
-            color: #4CAF50; 
-            background: #1b2d1b; 
-            border-color: #4CAF50; 
-        }
-        .footer { 
-            text-align: center; 
-            margin-top: 40px; 
-            padding-top: 20px; 
-            border-top: 1px solid #444; 
-            color: #666; 
-            font-size: 12px; 
-        }
-        .nav-tabs {
-            display: flex;
-            margin-bottom: 20px;
-            border-bottom: 1px solid #444;
-        }
-        .tab-btn {
-            padding: 10px 20px;
-            background: #333;
-            color: #ccc;
-            border: none;
-            border-bottom: 2px solid transparent;
-            cursor: pointer;
-            margin-right: 5px;
-        }
-        .tab-btn.active {
-            color: #4CAF50;
-            border-bottom-color: #4CAF50;
-        }
-        .tab-btn:hover {
-            background: #444;
-        }
-        .config-tab {
-            display: none;
-        }
-        .config-tab.active {
-            display: block;
-        }
-        .form-row {
-            display: flex;
-            align-items: center;
-            margin: 10px 0;
-            gap: 10px;
-        }
-        .form-row label {
-            min-width: 100px;
-        }
-        .form-row input, .form-row select {
-            flex: 1;
-            padding: 5px;
-            border: 1px solid #555;
-            background: #333;
-            color: white;
-            border-radius: 3px;
-        }
-        .btn {
-            padding: 10px 20px;
-            background: #4CAF50;
-            color: white;
-            border: none;
-            border-radius: 4px;
-            cursor: pointer;
-            margin: 5px;
-            font-size: 14px;
-        }
-        .btn:hover { 
-            background: #45a049; 
-        }
-        .btn:disabled { 
-            background: #666; 
-            cursor: not-allowed; 
-        }
-        .btn-success {
-            background: #4CAF50;
-        }
-        .btn-danger {
-            background: #f44336;
-        }
-        .btn-danger:hover {
-            background: #da190b;
-        }
-        .section {
-            margin: 30px 0;
-            padding: 20px;
-            background: #2d2d2d;
-            border-radius: 8px;
-            border: 1px solid #444;
-        }
-        .section h2 {
-            color: #4CAF50;
-            margin-top: 0;
-            margin-bottom: 20px;
-            border-bottom: 1px solid #444;
-            padding-bottom: 10px;
-        }
-        .zone-form {
-            margin-bottom: 20px;
-        }
-        .form-row {
-            display: flex;
-            align-items: center;
-            margin-bottom: 15px;
-            gap: 10px;
-            max-width: 400px;
-            flex-wrap: wrap;
-        }
-        .form-row label {
-            min-width: 120px;
-            color: #ccc;
-        }
-        .form-row input, .form-row select {
-            flex: none;
-            width: 180px;
-            padding: 8px;
-            background: #1a1a1a;
-            border: 1px solid #555;
-            color: #fff;
-            border-radius: 4px;
-        }
-        .form-row input:focus, .form-row select:focus {
-            border-color: #4CAF50;
-            outline: none;
-        }
-        #brightnessValue {
-            min-width: 40px;
-            text-align: center;
-            color: #4CAF50;
-            font-weight: bold;
-        }
-    </style>
-</head>
-<body>
-    <div class="container">
-        <h1>BattleAura Controller</h1>
-        
-        <div id="status" class="status loading">
-            Loading system...
-        </div>
-        
-        <!-- VFX Control Section - Primary Use Case -->
-        <div class="section">
-            <h2>VFX Controls</h2>
-            <p>Quick access to trigger VFX on your configured zones</p>
-            <div id="vfx-container">
-                <!-- VFX will be populated here -->
-            </div>
-        </div>
-        
-        <!-- Global Controls -->
-        <div class="section">
-            <h2>Global Controls</h2>
-            <div class="zone-card">
-                <div class="zone-name">Master Controls</div>
-                <div style="margin-top: 15px;">
-                    <div class="form-row">
-                        <label for="global-brightness">Global Brightness (0-255):</label>
-                        <input type="range" id="global-brightness" min="0" max="255" value="255" oninput="setGlobalBrightness(this.value)">
-                        <span id="global-brightness-value">255</span>
-                    </div>
-                    <div style="margin-top: 10px;">
-                        <button onclick="stopAllVFX()" class="btn btn-danger" style="margin-right: 10px;">Stop All VFX</button>
-                        <button onclick="setAllZonesBrightness(0)" class="btn" style="margin-right: 10px; background: #666;">Lights Off</button>
-                        <button onclick="setAllZonesBrightness(255)" class="btn" style="background: #ff9800;">Lights On</button>
-                    </div>
-                </div>
-            </div>
-        </div>
-        
-        <!-- Quick Audio Controls -->
-        <div class="section">
-            <h2>Audio Player</h2>
-            <div class="zone-card">
-                <div class="zone-name">Manual Audio Control</div>
-                <div class="zone-info">
-                    Status: <span id="audio-status">Unknown</span> | 
-                    Track: <span id="current-track">None</span>
-                </div>
-                <div style="margin-top: 15px;">
-                    <div class="form-row">
-                        <label for="track-number">Track (1-9):</label>
-                        <input type="number" id="track-number" min="1" max="9" value="1" style="width: 60px; flex: none;">
-                        <input type="checkbox" id="loop-audio" style="margin-left: 15px; flex: none; width: auto;">
-                        <label for="loop-audio" style="margin-left: 8px; flex: none; min-width: auto;">Loop</label>
-                        <button onclick="playAudio()" class="btn btn-success" style="margin-left: 10px;">Play</button>
-                        <button onclick="stopAudio()" class="btn btn-danger">Stop</button>
-                    </div>
-                    <div class="form-row">
-                        <label for="audio-volume">Volume:</label>
-                        <input type="range" id="audio-volume" min="0" max="30" value="15" oninput="setVolume(this.value)">
-                        <span id="volume-value">15</span>
-                    </div>
-                </div>
-            </div>
-        </div>
-        
-        <!-- Configuration Section -->
-        <div class="section" id="config-section" style="display: none;">
-            <h2>Configuration</h2>
-            <div class="nav-tabs">
-                <button class="tab-btn active" onclick="showConfigTab('zones')">Zones</button>
-                <button class="tab-btn" onclick="showConfigTab('scenes')">Scenes & Audio</button>
-                <button class="tab-btn" onclick="showConfigTab('device')">Device</button>
-                <button class="tab-btn" onclick="showConfigTab('system')">System</button>
-            </div>
-            
-            <!-- Zones Config Tab -->
-            <div id="config-zones" class="config-tab active">
-                <h3>Zone Management</h3>
-                <div class="zone-form">
-                    <div class="form-row">
-                        <label for="newZoneName">Name:</label>
-                        <input type="text" id="newZoneName" placeholder="e.g., Engine LED">
-                    </div>
-                    <div class="form-row">
-                        <label for="newZoneGpio">GPIO Pin:</label>
-                        <input type="number" id="newZoneGpio" min="2" max="21" placeholder="2-10, 20-21">
-                    </div>
-                    <div class="form-row">
-                        <label for="newZoneType">Type:</label>
-                        <select id="newZoneType">
-                            <option value="PWM">PWM (Single LED)</option>
-                            <option value="WS2812B">WS2812B (RGB Strip)</option>
-                        </select>
-                    </div>
-                    <div class="form-row" id="newLedCountRow" style="display:none;">
-                        <label for="newLedCount">LED Count:</label>
-                        <input type="number" id="newLedCount" min="1" max="100" value="5">
-                    </div>
-                    <div class="form-row">
-                        <label for="newZoneGroup">Group:</label>
-                        <input type="text" id="newZoneGroup" placeholder="e.g., Engines, Weapons" value="Default">
-                    </div>
-                    <button onclick="addNewZone()" class="btn btn-success">Add Zone</button>
-                    <button onclick="clearAllZones()" class="btn btn-danger">Clear All Zones</button>
-                </div>
-                <div id="configured-zones-list">
-                    <h4>Configured Zones</h4>
-                    <div id="zones-config-list"></div>
-                </div>
-            </div>
-            
-            <!-- Scenes & Audio Config Tab -->
-            <div id="config-scenes" class="config-tab">
-                <h3>Audio Tracks</h3>
-                <p>Configure audio files for scenes. Files must be named 0001.mp3, 0002.mp3, etc. on SD card.</p>
-                <div class="form-row">
-                    <label>File Number:</label>
-                    <input type="number" id="trackNumber" min="1" max="999" value="1">
-                    <label>Description:</label>
-                    <input type="text" id="trackDescription" placeholder="Track description">
-                    <input type="checkbox" id="trackLoop" style="flex: none; width: auto;"> <label for="trackLoop" style="flex: none;">Loop</label>
-                    <button onclick="addAudioTrack()" class="btn">Add Track</button>
-                </div>
-                <div id="audio-tracks-list"></div>
-                
-                <h3 style="margin-top: 30px;">VFX Scene Configuration</h3>
-                <p>Configure which VFX apply to which groups and their audio associations.</p>
-                <div class="form-row">
-                    <label>VFX:</label>
-                    <select id="vfxName">
-                        <!-- Will be populated from available VFX -->
-                    </select>
-                </div>
-                <div class="form-row">
-                    <label>Groups:</label>
-                    <div id="vfxGroups" style="flex: 1; max-width: 300px; background: #1a1a1a; border: 1px solid #555; border-radius: 4px; padding: 8px; max-height: 100px; overflow-y: auto;">
-                        <!-- Will be populated with checkboxes for each group -->
-                        <div style="color: #666; font-style: italic;">No zones configured</div>
-                    </div>
-                </div>
-                <div class="form-row">
-                    <label>Audio Track:</label>
-                    <select id="vfxAudio">
-                        <option value="0">None</option>
-                        <!-- Will be populated from audio tracks -->
-                    </select>
-                </div>
-                <div class="form-row">
-                    <label>Audio Timeout (seconds):</label>
-                    <input type="number" id="vfxAudioTimeout" placeholder="0 = no timeout" min="0" value="0" style="width: 120px;">
-                    <small style="color: #666; margin-left: 10px;">Leave 0 for no timeout (plays full track)</small>
-                </div>
-                <div class="form-row">
-                    <button onclick="addSceneConfig()" class="btn">Configure Scene</button>
-                </div>
-                <div id="scene-configs-list"></div>
-            </div>
-            
-            <!-- Device Config Tab -->
-            <div id="config-device" class="config-tab">
-                <h3>Device Information</h3>
-                <div class="zone-card" style="margin-bottom: 20px;">
-                    <div class="zone-name">Current Status</div>
-                    <div class="zone-info">
-                        WiFi: <span id="wifi-status">Checking...</span> | 
-                        Network: <span id="wifi-ssid">None</span> |
-                        IP: <span id="wifi-ip">Unknown</span> |
-                        Hostname: <span id="device-hostname">Unknown</span>
-                    </div>
-                    <div style="margin-top: 10px;">
-                        <button onclick="refreshWiFiStatus()" class="btn">Refresh Status</button>
-                    </div>
-                </div>
-                
-                <h3>WiFi Configuration</h3>
-                <div class="form-row">
-                    <label for="deviceName">Device Name:</label>
-                    <input type="text" id="deviceName" placeholder="e.g., BattleTank" maxlength="32">
-                    <small style="color: #666; margin-left: 10px;">Used for hostname (e.g., battletank.local)</small>
-                </div>
-                <div class="form-row">
-                    <label for="wifiNetwork">Network Name (SSID):</label>
-                    <input type="text" id="wifiNetwork" placeholder="e.g., MyWiFi" maxlength="32">
-                </div>
-                <form>
-                    <input type="text" name="username" autocomplete="username" style="display: none;">
-                    <div class="form-row">
-                        <label for="wifiPassword">Password:</label>
-                        <input type="password" id="wifiPassword" name="password" placeholder="WiFi Password" maxlength="64" autocomplete="new-password">
-                        <input type="checkbox" id="showPassword" style="margin-left: 10px; flex: none; width: auto;">
-                        <label for="showPassword" style="margin-left: 5px; flex: none;">Show</label>
-                    </div>
-                </form>
-                <div style="margin-top: 10px;">
-                    <button onclick="saveWiFiConfig()" class="btn btn-success" style="margin-right: 10px;">Save & Connect</button>
-                    <button onclick="clearWiFiConfig()" class="btn btn-danger">Clear WiFi</button>
-                </div>
-                
-                <h3 style="margin-top: 30px;">Audio Settings</h3>
-                <div class="form-row">
-                    <label for="audioEnabled">Audio Enabled:</label>
-                    <input type="checkbox" id="audioEnabled" checked style="flex: none; width: auto;">
-                </div>
-                <button onclick="saveDeviceConfig()" class="btn btn-success">Save Device Settings</button>
-            </div>
-            
-            <!-- System Config Tab -->
-            <div id="config-system" class="config-tab">
-                <h3>System Management</h3>
-                <div style="margin: 20px 0;">
-                    <button onclick="restartDevice()" class="btn btn-warning">Restart Device</button>
-                    <button onclick="factoryReset()" class="btn btn-danger">Factory Reset</button>
-                </div>
-                
-                <h3>Firmware Update</h3>
-                <p>Upload new firmware via OTA</p>
-                <div style="margin-top: 15px;">
-                    <input type="file" id="firmwareFile" accept=".bin" style="margin-bottom: 10px; width: 100%;">
-                    <button onclick="uploadFirmware()" class="btn btn-success" style="width: 100%; padding: 10px;">
-                        Upload Firmware
-                    </button>
-                    <div id="upload-progress" style="margin-top: 10px; display: none;">
-                        <div style="background: #444; border-radius: 4px; overflow: hidden;">
-                            <div id="progress-bar" style="background: #4CAF50; height: 20px; width: 0%; transition: width 0.3s;"></div>
-                        </div>
-                        <span id="progress-text">0%</span>
-                    </div>
-                </div>
-            </div>
-        </div>
-        
-        <div style="text-align: center; margin: 30px 0;">
-            <button onclick="toggleConfig()" class="btn" id="config-toggle">Show Configuration</button>
-        </div>
-        
-        <div class="footer">
-            <span id="firmware-info">BattleAura Loading...</span><br>
-            <span id="device-info"></span>
-        </div>
-    </div>
-
-    <script>
-        let zones = [];
-        
-        // Initialize on page load
-        document.addEventListener('DOMContentLoaded', function() {
-            loadZones();
-            loadStatus();
-            loadVFX();
-            loadGlobalBrightness();
-            setupNewZoneForm();
-            setTimeout(() => {
-                loadAudioTracks();
-                loadSceneConfigs();
-                loadAvailableVFX();
-                populateAvailableGroups();
-            }, 1000);
-        });
-        
-        // Configuration functions
-        function toggleConfig() {
-            const section = document.getElementById('config-section');
-            const btn = document.getElementById('config-toggle');
-            
-            if (section && btn) {
-                if (section.style.display === 'none' || section.style.display === '') {
-                    section.style.display = 'block';
-                    btn.textContent = 'Hide Configuration';
-                } else {
-                    section.style.display = 'none';
-                    btn.textContent = 'Show Configuration';
-                }
-            }
-        }
-        
-        function showConfigTab(tabName) {
-            // Hide all tabs
-            document.querySelectorAll('.config-tab').forEach(tab => {
-                tab.classList.remove('active');
-            });
-            document.querySelectorAll('.tab-btn').forEach(btn => {
-                btn.classList.remove('active');
-            });
-            
-            // Show selected tab
-            const targetTab = document.getElementById('config-' + tabName);
-            if (targetTab && event && event.target) {
-                targetTab.classList.add('active');
-                event.target.classList.add('active');
-            }
-        }
-        
-        async function addNewZone() {
-            const name = document.getElementById('newZoneName')?.value.trim();
-            const gpio = parseInt(document.getElementById('newZoneGpio')?.value);
-            const type = document.getElementById('newZoneType')?.value;
-            const group = document.getElementById('newZoneGroup')?.value.trim();
-            
-            if (!name || !group || !gpio) {
-                updateStatus('error', 'Please fill all zone fields');
-                return;
-            }
-            
-            try {
-                const response = await fetch('/api/zones', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({
-                        name: name,
-                        gpio: gpio,
-                        type: type,
-                        groupName: group,
-                        brightness: 255,
-                        ledCount: type === 'WS2812B' ? parseInt(document.getElementById('newLedCount')?.value) || 5 : 1,
-                        enabled: true
-                    })
-                });
-                
-                const result = await response.json();
-                if (response.ok) {
-                    updateStatus('success', 'Zone added successfully');
-                    const nameField = document.getElementById('newZoneName');
-                    const groupField = document.getElementById('newZoneGroup');
-                    if (nameField) nameField.value = '';
-                    if (groupField) groupField.value = 'Default';
-                    loadZones();
-                } else {
-                    updateStatus('error', result.error || 'Failed to add zone');
-                }
-            } catch (error) {
-                updateStatus('error', 'Failed to add zone: ' + error.message);
-            }
-        }
-        
-        async function addAudioTrack() {
-            const fileNumber = parseInt(document.getElementById('trackNumber')?.value);
-            const description = document.getElementById('trackDescription')?.value.trim();
-            const isLoop = document.getElementById('trackLoop')?.checked;
-            
-            if (!description) {
-                updateStatus('error', 'Please enter track description');
-                return;
-            }
-            
-            try {
-                const response = await fetch('/api/audio/tracks', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({
-                        fileNumber: fileNumber,
-                        description: description,
-                        isLoop: isLoop,
-                        duration: 0
-                    })
-                });
-                
-                const result = await response.json();
-                if (response.ok) {
-                    updateStatus('success', 'Audio track added');
-                    const descField = document.getElementById('trackDescription');
-                    if (descField) descField.value = '';
-                    loadAudioTracks();
-                } else {
-                    updateStatus('error', result.error || 'Failed to add audio track');
-                }
-            } catch (error) {
-                updateStatus('error', 'Failed to add audio track: ' + error.message);
-            }
-        }
-        
-        async function loadAudioTracks() {
-            try {
-                const response = await fetch('/api/audio/tracks');
-                if (!response.ok) return;
-                
-                const data = await response.json();
-                const container = document.getElementById('audio-tracks-list');
-                
-                if (!container) return; // Element doesn't exist yet
-                
-                if (!data.tracks || data.tracks.length === 0) {
-                    container.innerHTML = '<p>No audio tracks configured</p>';
-                    return;
-                }
-                
-                container.innerHTML = data.tracks.map(track => 
-                    `<div style="padding: 10px; background: #333; margin: 5px 0; border-radius: 3px; border: 1px solid #555;">
-                        <strong>Track ${track.fileNumber}: ${track.description}</strong> ${track.isLoop ? '(Loop)' : '(One-shot)'}
-                        <div style="margin-top: 5px;">
-                            <button onclick="testAudioTrack(${track.fileNumber})" class="btn btn-warning" style="padding: 5px 10px; margin-right: 5px;">Test</button>
-                            <button onclick="removeAudioTrack(${track.fileNumber})" class="btn btn-danger" style="padding: 5px 10px;">Remove</button>
-                        </div>
-                    </div>`
-                ).join('');
-                
-                // Update VFX audio select options
-                populateAudioSelects(data.tracks);
-            } catch (error) {
-                console.error('Error loading audio tracks:', error);
-            }
-        }
-        
-        async function testAudioTrack(fileNumber) {
-            try {
-                updateStatus('loading', 'Testing audio track...');
-                
-                const response = await fetch('/api/audio/play', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({
-                        trackNumber: fileNumber,
-                        loop: false
-                    })
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', 'Playing audio track');
-                } else {
-                    updateStatus('error', result.error || 'Failed to play audio track');
-                }
-                
-            } catch (error) {
-                console.error('Error testing audio track:', error);
-                updateStatus('error', 'Failed to test audio track: ' + error.message);
-            }
-        }
-        
-        function populateAudioSelects(tracks) {
-            const select = document.getElementById('vfxAudio');
-            if (!select) return;
-            
-            select.innerHTML = '<option value="0">None</option>' + 
-                tracks.map(track => 
-                    `<option value="${track.fileNumber}">Track ${track.fileNumber}: ${track.description}</option>`
-                ).join('');
-        }
-        
-        function populateAvailableGroups() {
-            const container = document.getElementById('vfxGroups');
-            if (!container) return;
-            
-            // Get unique groups from zones
-            const uniqueGroups = [...new Set(zones.map(zone => zone.groupName).filter(group => group && group.trim() !== ''))];
-            
-            if (uniqueGroups.length === 0) {
-                container.innerHTML = '<div style="color: #666; font-style: italic;">No zones configured</div>';
-                return;
-            }
-            
-            // Create checkboxes for each group
-            container.innerHTML = uniqueGroups.map(group => `
-                <div style="margin: 3px 0; display: flex; align-items: center; line-height: 1.2;">
-                    <input type="checkbox" id="group-${group}" value="${group}" 
-                           style="margin: 0 6px 0 0; transform: scale(1.1); accent-color: #4CAF50; flex: none;">
-                    <label for="group-${group}" style="color: #ccc; cursor: pointer; font-size: 14px; margin: 0; padding: 0; flex: none;">${group}</label>
-                </div>
-            `).join('');
-        }
-        
-        async function addSceneConfig() {
-            const vfxName = document.getElementById('vfxName')?.value;
-            const audioFile = document.getElementById('vfxAudio')?.value;
-            const audioTimeout = document.getElementById('vfxAudioTimeout')?.value;
-            
-            // Get selected groups from checkboxes
-            const selectedGroups = [];
-            const checkboxes = document.querySelectorAll('#vfxGroups input[type="checkbox"]:checked');
-            checkboxes.forEach(checkbox => {
-                selectedGroups.push(checkbox.value);
-            });
-            
-            if (!vfxName || selectedGroups.length === 0) {
-                updateStatus('error', 'Please select VFX and at least one group');
-                return;
-            }
-            
-            try {
-                updateStatus('loading', 'Configuring VFX Scene...');
-                
-                const response = await fetch('/api/scenes/config', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({
-                        name: vfxName,
-                        groups: selectedGroups,
-                        audioFile: parseInt(audioFile) || 0,
-                        audioTimeout: (parseInt(audioTimeout) || 0) * 1000
-                    })
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', 'VFX Scene configured successfully');
-                    // Clear selected checkboxes
-                    document.querySelectorAll('#vfxGroups input[type="checkbox"]:checked').forEach(checkbox => {
-                        checkbox.checked = false;
-                    });
-                    loadSceneConfigs();
-                } else {
-                    updateStatus('error', result.error || 'Failed to configure VFX Scene');
-                }
-                
-            } catch (error) {
-                console.error('Error configuring VFX Scene:', error);
-                updateStatus('error', 'Failed to configure VFX Scene: ' + error.message);
-            }
-        }
-        
-        async function loadSceneConfigs() {
-            try {
-                const response = await fetch('/api/scenes/config');
-                if (!response.ok) return;
-                
-                const data = await response.json();
-                const container = document.getElementById('scene-configs-list');
-                
-                if (!container) return;
-                
-                if (!data.configs || data.configs.length === 0) {
-                    container.innerHTML = '<p>No scene configurations</p>';
-                    return;
-                }
-                
-                container.innerHTML = data.configs.map(config => 
-                    `<div style="padding: 10px; background: #333; margin: 5px 0; border-radius: 3px; border: 1px solid #555;">
-                        <strong>${config.name}</strong> → Status: ${config.enabled ? 'Enabled' : 'Disabled'}
-                        ${config.targetGroups ? ' | Groups: ' + (Array.isArray(config.targetGroups) ? config.targetGroups.join(', ') : config.targetGroups) : ''}
-                        ${config.audioFile ? ' | Audio: Track ' + config.audioFile : ''}
-                        ${config.audioTimeout ? ' | Timeout: ' + Math.round(config.audioTimeout/1000) + 's' : ''}
-                        <div style="margin-top: 5px;">
-                            <button onclick="removeSceneConfig('${config.name}')" class="btn btn-danger" style="padding: 5px 10px;">Remove</button>
-                        </div>
-                    </div>`
-                ).join('');
-            } catch (error) {
-                console.error('Error loading scene configs:', error);
-            }
-        }
-        
-        async function removeSceneConfig(sceneName) {
-            try {
-                const response = await fetch('/api/scenes/config', {
-                    method: 'DELETE',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({ name: sceneName })
-                });
-                
-                if (response.ok) {
-                    updateStatus('success', 'VFX Scene configuration removed');
-                    loadSceneConfigs();
-                } else {
-                    updateStatus('error', 'Failed to remove VFX Scene configuration');
-                }
-            } catch (error) {
-                updateStatus('error', 'Failed to remove VFX Scene configuration: ' + error.message);
-            }
-        }
-        
-        async function loadAvailableVFX() {
-            try {
-                const response = await fetch('/api/vfx');
-                if (!response.ok) return;
-                
-                const data = await response.json();
-                const select = document.getElementById('vfxName');
-                
-                if (!select) return;
-                
-                select.innerHTML = (data.vfx || []).map(vfx => 
-                    `<option value="${vfx.name}">${vfx.name}</option>`
-                ).join('');
-            } catch (error) {
-                console.error('Error loading available VFX:', error);
-            }
-        }
-        
-        async function removeAudioTrack(fileNumber) {
-            try {
-                const response = await fetch(`/api/audio/tracks?fileNumber=${fileNumber}`, {
-                    method: 'DELETE'
-                });
-                
-                if (response.ok) {
-                    updateStatus('success', 'Audio track removed');
-                    loadAudioTracks();
-                } else {
-                    updateStatus('error', 'Failed to remove audio track');
-                }
-            } catch (error) {
-                updateStatus('error', 'Failed to remove audio track: ' + error.message);
-            }
-        }
-        
-        // Load zones from server
-        async function loadZones() {
-            try {
-                const response = await fetch('/api/zones');
-                if (!response.ok) throw new Error('Failed to load zones');
-                
-                const data = await response.json();
-                zones = data.zones || [];
-                renderZones();
-                renderConfiguredZones();
-                populateAvailableGroups();
-                updateStatus('success', `Loaded ${zones.length} zones`);
-            } catch (error) {
-                console.error('Error loading zones:', error);
-                updateStatus('error', 'Failed to load zones: ' + error.message);
-            }
-        }
-        
-        function renderConfiguredZones() {
-            const container = document.getElementById('zones-config-list');
-            if (!container) return;
-            
-            if (zones.length === 0) {
-                container.innerHTML = '<p>No zones configured</p>';
-                return;
-            }
-            
-            container.innerHTML = zones.map(zone => `
-                <div style="padding: 10px; background: #333; margin: 5px 0; border-radius: 3px; border: 1px solid #555;">
-                    <strong>${zone.name}</strong> - GPIO ${zone.gpio} (${zone.type})
-                    <br><small>Group: ${zone.groupName} | Max Brightness: ${zone.brightness}</small>
-                    <div style="margin-top: 10px; display: flex; align-items: center; gap: 10px;">
-                        <label style="min-width: 80px;">Brightness:</label>
-                        <input type="range" min="0" max="255" value="${zone.currentBrightness || zone.brightness}" 
-                               oninput="setBrightness(${zone.id}, this.value); this.nextElementSibling.textContent = this.value"
-                               style="flex: 1; height: 6px; border-radius: 3px; background: #444;">
-                        <span style="min-width: 40px; text-align: right; font-weight: bold;">${zone.currentBrightness || zone.brightness}</span>
-                    </div>
-                    <div style="margin-top: 5px;">
-                        <button onclick="removeZone(${zone.id})" class="btn btn-danger" style="padding: 5px 10px;">Remove</button>
-                    </div>
-                </div>
-            `).join('');
-        }
-        
-        async function removeZone(zoneId) {
-            try {
-                const response = await fetch(`/api/zones?zoneId=${zoneId}`, {
-                    method: 'DELETE'
-                });
-                
-                if (response.ok) {
-                    updateStatus('success', 'Zone removed');
-                    loadZones();
-                    loadVFX(); // VFX may have changed
-                } else {
-                    updateStatus('error', 'Failed to remove zone');
-                }
-            } catch (error) {
-                updateStatus('error', 'Failed to remove zone: ' + error.message);
-            }
-        }
-        
-        // Load device status
-        async function loadStatus() {
-            try {
-                const response = await fetch('/api/status');
-                if (!response.ok) throw new Error('Failed to load status');
-                
-                const data = await response.json();
-                document.getElementById('firmware-info').textContent = 
-                    `BattleAura ${data.firmwareVersion}`;
-                document.getElementById('device-info').textContent = 
-                    `${data.deviceName} | ${data.ip} | Uptime: ${formatUptime(data.uptime)}`;
-            } catch (error) {
-                console.error('Error loading status:', error);
-            }
-        }
-        
-        // Render zones in UI - simplified for main page (no individual brightness controls)
-        function renderZones() {
-            // Main page no longer shows individual zone controls
-            // Zone control is moved to configuration section
-        }
-        
-        // Global control functions
-        async function setGlobalBrightness(brightness) {
-            document.getElementById('global-brightness-value').textContent = brightness;
-            
-            try {
-                const response = await fetch('/api/global/brightness', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({ brightness: parseInt(brightness) })
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    // Reload zones to reflect new brightness values
-                    loadZones();
-                    updateStatus('success', `Global brightness set to ${brightness}`);
-                } else {
-                    updateStatus('error', result.error || 'Failed to set global brightness');
-                }
-                
-            } catch (error) {
-                console.error('Error setting global brightness:', error);
-                updateStatus('error', 'Failed to set global brightness: ' + error.message);
-            }
-        }
-        
-        async function loadGlobalBrightness() {
-            try {
-                const response = await fetch('/api/global/brightness');
-                if (!response.ok) return;
-                
-                const data = await response.json();
-                const globalSlider = document.getElementById('global-brightness');
-                const globalValue = document.getElementById('global-brightness-value');
-                
-                if (globalSlider && data.brightness !== undefined) {
-                    globalSlider.value = data.brightness;
-                }
-                if (globalValue && data.brightness !== undefined) {
-                    globalValue.textContent = data.brightness;
-                }
-            } catch (error) {
-                console.error('Error loading global brightness:', error);
-            }
-        }
-        
-        async function setAllZonesBrightness(brightness) {
-            try {
-                // Use the global brightness API instead of individual zone calls
-                await setGlobalBrightness(brightness);
-            } catch (error) {
-                console.error('Error setting all zones brightness:', error);
-            }
-        }
-        
-        async function stopAllVFX() {
-            try {
-                updateStatus('loading', 'Stopping all VFX...');
-                
-                const response = await fetch('/api/vfx/stop-all', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' }
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', 'All VFX stopped');
-                    setTimeout(() => loadVFX(), 500);
-                } else {
-                    updateStatus('error', result.error || 'Failed to stop VFX');
-                }
-                
-            } catch (error) {
-                console.error('Error stopping VFX:', error);
-                updateStatus('error', 'Failed to stop VFX: ' + error.message);
-            }
-        }
-        
-        // Update brightness display
-        function updateBrightnessDisplay(zoneId, value) {
-            document.getElementById(`brightness-${zoneId}`).textContent = value;
-        }
-        
-        // Set brightness on server
-        async function setBrightness(zoneId, brightness) {
-            try {
-                const response = await fetch('/api/brightness', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({ zoneId, brightness: parseInt(brightness) })
-                });
-                
-                if (!response.ok) throw new Error('Failed to set brightness');
-                
-                // Update local zone data
-                const zone = zones.find(z => z.id === zoneId);
-                if (zone) zone.currentBrightness = parseInt(brightness);
-                
-                updateStatus('success', `Zone ${zoneId} brightness set to ${brightness}`);
-            } catch (error) {
-                console.error('Error setting brightness:', error);
-                updateStatus('error', 'Failed to set brightness: ' + error.message);
-                loadZones(); // Reload to reset UI
-            }
-        }
-        
-        // Update status message
-        function updateStatus(type, message) {
-            const statusEl = document.getElementById('status');
-            statusEl.className = `status ${type}`;
-            statusEl.textContent = message;
-            
-            // Clear success messages after 3 seconds
-            if (type === 'success') {
-                setTimeout(() => {
-                    statusEl.className = 'status';
-                    statusEl.textContent = 'Ready';
-                }, 3000);
-            }
-        }
-        
-        // Format uptime
-        function formatUptime(ms) {
-            const seconds = Math.floor(ms / 1000);
-            const minutes = Math.floor(seconds / 60);
-            const hours = Math.floor(minutes / 60);
-            
-            if (hours > 0) return `${hours}h ${minutes % 60}m`;
-            if (minutes > 0) return `${minutes}m ${seconds % 60}s`;
-            return `${seconds}s`;
-        }
-        
-        // Upload firmware
-        async function uploadFirmware() {
-            const fileInput = document.getElementById('firmwareFile');
-            const file = fileInput.files[0];
-            
-            if (!file) {
-                updateStatus('error', 'Please select a firmware file');
-                return;
-            }
-            
-            if (!file.name.endsWith('.bin')) {
-                updateStatus('error', 'Please select a .bin file');
-                return;
-            }
-            
-            const progressDiv = document.getElementById('upload-progress');
-            const progressBar = document.getElementById('progress-bar');
-            const progressText = document.getElementById('progress-text');
-            
-            try {
-                updateStatus('loading', 'Starting firmware upload...');
-                progressDiv.style.display = 'block';
-                
-                const formData = new FormData();
-                formData.append('firmware', file);
-                
-                const response = await fetch('/update', {
-                    method: 'POST',
-                    body: formData
-                });
-                
-                if (!response.ok) throw new Error(`Upload failed: ${response.statusText}`);
-                
-                updateStatus('success', 'Firmware uploaded successfully! Device will restart...');
-                progressBar.style.width = '100%';
-                progressText.textContent = '100%';
-                
-                // Reset form after delay
-                setTimeout(() => {
-                    fileInput.value = '';
-                    progressDiv.style.display = 'none';
-                    progressBar.style.width = '0%';
-                    progressText.textContent = '0%';
-                }, 3000);
-                
-            } catch (error) {
-                console.error('Upload error:', error);
-                updateStatus('error', 'Upload failed: ' + error.message);
-                progressDiv.style.display = 'none';
-            }
-        }
-        
-        // Zone configuration functions
-        function setupNewZoneForm() {
-            // Setup zone type change handler
-            const newZoneTypeSelect = document.getElementById('newZoneType');
-            if (newZoneTypeSelect) {
-                newZoneTypeSelect.addEventListener('change', function() {
-                    const ledCountRow = document.getElementById('newLedCountRow');
-                    if (ledCountRow) {
-                        ledCountRow.style.display = this.value === 'WS2812B' ? 'flex' : 'none';
-                    }
-                });
-            }
-        }
-        
-        async function clearAllZones() {
-            if (!confirm('Are you sure you want to remove all zones? This cannot be undone.')) {
-                return;
-            }
-            
-            try {
-                updateStatus('loading', 'Clearing all zones...');
-                
-                const response = await fetch('/api/zones/clear', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' }
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', result.message);
-                    loadZones(); // Reload zones
-                    loadVFX(); // Reload VFX
-                } else {
-                    updateStatus('error', result.error || 'Failed to clear zones');
-                }
-                
-            } catch (error) {
-                console.error('Error clearing zones:', error);
-                updateStatus('error', 'Failed to clear zones: ' + error.message);
-            }
-        }
-        
-        // VFX management functions
-        async function loadVFX() {
-            try {
-                const response = await fetch('/api/vfx');
-                if (!response.ok) throw new Error('Failed to load VFX');
-                
-                const data = await response.json();
-                renderVFX(data.vfx || []);
-            } catch (error) {
-                console.error('Error loading VFX:', error);
-            }
-        }
-        
-        function renderVFX(vfxList) {
-            const container = document.getElementById('vfx-container');
-            
-            if (vfxList.length === 0) {
-                container.innerHTML = '<div class="status">No VFX available</div>';
-                return;
-            }
-            
-            container.innerHTML = vfxList.map(vfx => `
-                <div class="zone-card">
-                    <div class="zone-name">${vfx.name}</div>
-                    <div class="zone-info">
-                        Status: ${vfx.enabled ? 'Running' : 'Stopped'}
-                    </div>
-                    <button onclick="triggerVFX('${vfx.name}', 0)" class="btn">
-                        ${vfx.enabled ? 'Restart' : 'Start'} Continuous
-                    </button>
-                    <button onclick="triggerVFX('${vfx.name}', 2000)" class="btn">
-                        Trigger 2s
-                    </button>
-                    <button onclick="triggerVFX('${vfx.name}', 5000)" class="btn">
-                        Trigger 5s
-                    </button>
-                </div>
-            `).join('');
-        }
-        
-        async function triggerVFX(vfxName, duration) {
-            try {
-                updateStatus('loading', `Triggering ${vfxName}...`);
-                
-                const response = await fetch('/api/vfx/trigger', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({ vfxName: vfxName, duration })
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', result.message);
-                    setTimeout(() => loadVFX(), 500); // Reload VFX after delay
-                } else {
-                    updateStatus('error', result.error || 'Failed to trigger VFX');
-                }
-                
-            } catch (error) {
-                console.error('Error triggering VFX:', error);
-                updateStatus('error', 'Failed to trigger VFX: ' + error.message);
-            }
-        }
-        
-        // Audio control functions
-        async function playAudio() {
-            const trackNumber = parseInt(document.getElementById('track-number').value);
-            const loop = document.getElementById('loop-audio').checked;
-            
-            try {
-                updateStatus('loading', `Playing track ${trackNumber}...`);
-                
-                const response = await fetch('/api/audio/play', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({ trackNumber, loop })
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', result.message);
-                    setTimeout(() => refreshAudioStatus(), 500);
-                } else {
-                    updateStatus('error', result.error || 'Failed to play audio');
-                }
-                
-            } catch (error) {
-                console.error('Error playing audio:', error);
-                updateStatus('error', 'Failed to play audio: ' + error.message);
-            }
-        }
-        
-        async function stopAudio() {
-            try {
-                updateStatus('loading', 'Stopping audio...');
-                
-                const response = await fetch('/api/audio/stop', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' }
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', result.message);
-                    setTimeout(() => refreshAudioStatus(), 500);
-                } else {
-                    updateStatus('error', result.error || 'Failed to stop audio');
-                }
-                
-            } catch (error) {
-                console.error('Error stopping audio:', error);
-                updateStatus('error', 'Failed to stop audio: ' + error.message);
-            }
-        }
-        
-        async function setVolume(volume) {
-            // Update display immediately
-            document.getElementById('volume-value').textContent = volume;
-            
-            try {
-                const response = await fetch('/api/audio/volume', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({ volume: parseInt(volume) })
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    // Success - no need to show status for every slider movement
-                    console.log('Volume set to', volume);
-                } else {
-                    console.error('Failed to set volume:', result.error);
-                    updateStatus('error', result.error || 'Failed to set volume');
-                }
-                
-            } catch (error) {
-                console.error('Error setting volume:', error);
-                updateStatus('error', 'Failed to set volume: ' + error.message);
-            }
-        }
-        
-        async function refreshAudioStatus() {
-            try {
-                const response = await fetch('/api/audio/status');
-                if (!response.ok) throw new Error('Failed to get audio status');
-                
-                const data = await response.json();
-                
-                const statusEl = document.getElementById('audio-status');
-                const trackEl = document.getElementById('current-track');
-                const availableEl = document.getElementById('audio-available');
-                const volumeSlider = document.getElementById('audio-volume');
-                const volumeValue = document.getElementById('volume-value');
-                
-                if (statusEl) statusEl.textContent = data.status || 'Unknown';
-                if (trackEl) trackEl.textContent = data.currentTrack > 0 ? data.currentTrack : 'None';
-                if (availableEl) availableEl.textContent = data.available ? 'Yes' : 'No';
-                
-                // Update volume slider
-                if (volumeSlider) volumeSlider.value = data.volume || 15;
-                if (volumeValue) volumeValue.textContent = data.volume || 15;
-                
-            } catch (error) {
-                console.error('Error getting audio status:', error);
-                const statusEl = document.getElementById('audio-status');
-                const availableEl = document.getElementById('audio-available');
-                if (statusEl) statusEl.textContent = 'Error';
-                if (availableEl) availableEl.textContent = 'Error';
-            }
-        }
-        
-        async function retryAudio() {
-            try {
-                updateStatus('loading', 'Retrying audio connection...');
-                
-                const response = await fetch('/api/audio/retry', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' }
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', result.message);
-                    setTimeout(() => refreshAudioStatus(), 1000);
-                } else {
-                    updateStatus('error', result.error || 'Failed to retry audio connection');
-                }
-                
-            } catch (error) {
-                console.error('Error retrying audio connection:', error);
-                updateStatus('error', 'Failed to retry audio connection: ' + error.message);
-            }
-        }
-        
-        // Update volume display when slider changes
-        document.addEventListener('DOMContentLoaded', function() {
-            const volumeSlider = document.getElementById('audio-volume');
-            if (volumeSlider) {
-                volumeSlider.addEventListener('input', function() {
-                    document.getElementById('volume-value').textContent = this.value;
-                });
-            }
-            
-            // Load initial audio status
-            refreshAudioStatus();
-            
-            // Load initial WiFi status
-            refreshWiFiStatus();
-            
-            // Setup show/hide password toggle
-            const showPasswordCheckbox = document.getElementById('showPassword');
-            const passwordInput = document.getElementById('wifiPassword');
-            if (showPasswordCheckbox && passwordInput) {
-                showPasswordCheckbox.addEventListener('change', function() {
-                    passwordInput.type = this.checked ? 'text' : 'password';
-                });
-            }
-        });
-        
-        // WiFi configuration functions
-        async function saveWiFiConfig() {
-            const deviceName = document.getElementById('deviceName').value.trim();
-            const ssid = document.getElementById('wifiNetwork').value.trim();
-            const password = document.getElementById('wifiPassword').value;
-            
-            if (!deviceName) {
-                updateStatus('error', 'Please enter a device name');
-                return;
-            }
-            
-            if (!ssid) {
-                updateStatus('error', 'Please enter a network name (SSID)');
-                return;
-            }
-            
-            try {
-                updateStatus('loading', 'Saving WiFi configuration and connecting...');
-                
-                const response = await fetch('/api/wifi/config', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({ deviceName, ssid, password })
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', result.message);
-                    // Clear password field for security
-                    document.getElementById('wifiPassword').value = '';
-                    // Refresh status after a few seconds to see connection result
-                    setTimeout(() => refreshWiFiStatus(), 5000);
-                } else {
-                    updateStatus('error', result.error || 'Failed to save WiFi configuration');
-                }
-                
-            } catch (error) {
-                console.error('Error saving WiFi config:', error);
-                updateStatus('error', 'Failed to save WiFi configuration: ' + error.message);
-            }
-        }
-        
-        async function clearWiFiConfig() {
-            if (!confirm('Clear WiFi configuration? The device will switch to AP mode.')) {
-                return;
-            }
-            
-            try {
-                updateStatus('loading', 'Clearing WiFi configuration...');
-                
-                const response = await fetch('/api/wifi/clear', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' }
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', result.message);
-                    document.getElementById('wifiNetwork').value = '';
-                    document.getElementById('wifiPassword').value = '';
-                    setTimeout(() => refreshWiFiStatus(), 3000);
-                } else {
-                    updateStatus('error', result.error || 'Failed to clear WiFi configuration');
-                }
-                
-            } catch (error) {
-                console.error('Error clearing WiFi config:', error);
-                updateStatus('error', 'Failed to clear WiFi configuration: ' + error.message);
-            }
-        }
-        
-        async function refreshWiFiStatus() {
-            try {
-                const response = await fetch('/api/status');
-                if (!response.ok) throw new Error('Failed to get status');
-                
-                const data = await response.json();
-                
-                // Update WiFi status display
-                const wifiConnected = data.wifiConnected || false;
-                const wifiMode = wifiConnected ? 'Station Mode' : 'Access Point Mode';
-                const ssid = data.wifiSSID || 'BattleAura-' + data.deviceId;
-                const ip = data.ip || 'Unknown';
-                const hostname = (data.hostname || 'battleaura') + '.local';
-                
-                document.getElementById('wifi-status').textContent = wifiMode;
-                document.getElementById('wifi-ssid').textContent = ssid;
-                document.getElementById('wifi-ip').textContent = ip;
-                document.getElementById('device-hostname').textContent = hostname;
-                
-                // Pre-fill current device name and SSID
-                if (data.deviceName) {
-                    document.getElementById('deviceName').value = data.deviceName;
-                }
-                if (wifiConnected && data.wifiSSID && data.wifiSSID !== '') {
-                    document.getElementById('wifiNetwork').value = data.wifiSSID;
-                }
-                
-            } catch (error) {
-                console.error('Error getting WiFi status:', error);
-                document.getElementById('wifi-status').textContent = 'Error';
-                document.getElementById('wifi-ssid').textContent = 'Error';
-                document.getElementById('wifi-ip').textContent = 'Error';
-                document.getElementById('device-hostname').textContent = 'Error';
-            }
-        }
-        
-        async function saveDeviceConfig() {
-            const deviceName = document.getElementById('deviceName').value.trim();
-            const audioEnabled = document.getElementById('audioEnabled').checked;
-            
-            if (!deviceName) {
-                updateStatus('error', 'Please enter a device name');
-                return;
-            }
-            
-            try {
-                updateStatus('loading', 'Saving device configuration...');
-                
-                const response = await fetch('/api/device/config', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify({ deviceName, audioEnabled })
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', result.message || 'Device configuration saved');
-                } else {
-                    updateStatus('error', result.error || 'Failed to save device configuration');
-                }
-                
-            } catch (error) {
-                console.error('Error saving device config:', error);
-                updateStatus('error', 'Failed to save device configuration: ' + error.message);
-            }
-        }
-        
-        async function restartDevice() {
-            if (!confirm('Restart the device? This will disconnect the current session.')) {
-                return;
-            }
-            
-            try {
-                updateStatus('loading', 'Restarting device...');
-                
-                const response = await fetch('/api/system/restart', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' }
-                });
-                
-                if (response.ok) {
-                    updateStatus('success', 'Device is restarting...');
-                } else {
-                    updateStatus('error', 'Failed to restart device');
-                }
-                
-            } catch (error) {
-                console.error('Error restarting device:', error);
-                updateStatus('error', 'Failed to restart device: ' + error.message);
-            }
-        }
-        
-        async function factoryReset() {
-            if (!confirm('Factory reset will erase ALL configuration and restart the device. This cannot be undone. Are you sure?')) {
-                return;
-            }
-            
-            try {
-                updateStatus('loading', 'Performing factory reset...');
-                
-                const response = await fetch('/api/system/factory-reset', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' }
-                });
-                
-                const result = await response.json();
-                
-                if (response.ok) {
-                    updateStatus('success', 'Factory reset complete. Device is restarting...');
-                } else {
-                    updateStatus('error', result.error || 'Failed to perform factory reset');
-                }
-                
-            } catch (error) {
-                console.error('Error performing factory reset:', error);
-                updateStatus('error', 'Failed to perform factory reset: ' + error.message);
-            }
-        }
-    </script>
-</body>
-</html>
-)rawliteral";
-
+const char MAIN_HTML_ETAG[] = "\"4ea76f464c9a07d4\"";    // Quoted, as sent
+const size_t MAIN_HTML_GZ_SIZE = 8636;
+const uint8_t MAIN_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x3d, 0x6b, 0x73, 0xdb, 0x48, 0x72, 0xdf, 0xf9, 0x2b,
+    0xc6, 0x3c, 0x9f, 0x41, 0x26, 0x22, 0x45, 0x49, 0x96, 0xcb, 0x2b, 0x59, 0x72, 0x79, 0x2d, 0x7b, 0xcf, 0x89, 0x5f, 0xb1,
+    0xb4, 0xde, 0xdc, 0x6d, 0x6d, 0x95, 0x20, 0x12, 0x14, 0x71, 0x06, 0x01, 0x1e, 0x00, 0x4a, 0xd6, 0x79, 0xf5, 0x35, 0x3f,
+    0x20, 0x3f, 0x31, 0xbf, 0x24, 0xfd, 0x98, 0x27, 0x1e, 0x24, 0x40, 0xd9, 0xbe, 0x4b, 0x6a, 0x6b, 0x2d, 0x62, 0x30, 0xd3,
+    0xd3, 0xd3, 0xd3, 0xaf, 0xe9, 0xe9, 0x19, 0x3c, 0xb9, 0x77, 0xf2, 0xee, 0xf9, 0xd9, 0x9f, 0xdf, 0xbf, 0x10, 0xb3, 0x7c,
+    0x1e, 0x1d, 0x77, 0x9e, 0xa8, 0x3f, 0x81, 0x3f, 0x81, 0x3f, 0xf3, 0x20, 0xf7, 0xc5, 0x78, 0xe6, 0xa7, 0x59, 0x90, 0x1f,
+    0x75, 0x7f, 0x3e, 0x7b, 0x39, 0x78, 0xdc, 0x55, 0xc5, 0xb1, 0x3f, 0x0f, 0x8e, 0xba, 0x57, 0x61, 0x70, 0xbd, 0x48, 0xd2,
+    0xbc, 0x2b, 0xc6, 0x49, 0x9c, 0x07, 0x31, 0x54, 0xbb, 0x0e, 0x27, 0xf9, 0xec, 0x68, 0x12, 0x5c, 0x85, 0xe3, 0x60, 0x40,
+    0x0f, 0x5b, 0x22, 0x8c, 0xc3, 0x3c, 0xf4, 0xa3, 0x41, 0x36, 0xf6, 0xa3, 0xe0, 0x68, 0x67, 0x38, 0x42, 0x30, 0x79, 0x98,
+    0x47, 0xc1, 0xf1, 0x8f, 0x7e, 0x0e, 0x7f, 0x9e, 0x2d, 0x53, 0x5f, 0x3c, 0x07, 0x10, 0x69, 0x12, 0x45, 0x41, 0xfa, 0x64,
+    0x9b, 0x5f, 0x76, 0x9e, 0x64, 0xf9, 0x0d, 0xfe, 0xbd, 0x48, 0x26, 0x37, 0xe2, 0x4b, 0x67, 0x0a, 0x35, 0x06, 0x53, 0x7f,
+    0x1e, 0x46, 0x37, 0x07, 0xe2, 0x59, 0x0a, 0x20, 0xb7, 0x44, 0xe6, 0xc7, 0xd9, 0x20, 0x0b, 0xd2, 0x70, 0x7a, 0xd8, 0x99,
+    0xfb, 0xe9, 0x65, 0x18, 0x1f, 0x88, 0xd1, 0x61, 0x67, 0xe1, 0x4f, 0x26, 0x61, 0x7c, 0x79, 0x20, 0x76, 0x47, 0x8b, 0xcf,
+    0x87, 0x9d, 0x0b, 0x7f, 0xfc, 0xe9, 0x32, 0x4d, 0x96, 0xf1, 0xe4, 0x40, 0xfc, 0x61, 0xc7, 0xc7, 0xff, 0x0e, 0x3b, 0xe3,
+    0x24, 0x4a, 0x52, 0x78, 0x9e, 0x4e, 0xa1, 0xed, 0x6d, 0x67, 0x88, 0x63, 0xf0, 0xc3, 0x38, 0x48, 0xa1, 0xab, 0xb9, 0xff,
+    0x99, 0xb1, 0x3f, 0x10, 0x8f, 0x46, 0x04, 0x42, 0x03, 0x17, 0xfe, 0x32, 0x4f, 0xb0, 0xc1, 0x6c, 0x07, 0x2a, 0xe6, 0xc1,
+    0xe7, 0x7c, 0xe0, 0x47, 0xe1, 0x25, 0xbc, 0x1a, 0x03, 0x05, 0x82, 0xd4, 0x00, 0x7e, 0xf8, 0xfc, 0xd9, 0xcb, 0xfd, 0x91,
+    0x6a, 0x3a, 0xb8, 0x48, 0xf2, 0x3c, 0x99, 0x1f, 0x88, 0x3d, 0x82, 0x07, 0x1d, 0xfe, 0x3d, 0x89, 0x83, 0xc1, 0xd8, 0x4f,
+    0x27, 0x00, 0xc7, 0xc1, 0x70, 0x77, 0x82, 0xff, 0x01, 0xda, 0x49, 0x3a, 0x09, 0xd2, 0x41, 0xea, 0x4f, 0xc2, 0x65, 0x76,
+    0x20, 0x1e, 0x63, 0xbb, 0xc2, 0xc8, 0x14, 0x5a, 0x3b, 0xf0, 0x84, 0x03, 0xe7, 0x26, 0xf0, 0x0c, 0x8f, 0x59, 0x12, 0x85,
+    0x13, 0x40, 0xe3, 0xe1, 0x43, 0xd3, 0x1d, 0x4e, 0x9c, 0x22, 0x65, 0x16, 0xfe, 0x3d, 0x80, 0x9a, 0x04, 0x96, 0x0a, 0xae,
+    0x83, 0xf0, 0x72, 0x96, 0x1f, 0x88, 0x8b, 0x24, 0x9a, 0x94, 0xd0, 0xde, 0xa1, 0xfe, 0x8a, 0x63, 0x53, 0x70, 0xc3, 0x78,
+    0x9a, 0x00, 0x5c, 0xf5, 0xda, 0xf7, 0xfd, 0x43, 0xa7, 0x93, 0x87, 0x06, 0x59, 0x03, 0x71, 0x5f, 0x12, 0xe2, 0x22, 0xc5,
+    0x7e, 0xe3, 0x20, 0xcb, 0x06, 0x63, 0xe6, 0x02, 0x00, 0x35, 0x09, 0xb3, 0x45, 0xe4, 0xc3, 0x4c, 0x4f, 0xa3, 0x00, 0xaa,
+    0x11, 0x8d, 0x07, 0x61, 0x1e, 0xcc, 0x33, 0x43, 0xe9, 0x4b, 0x7f, 0xa1, 0x10, 0x73, 0xc1, 0x64, 0x30, 0x72, 0x9a, 0x48,
+    0x6c, 0x0c, 0x55, 0x0e, 0x3b, 0x33, 0x39, 0xb6, 0x47, 0xc4, 0x0f, 0x2e, 0x61, 0xf7, 0x4a, 0x3c, 0x42, 0x34, 0x4b, 0x96,
+    0x79, 0x04, 0xfc, 0x70, 0x20, 0x62, 0x18, 0x61, 0xb1, 0x87, 0x2b, 0x3f, 0x5a, 0x22, 0x25, 0xe7, 0x30, 0x20, 0xc9, 0x29,
+    0x0f, 0x09, 0x11, 0x9b, 0x23, 0xa8, 0x7a, 0x25, 0x71, 0x01, 0x58, 0x96, 0xfb, 0xf9, 0x32, 0xab, 0xe1, 0x21, 0x3d, 0xcd,
+    0x3b, 0xce, 0x34, 0xef, 0x3a, 0xd3, 0xac, 0x07, 0xf0, 0xb0, 0x34, 0x80, 0xbd, 0xbd, 0xbd, 0x4a, 0x66, 0xd8, 0xdf, 0xdf,
+    0xa7, 0xce, 0xa3, 0xc4, 0x47, 0xf8, 0xd6, 0x94, 0x4d, 0xa7, 0x3f, 0x3c, 0x1e, 0xf1, 0x8c, 0x06, 0x69, 0x9a, 0xa4, 0xf6,
+    0xab, 0x87, 0x0f, 0xf7, 0xf6, 0x1e, 0x1d, 0x16, 0x99, 0x74, 0xe7, 0x62, 0xe7, 0x42, 0xa3, 0x52, 0xac, 0x8b, 0x03, 0x5c,
+    0x8e, 0xc7, 0x40, 0x2a, 0x0b, 0x90, 0xe2, 0x1a, 0x57, 0x1e, 0x2f, 0x10, 0x54, 0x09, 0x90, 0xc5, 0x61, 0xd3, 0x24, 0xc9,
+    0x69, 0x36, 0xab, 0x28, 0x25, 0x99, 0x2a, 0x4f, 0x16, 0x6a, 0x06, 0x24, 0xed, 0xb8, 0x48, 0x2a, 0x00, 0x86, 0x4d, 0x25,
+    0x45, 0xd1, 0x50, 0x1d, 0x3e, 0x7a, 0xf4, 0xc8, 0xe5, 0xd9, 0x5d, 0xc9, 0x57, 0xb1, 0x7f, 0x35, 0xc8, 0xfd, 0x8b, 0xac,
+    0xcc, 0x94, 0x05, 0x86, 0x76, 0xfa, 0xd2, 0x5c, 0x5e, 0x96, 0x44, 0x00, 0x36, 0xb8, 0xc8, 0x63, 0x80, 0xe7, 0x4c, 0x73,
+    0x95, 0xb2, 0xa2, 0x79, 0x54, 0x18, 0x8e, 0xc7, 0x63, 0x33, 0xa9, 0xcc, 0x94, 0x85, 0xce, 0x76, 0x75, 0x67, 0x79, 0x0a,
+    0x9a, 0x71, 0xe1, 0xa7, 0x40, 0x25, 0x00, 0xb0, 0x4c, 0x33, 0x84, 0xb0, 0x48, 0x42, 0x87, 0x68, 0x29, 0xb3, 0xa4, 0x92,
+    0x43, 0x89, 0xd7, 0xd0, 0x1f, 0xe7, 0xe1, 0x55, 0x50, 0x35, 0x6f, 0x76, 0x6f, 0x55, 0x33, 0x25, 0x21, 0x1c, 0xcc, 0x92,
+    0x2b, 0x9a, 0xb0, 0xb2, 0x50, 0xb1, 0xa2, 0x9d, 0x86, 0x97, 0x48, 0x52, 0x9b, 0xa2, 0x5a, 0xc8, 0xcc, 0x6b, 0x83, 0x88,
+    0xae, 0x75, 0x11, 0x25, 0xe3, 0x4f, 0x92, 0x29, 0xd2, 0xf9, 0x20, 0x4d, 0xae, 0x1b, 0xaa, 0x8a, 0xa2, 0xa2, 0x74, 0x55,
+    0x87, 0x06, 0x16, 0xf9, 0x17, 0x41, 0xe4, 0x8a, 0xf5, 0xce, 0xa8, 0x54, 0x2b, 0x8c, 0x17, 0xcb, 0x7c, 0x4b, 0x98, 0x82,
+    0x2c, 0x88, 0x82, 0x71, 0x6e, 0xeb, 0x1b, 0x3d, 0xb3, 0xfb, 0x86, 0x27, 0xca, 0x92, 0x58, 0x3b, 0xd7, 0xd7, 0x33, 0xc0,
+    0xbf, 0x5a, 0x51, 0xa1, 0x1e, 0x6a, 0xc6, 0x3c, 0x6a, 0x62, 0xaa, 0x60, 0x16, 0x18, 0xc8, 0xd1, 0x24, 0x35, 0xec, 0x22,
+    0xc7, 0x52, 0x52, 0xeb, 0x8c, 0x50, 0xcd, 0x9c, 0xef, 0xfb, 0xa3, 0x87, 0x3f, 0xe8, 0x3a, 0x30, 0x53, 0xfe, 0x45, 0x14,
+    0x94, 0x2c, 0x1e, 0xc9, 0x9e, 0xea, 0x36, 0x4e, 0x50, 0xc8, 0xa3, 0xe4, 0x3a, 0x98, 0xa8, 0x86, 0x03, 0xa3, 0x4b, 0x2a,
+    0x47, 0x28, 0x6b, 0x4d, 0xfc, 0xf8, 0xb2, 0x8c, 0x83, 0xa5, 0x92, 0x4c, 0xa5, 0x6a, 0x74, 0x27, 0xfe, 0xce, 0x0f, 0xa3,
+    0x0b, 0xd6, 0x5e, 0x30, 0xa1, 0x61, 0x12, 0x93, 0x33, 0xc0, 0xa3, 0xdf, 0x93, 0xac, 0xb3, 0xca, 0xb9, 0x58, 0x65, 0xba,
+    0x57, 0xd8, 0x66, 0xd5, 0xd9, 0x6c, 0xb7, 0x42, 0xea, 0x6c, 0x0d, 0x37, 0xda, 0x4c, 0xe9, 0x28, 0x95, 0xe8, 0x1a, 0x73,
+    0x65, 0xbc, 0x91, 0x8d, 0xf5, 0x38, 0x0b, 0x80, 0x37, 0x95, 0xb4, 0x82, 0x95, 0xb7, 0xc4, 0xcd, 0xf2, 0xad, 0x1e, 0xb2,
+    0x68, 0x21, 0xb0, 0xc1, 0x75, 0x8a, 0x55, 0xf0, 0xdf, 0xf5, 0x12, 0xb9, 0xeb, 0xf8, 0x22, 0xa4, 0x16, 0xdb, 0x88, 0x27,
+    0x73, 0xbe, 0x02, 0xf6, 0x78, 0xe4, 0xf8, 0x55, 0x8f, 0x6b, 0x1d, 0xc6, 0x3a, 0x21, 0x76, 0x1c, 0xc9, 0x2a, 0x79, 0x2a,
+    0xe1, 0x76, 0x30, 0x4d, 0xc6, 0xcb, 0xac, 0x8c, 0x21, 0x97, 0x23, 0x53, 0x56, 0xdb, 0xc2, 0x92, 0x47, 0xf2, 0x07, 0xe3,
+    0x91, 0x7c, 0x6c, 0xe2, 0x90, 0xd4, 0xb9, 0xa8, 0x95, 0x1e, 0xca, 0x93, 0x6d, 0xe9, 0x7f, 0x3f, 0xd9, 0x96, 0x4b, 0x02,
+    0x74, 0xc4, 0xe1, 0xcf, 0x24, 0xbc, 0x12, 0xe3, 0xc8, 0xcf, 0xb2, 0xa3, 0xae, 0x76, 0x9a, 0xd1, 0xa7, 0x9f, 0xed, 0xd4,
+    0x39, 0xf4, 0xf0, 0x86, 0x9b, 0x85, 0x93, 0xa3, 0x2e, 0x3b, 0x3e, 0x5d, 0x05, 0x42, 0xfa, 0x41, 0xd2, 0x23, 0x01, 0x38,
+    0xaf, 0xa5, 0x6f, 0x92, 0xdd, 0x64, 0xc0, 0x59, 0xc3, 0xe1, 0x10, 0x10, 0x80, 0xb6, 0x6e, 0xc7, 0x52, 0x62, 0xa8, 0xdb,
+    0xdd, 0xe3, 0x8f, 0x2f, 0xff, 0x53, 0xf5, 0x97, 0x41, 0x6f, 0xbb, 0x50, 0xba, 0x38, 0xfe, 0x8f, 0x65, 0x38, 0xfe, 0x24,
+    0x7c, 0x56, 0x1c, 0x79, 0x02, 0x26, 0x31, 0xbc, 0x44, 0xf5, 0x80, 0x95, 0x41, 0xd6, 0x6e, 0x92, 0x65, 0x2a, 0xd8, 0xd8,
+    0x2c, 0x53, 0x50, 0x49, 0x28, 0x0a, 0xd0, 0x78, 0x61, 0x61, 0x7a, 0x35, 0xfd, 0x3c, 0x70, 0x46, 0x28, 0xf1, 0x58, 0x87,
+    0xce, 0x4f, 0x51, 0x72, 0xe1, 0x47, 0x45, 0x8c, 0xac, 0xea, 0xda, 0xf5, 0xef, 0x56, 0x94, 0xa3, 0x8f, 0xde, 0x3d, 0x7e,
+    0xe3, 0x67, 0xe8, 0xf4, 0x18, 0x18, 0xa6, 0x4f, 0x9a, 0x96, 0xa3, 0xae, 0xad, 0x17, 0x48, 0xca, 0x0a, 0xc0, 0x14, 0x73,
+    0x61, 0x31, 0x4b, 0x11, 0x94, 0x1c, 0x75, 0x2f, 0x09, 0xb9, 0x81, 0xe1, 0x9c, 0xae, 0xc2, 0xf7, 0x47, 0x5d, 0x24, 0x7a,
+    0xa3, 0xc1, 0xee, 0xfe, 0x7e, 0xff, 0xe0, 0xc9, 0x36, 0xb5, 0x04, 0x08, 0xc4, 0xb8, 0x22, 0xbf, 0x59, 0x40, 0xcf, 0x29,
+    0xaa, 0xd0, 0x2e, 0x91, 0xa8, 0x0c, 0x4d, 0x00, 0x07, 0x1e, 0x75, 0x47, 0xf0, 0xd7, 0xff, 0x7c, 0xd4, 0x05, 0x28, 0x5d,
+    0x41, 0xce, 0xb2, 0xfc, 0x9d, 0xc4, 0x04, 0x09, 0x49, 0x96, 0x73, 0xbf, 0xa6, 0xdb, 0x5e, 0x3e, 0x0b, 0xb3, 0x21, 0xd5,
+    0xee, 0x23, 0xd6, 0xe0, 0xc0, 0xc4, 0xd5, 0xbd, 0xb0, 0xff, 0xdd, 0x3d, 0x06, 0x90, 0xc0, 0xa6, 0x50, 0xcd, 0x9d, 0x95,
+    0x2a, 0x0a, 0x8d, 0x24, 0x85, 0x2e, 0x96, 0xa0, 0x98, 0x62, 0xc0, 0x63, 0x1c, 0x01, 0x7f, 0x20, 0xff, 0x25, 0x8b, 0x67,
+    0x51, 0x04, 0x5c, 0xd1, 0xeb, 0x6b, 0xa6, 0x44, 0x0b, 0x6b, 0x8c, 0x45, 0xb7, 0x00, 0x50, 0xfa, 0x4d, 0x12, 0xe4, 0x29,
+    0x00, 0x10, 0x00, 0x01, 0x19, 0xeb, 0xc9, 0x36, 0x83, 0xaf, 0xea, 0x27, 0xc8, 0xa1, 0xd2, 0x5f, 0x90, 0xcb, 0xac, 0x11,
+    0x8f, 0x9c, 0x3e, 0x57, 0x75, 0x24, 0x4a, 0x16, 0xb3, 0x7b, 0xfc, 0x1a, 0xdf, 0x67, 0xe2, 0xdd, 0x74, 0xda, 0xba, 0x63,
+    0x9c, 0xde, 0xca, 0xae, 0x5d, 0xdb, 0xc9, 0xab, 0x02, 0xd3, 0x53, 0x6c, 0x75, 0xe4, 0x4a, 0x43, 0x43, 0xd9, 0x78, 0xb6,
+    0x9c, 0x84, 0x89, 0x78, 0x0f, 0x56, 0x84, 0x14, 0xc3, 0x26, 0x82, 0x11, 0x2f, 0x81, 0x59, 0x19, 0x8e, 0x14, 0x8f, 0x8a,
+    0x5e, 0xf5, 0xb2, 0x14, 0x20, 0x9d, 0x92, 0x8a, 0x39, 0x10, 0x86, 0xa1, 0x7c, 0x6c, 0x3d, 0x90, 0x9a, 0xe8, 0xf8, 0xe7,
+    0xf8, 0x53, 0x9c, 0x5c, 0xc7, 0x92, 0x93, 0xc4, 0xef, 0x9d, 0xb3, 0x14, 0x88, 0x60, 0xd7, 0x07, 0xdf, 0x04, 0x5d, 0xe9,
+    0x41, 0x8e, 0x2f, 0xba, 0xc7, 0x6f, 0x01, 0x78, 0x53, 0xbe, 0x6b, 0x2e, 0x99, 0x04, 0x7c, 0x10, 0x2f, 0xe7, 0x17, 0xa8,
+    0x6d, 0x08, 0x07, 0xd1, 0xdb, 0x19, 0xfc, 0x50, 0x27, 0x86, 0xb2, 0x26, 0x21, 0xe8, 0xb4, 0x65, 0x11, 0xdc, 0x91, 0x22,
+    0xf8, 0x83, 0x16, 0xc0, 0x1d, 0x3d, 0xc9, 0x3a, 0xb8, 0x81, 0x8c, 0x65, 0x59, 0xc5, 0x6e, 0xa1, 0x8b, 0xf1, 0x2c, 0x18,
+    0x7f, 0xba, 0x48, 0x3e, 0x73, 0x27, 0x51, 0x92, 0x2c, 0x06, 0x44, 0xba, 0x22, 0xa3, 0x46, 0xc1, 0x34, 0x97, 0x63, 0xb5,
+    0xc1, 0x09, 0xd9, 0x0f, 0xc5, 0x4c, 0x0a, 0xa3, 0x5d, 0x07, 0xec, 0x71, 0x11, 0x96, 0x65, 0xd9, 0x24, 0xbc, 0xd7, 0x00,
+    0xc2, 0x90, 0xa6, 0xc8, 0xf7, 0xe8, 0xa9, 0x10, 0x97, 0x54, 0xc8, 0xb5, 0xf4, 0x27, 0x6b, 0x86, 0xc1, 0x72, 0x8d, 0x3c,
+    0xba, 0x4a, 0xac, 0x50, 0x6f, 0xd4, 0x80, 0x97, 0x6a, 0x83, 0x54, 0x43, 0x59, 0x60, 0xd6, 0x73, 0x02, 0xb3, 0xe7, 0x55,
+    0x12, 0x2d, 0x91, 0xe3, 0x3f, 0xd2, 0xdf, 0xf5, 0xba, 0xd8, 0x69, 0xe5, 0xaa, 0xe1, 0xbd, 0x91, 0x61, 0x82, 0x82, 0x12,
+    0x66, 0xe8, 0xb5, 0xaa, 0x97, 0xc1, 0x29, 0x7d, 0xbb, 0x53, 0x52, 0xb7, 0x4d, 0xa5, 0x9f, 0xc5, 0x88, 0xd7, 0x76, 0xba,
+    0x4c, 0x52, 0xdf, 0x5d, 0x04, 0x4a, 0x45, 0xf1, 0x5c, 0x9a, 0x66, 0x1f, 0xab, 0x96, 0x35, 0x85, 0x5a, 0x95, 0x5b, 0x2a,
+    0x5d, 0xbe, 0x51, 0xcb, 0x6b, 0x5e, 0x3d, 0x76, 0xad, 0x19, 0x9b, 0x25, 0xd7, 0x0c, 0xf5, 0xcc, 0xbf, 0xe8, 0x79, 0x64,
+    0xf0, 0x3d, 0x18, 0xed, 0x5f, 0xd8, 0xf2, 0x17, 0x67, 0xda, 0x05, 0x57, 0x0f, 0x27, 0x03, 0xaf, 0x8a, 0x01, 0x9d, 0xd2,
+    0x2f, 0xf1, 0x80, 0x95, 0xd3, 0xe6, 0x10, 0x39, 0x7e, 0x8a, 0x10, 0x4f, 0xe8, 0xd7, 0x1d, 0x70, 0x23, 0x1f, 0x8a, 0x70,
+    0xa3, 0x5f, 0xd5, 0xcc, 0x68, 0x4d, 0x0d, 0x11, 0xa5, 0x6b, 0xb9, 0x77, 0x6a, 0xa9, 0x2e, 0xa9, 0x89, 0x73, 0xb3, 0x47,
+    0x14, 0x13, 0xa0, 0x88, 0xfd, 0xcb, 0x60, 0x0e, 0x6a, 0x11, 0x66, 0x67, 0xaf, 0x42, 0xfb, 0x22, 0x73, 0x37, 0xd3, 0x7c,
+    0x71, 0x70, 0x8d, 0x20, 0xdf, 0x92, 0x82, 0xc7, 0x7f, 0x6b, 0x98, 0x1d, 0x7d, 0x59, 0xe6, 0x24, 0xbb, 0x85, 0x00, 0xe6,
+    0x19, 0x07, 0x33, 0x70, 0x5b, 0x03, 0x80, 0x15, 0x0c, 0x2f, 0x87, 0x5b, 0xe2, 0x45, 0x0c, 0xf2, 0x1c, 0x88, 0xd7, 0x2f,
+    0x4e, 0xba, 0x6d, 0x04, 0x4f, 0x82, 0xfd, 0x69, 0x01, 0x5a, 0xe9, 0xf8, 0xa7, 0xf7, 0xaf, 0xde, 0x89, 0xf7, 0xb0, 0xf4,
+    0x5b, 0xaf, 0x7e, 0xed, 0x76, 0x2c, 0x79, 0xbb, 0xca, 0x01, 0xda, 0x29, 0xe0, 0xb7, 0x3b, 0xd8, 0x19, 0x6d, 0xc1, 0xea,
+    0x6a, 0x00, 0x6f, 0x36, 0x40, 0xed, 0x0c, 0xfa, 0x06, 0xe3, 0x00, 0xff, 0x5a, 0x68, 0xc9, 0x05, 0x8e, 0x85, 0x09, 0x57,
+    0xeb, 0x3c, 0x49, 0x16, 0xb4, 0xb0, 0x94, 0xb2, 0xff, 0xfe, 0x97, 0x37, 0xa0, 0xd7, 0x7e, 0x79, 0x23, 0x7a, 0xa7, 0xe0,
+    0x61, 0x47, 0x44, 0x9f, 0xfe, 0x93, 0x6d, 0xae, 0x54, 0xaa, 0xfd, 0xcb, 0xe9, 0xee, 0xe3, 0x9d, 0xdd, 0x1f, 0xbb, 0xc7,
+    0xf2, 0x87, 0xe8, 0x7d, 0xf8, 0xe9, 0x47, 0x71, 0x0a, 0x7e, 0xf4, 0xc2, 0x6e, 0xb4, 0xcd, 0xbd, 0xaf, 0x1e, 0x8b, 0xc2,
+    0xed, 0x75, 0x30, 0x79, 0x0e, 0xbe, 0x45, 0xfe, 0x01, 0xcb, 0x0a, 0xe2, 0xaf, 0xa5, 0xdf, 0x1d, 0xb5, 0x6a, 0x02, 0xfa,
+    0xfe, 0xc5, 0x89, 0xa0, 0x9f, 0xcd, 0x66, 0x44, 0x37, 0x74, 0xed, 0xe1, 0xce, 0xc8, 0x28, 0xc3, 0xfd, 0x8d, 0xb8, 0x03,
+    0xbc, 0xa3, 0x05, 0xb0, 0x07, 0xfe, 0x69, 0xca, 0xa8, 0xdc, 0xa6, 0x9e, 0x53, 0x61, 0x35, 0xf8, 0x4b, 0xe0, 0x2f, 0x92,
+    0x38, 0xd3, 0xb8, 0x9d, 0x04, 0x53, 0x7f, 0x19, 0xe5, 0x16, 0x86, 0x45, 0x13, 0x04, 0x6b, 0xd6, 0xb7, 0x0c, 0x7e, 0x85,
+    0x89, 0x3b, 0x7e, 0x36, 0x99, 0x88, 0xbf, 0x90, 0xc3, 0x52, 0x6b, 0xcb, 0xc6, 0x51, 0xe0, 0xa7, 0xca, 0x49, 0x5c, 0x61,
+    0xcf, 0x9e, 0x63, 0x3d, 0xf2, 0x75, 0x8b, 0x3a, 0xb3, 0x52, 0x9b, 0xe0, 0xba, 0x8a, 0x35, 0xca, 0x20, 0x0a, 0x33, 0x1a,
+    0xc9, 0xec, 0xa1, 0x56, 0xec, 0xc1, 0x44, 0x41, 0x81, 0x42, 0xd3, 0x94, 0xeb, 0x4b, 0xcd, 0xc3, 0xcd, 0xea, 0x8d, 0x8c,
+    0x6d, 0x54, 0x48, 0xf9, 0x56, 0xa8, 0x2e, 0xa9, 0xb3, 0xd8, 0x61, 0x24, 0xaf, 0x2a, 0x93, 0x0a, 0x6b, 0x61, 0x70, 0x11,
+    0x64, 0x3c, 0xc5, 0x34, 0x8c, 0x40, 0x81, 0xc3, 0x64, 0x0b, 0x06, 0x37, 0x14, 0x2f, 0xa9, 0x64, 0xbe, 0xcc, 0x72, 0x71,
+    0x11, 0xd0, 0xc6, 0xd7, 0x44, 0x8c, 0x46, 0xa3, 0x9d, 0xe1, 0x7c, 0xb1, 0xb7, 0x85, 0xbf, 0x76, 0xf9, 0x57, 0x90, 0x8f,
+    0x87, 0xb8, 0xac, 0x3c, 0x3d, 0x11, 0xe8, 0xbf, 0x0e, 0xcd, 0x4a, 0xb2, 0x8e, 0xa7, 0x8e, 0x11, 0xb4, 0x78, 0x4b, 0x3c,
+    0xdb, 0xd4, 0xc3, 0x7b, 0x5b, 0xe9, 0xe0, 0xfd, 0x60, 0xbb, 0x78, 0x1a, 0xfc, 0x49, 0x90, 0x8d, 0x41, 0x54, 0x51, 0x4a,
+    0xd7, 0x72, 0x29, 0x01, 0xb7, 0x1a, 0x14, 0x38, 0x95, 0x7d, 0xd1, 0x89, 0xf5, 0x7e, 0xa5, 0x9f, 0x48, 0xd0, 0xd0, 0x39,
+    0xd3, 0x22, 0x5e, 0xef, 0x13, 0x8a, 0x92, 0x07, 0x5c, 0xd7, 0x70, 0x9d, 0xbf, 0x07, 0xd2, 0x40, 0x73, 0x4c, 0xc8, 0xba,
+    0x4c, 0xcc, 0x42, 0x40, 0x2f, 0xea, 0x79, 0x96, 0xdd, 0x27, 0x42, 0x21, 0x2b, 0x30, 0xde, 0x6c, 0xaf, 0xca, 0xb5, 0xdf,
+    0x63, 0x3f, 0x11, 0xe3, 0x09, 0x64, 0xf9, 0x45, 0xd1, 0x65, 0x29, 0xf2, 0xd8, 0xf5, 0x2c, 0x1c, 0xcf, 0x28, 0xfe, 0xe0,
+    0x2f, 0x16, 0xd1, 0x0d, 0x06, 0x25, 0xb8, 0x08, 0xd7, 0x5b, 0x8b, 0x4c, 0xf8, 0xf1, 0x44, 0xe4, 0xb3, 0x20, 0x4c, 0x25,
+    0x37, 0x02, 0xfa, 0xc9, 0x38, 0x24, 0x68, 0x59, 0x13, 0x86, 0x02, 0xc8, 0xd5, 0x46, 0xe1, 0x6a, 0xfa, 0x99, 0x6d, 0x6b,
+    0x43, 0x6d, 0xad, 0x21, 0x92, 0xda, 0xca, 0x2c, 0xa0, 0x56, 0x68, 0x84, 0xdf, 0x15, 0x66, 0x6a, 0xe7, 0x50, 0x58, 0x01,
+    0xbe, 0xbd, 0x51, 0x79, 0xe5, 0x2a, 0xc3, 0x69, 0xa2, 0x26, 0x9c, 0x26, 0x2a, 0x22, 0x68, 0xc2, 0x89, 0xce, 0x51, 0x07,
+    0x6a, 0x3f, 0x8f, 0xa3, 0xf3, 0x02, 0x83, 0xb9, 0xd3, 0x28, 0xb9, 0x1e, 0xdc, 0x58, 0x8b, 0x0d, 0x6b, 0x45, 0x66, 0x6f,
+    0xf2, 0x08, 0x8e, 0x60, 0xe3, 0x8b, 0x03, 0x11, 0xe6, 0x3e, 0x70, 0xcf, 0x21, 0x2e, 0xe9, 0x38, 0x02, 0x64, 0x85, 0x84,
+    0xd6, 0xfa, 0xb6, 0x65, 0x7a, 0x59, 0x4a, 0xa6, 0x76, 0x26, 0xa8, 0x4e, 0xd9, 0x36, 0x8f, 0xd4, 0xb2, 0xb2, 0x9d, 0x61,
+    0x2d, 0x76, 0x1d, 0xce, 0x83, 0x04, 0xc4, 0xb2, 0x07, 0x3e, 0x76, 0x12, 0x4f, 0xb2, 0x26, 0x6b, 0x47, 0x85, 0x93, 0x6c,
+    0x5b, 0x90, 0xfd, 0x91, 0x38, 0x02, 0xf9, 0x13, 0xb9, 0x7a, 0xa9, 0xd6, 0x15, 0x1a, 0xed, 0xc2, 0x9a, 0x92, 0xa3, 0xb3,
+    0xb4, 0x86, 0x98, 0xfb, 0x60, 0x29, 0xaa, 0x66, 0xa0, 0x6a, 0xb9, 0xf5, 0x3a, 0xf0, 0xaf, 0x02, 0x31, 0x22, 0xe5, 0x6b,
+    0xfa, 0x13, 0x3d, 0x74, 0x0d, 0x40, 0x25, 0x2f, 0x01, 0x14, 0xc9, 0x26, 0xb8, 0x1e, 0x04, 0x78, 0x2d, 0x59, 0x2a, 0xf4,
+    0x03, 0x89, 0x29, 0xcb, 0x63, 0x51, 0x41, 0x18, 0x29, 0xa5, 0x4a, 0xf5, 0x6a, 0x82, 0x0c, 0x83, 0xb4, 0x4f, 0x59, 0xb5,
+    0x81, 0x2a, 0x58, 0x26, 0x76, 0xe7, 0xeb, 0x2d, 0x13, 0x3b, 0xf9, 0xe2, 0x55, 0x8c, 0xd8, 0xdb, 0xba, 0xa3, 0x32, 0x30,
+    0x52, 0xd0, 0x44, 0x4e, 0xb8, 0xbe, 0x3e, 0x6a, 0xf2, 0x9c, 0x03, 0x18, 0x82, 0x43, 0x21, 0x6b, 0xe2, 0x25, 0xbf, 0x84,
+    0x2f, 0x43, 0x3b, 0xfa, 0x71, 0x1d, 0x4e, 0x43, 0x1d, 0x2c, 0x79, 0x8e, 0xaa, 0x1e, 0x84, 0x71, 0x38, 0x1c, 0x9a, 0x80,
+    0xc9, 0xdb, 0x20, 0xbf, 0x4e, 0xd2, 0x4f, 0xe5, 0x46, 0x59, 0x38, 0x71, 0xc2, 0x25, 0x50, 0xf7, 0xd5, 0xfb, 0x52, 0xb5,
+    0x70, 0x51, 0x11, 0x84, 0xf9, 0x53, 0x92, 0xe5, 0x88, 0xbc, 0x5d, 0x5b, 0x66, 0x96, 0xcc, 0xe4, 0xab, 0x62, 0xab, 0x8d,
+    0x83, 0x80, 0x69, 0x30, 0x4d, 0x83, 0x6c, 0x86, 0x03, 0x67, 0x0a, 0x15, 0xd9, 0xe3, 0x03, 0x57, 0xd0, 0xf4, 0xab, 0x09,
+    0x82, 0xc1, 0xb4, 0x21, 0x8c, 0x4a, 0x4b, 0xb0, 0xde, 0xbf, 0xe4, 0xd1, 0xb1, 0xa6, 0x96, 0x4c, 0xd1, 0x68, 0x31, 0x64,
+    0xb5, 0xab, 0xf2, 0x30, 0x39, 0x28, 0x7f, 0xe6, 0xc7, 0x9f, 0xc8, 0x61, 0x88, 0x82, 0xf8, 0x32, 0x9f, 0x1d, 0x75, 0xf7,
+    0x76, 0xdb, 0x0b, 0xe9, 0xcf, 0x19, 0xb8, 0x3f, 0x28, 0xa1, 0x6a, 0x06, 0x44, 0x8f, 0xfb, 0xb8, 0xa0, 0x3e, 0x72, 0xe8,
+    0x63, 0x18, 0x25, 0x63, 0x3f, 0x6a, 0x2c, 0xa5, 0xd6, 0xf0, 0x91, 0x15, 0x24, 0x23, 0x01, 0xcf, 0xf0, 0x0f, 0x22, 0x00,
+    0x2c, 0x57, 0x4e, 0x5f, 0x9d, 0xf4, 0xd7, 0xd2, 0xc1, 0x06, 0x50, 0x45, 0x88, 0x37, 0x37, 0x38, 0x39, 0x15, 0x44, 0x90,
+    0x28, 0x22, 0x5e, 0x95, 0xc0, 0x39, 0xdf, 0x69, 0x99, 0x05, 0x29, 0x71, 0x1d, 0x99, 0x98, 0x71, 0x32, 0x5f, 0xc0, 0x88,
+    0x9d, 0xf2, 0xda, 0x78, 0x46, 0xb3, 0xc1, 0xbf, 0x87, 0x0a, 0x80, 0x3c, 0x48, 0x8c, 0xfa, 0x55, 0x33, 0xe4, 0x85, 0xaa,
+    0xa8, 0x87, 0xad, 0x9b, 0x4a, 0x5c, 0x4d, 0x0d, 0x87, 0x0e, 0xc4, 0x9c, 0xa6, 0xae, 0x45, 0x88, 0x47, 0x0f, 0x8b, 0xc3,
+    0x82, 0x95, 0xcb, 0x40, 0x83, 0x59, 0xe9, 0xef, 0x61, 0xd0, 0xc1, 0x00, 0xad, 0x0d, 0xa9, 0x35, 0x8d, 0x0c, 0xae, 0x07,
+    0xb7, 0x5f, 0x0a, 0x5b, 0x9e, 0x42, 0x1b, 0x43, 0x2b, 0x25, 0x94, 0x72, 0x42, 0x5b, 0x6f, 0x09, 0x80, 0x25, 0x42, 0x4a,
+    0x55, 0x59, 0x8a, 0x55, 0xe1, 0xc3, 0xc2, 0xbe, 0x00, 0xda, 0xb3, 0x07, 0xa8, 0x0a, 0x62, 0xb0, 0xe2, 0xeb, 0x56, 0x5f,
+    0x2b, 0xfb, 0x73, 0xd7, 0x5f, 0x58, 0xb5, 0xac, 0x81, 0x56, 0xfa, 0xa8, 0xec, 0x1c, 0x9c, 0x06, 0x79, 0x0e, 0x9a, 0x3b,
+    0x6b, 0xac, 0x90, 0xc8, 0x0d, 0x7d, 0x11, 0xd3, 0x9e, 0xbd, 0x02, 0x22, 0x1f, 0x6b, 0x38, 0xd3, 0x65, 0x0c, 0xa7, 0xbd,
+    0xa0, 0x77, 0xa0, 0x3f, 0xd6, 0xae, 0x09, 0x6a, 0x17, 0xbc, 0x38, 0x31, 0xac, 0x18, 0xd7, 0x4e, 0x0d, 0x93, 0x5f, 0x6a,
+    0x51, 0x33, 0xf0, 0x35, 0xe1, 0x2f, 0x8e, 0x97, 0xd5, 0x9b, 0x6a, 0x8e, 0xa2, 0x55, 0x87, 0xbe, 0x1c, 0xea, 0xeb, 0x5c,
+    0xad, 0x6a, 0x6b, 0x03, 0xc6, 0x34, 0xcd, 0x19, 0xb9, 0x8a, 0x31, 0x5c, 0xfb, 0x69, 0x4c, 0x7b, 0xa1, 0x1f, 0xb8, 0xa2,
+    0xa8, 0x0b, 0x03, 0x6a, 0x88, 0x53, 0x7f, 0x9c, 0x27, 0xe9, 0x0d, 0xd4, 0x0f, 0xf2, 0x15, 0xfc, 0xf3, 0x92, 0xab, 0x09,
+    0xaa, 0x57, 0xc5, 0x42, 0xb0, 0x26, 0x4d, 0xe7, 0xd0, 0x7d, 0x20, 0x7e, 0x5e, 0x4c, 0xfc, 0x3c, 0xd0, 0x8b, 0x98, 0x9f,
+    0x17, 0xb8, 0x41, 0x2b, 0x40, 0x27, 0xc0, 0x1a, 0x59, 0x56, 0xb9, 0x0a, 0x7d, 0xf1, 0xee, 0xec, 0x99, 0x59, 0x98, 0xac,
+    0xda, 0xfe, 0xb0, 0x99, 0x04, 0x57, 0xd9, 0xcc, 0x20, 0x0a, 0xd6, 0x4b, 0x2a, 0xc1, 0xbd, 0xda, 0x45, 0x7e, 0xd4, 0x1d,
+    0x5e, 0x84, 0x71, 0x9d, 0x9f, 0xc3, 0x9a, 0xc4, 0xe4, 0xe6, 0xfc, 0xb1, 0x92, 0xc2, 0x4b, 0x42, 0x57, 0x0d, 0xa6, 0x81,
+    0x04, 0xdb, 0x00, 0x85, 0x9b, 0x7d, 0x07, 0xf0, 0xe5, 0xe8, 0x15, 0xbc, 0x8e, 0x45, 0x3a, 0xc5, 0x40, 0xdc, 0xe3, 0x60,
+    0x91, 0x26, 0x97, 0x69, 0x85, 0x6a, 0x30, 0x0a, 0x47, 0x54, 0x5b, 0x87, 0xaa, 0xdd, 0x37, 0xcc, 0xdd, 0xa8, 0x5c, 0x0f,
+    0xa9, 0xe5, 0xce, 0x81, 0x98, 0x85, 0x93, 0x49, 0x10, 0x6b, 0x28, 0x88, 0x89, 0x42, 0x61, 0x70, 0xe1, 0xa7, 0xd5, 0xbb,
+    0x7a, 0x72, 0xdb, 0x5f, 0xa8, 0x45, 0xd4, 0xae, 0x4d, 0x53, 0x24, 0x00, 0x65, 0x8f, 0x85, 0x14, 0x39, 0xe0, 0x62, 0x31,
+    0x1a, 0xee, 0x65, 0x87, 0x25, 0x47, 0x57, 0xfb, 0x65, 0xba, 0x4f, 0xb2, 0x97, 0xc7, 0xa3, 0x3f, 0x36, 0xde, 0x26, 0x90,
+    0xf8, 0x55, 0x64, 0x29, 0x88, 0x42, 0xe2, 0x4d, 0xd5, 0x3c, 0xe7, 0xc9, 0xe5, 0x65, 0x54, 0xed, 0xd1, 0xdb, 0x62, 0xcd,
+    0xd5, 0xd8, 0x4a, 0x14, 0x7d, 0xb3, 0x95, 0xbb, 0x33, 0x98, 0x78, 0xe8, 0x6c, 0x87, 0x28, 0x86, 0x95, 0xae, 0xb2, 0x95,
+    0xef, 0x20, 0xd3, 0x16, 0x8c, 0x5b, 0xfc, 0xe4, 0x22, 0xb5, 0x5b, 0x4a, 0xd7, 0x95, 0xdb, 0x69, 0xf2, 0xe8, 0xd7, 0xb3,
+    0xc0, 0x5f, 0x14, 0x5f, 0x16, 0x88, 0x4d, 0xc1, 0x97, 0xe3, 0x0e, 0x58, 0x67, 0xb9, 0x54, 0x3d, 0x12, 0xbf, 0xfe, 0x76,
+    0xd8, 0x99, 0x24, 0xe3, 0x25, 0xaa, 0xa2, 0x21, 0x70, 0xed, 0x8b, 0x2b, 0xf8, 0xf1, 0x1a, 0xd6, 0x24, 0xb0, 0x46, 0x49,
+    0x7b, 0xde, 0xc9, 0xbb, 0x37, 0xcf, 0x39, 0x35, 0x1b, 0xb1, 0x0b, 0x26, 0xde, 0x16, 0x2c, 0xa4, 0x62, 0xda, 0x7c, 0xe9,
+    0xf5, 0xc5, 0x97, 0x0e, 0xb2, 0xac, 0x8c, 0xf9, 0x1d, 0xd2, 0x83, 0x72, 0x7e, 0xf9, 0x89, 0xf6, 0xc4, 0x31, 0x5b, 0x84,
+    0x2c, 0xd8, 0xeb, 0xf0, 0x2a, 0xc0, 0xf7, 0x81, 0x7a, 0x5d, 0xda, 0xbe, 0x87, 0x72, 0xd0, 0x2b, 0xcb, 0x85, 0x0c, 0x4a,
+    0xbe, 0x04, 0xa3, 0x22, 0xcb, 0xe4, 0xd2, 0xb2, 0x07, 0xbd, 0x1e, 0x1d, 0xcb, 0x8e, 0x4d, 0xb0, 0xc6, 0x74, 0x6f, 0xd6,
+    0x67, 0xba, 0xec, 0xd9, 0x95, 0x1f, 0x46, 0x68, 0x41, 0x24, 0x36, 0x8b, 0x64, 0xb1, 0x8c, 0x00, 0x0b, 0x5d, 0xce, 0x71,
+    0x08, 0x7c, 0x75, 0xbb, 0x85, 0x02, 0x3c, 0xc2, 0x5f, 0xf0, 0xbf, 0x1a, 0xa9, 0x70, 0x99, 0x84, 0x32, 0xac, 0xe2, 0x2c,
+    0x17, 0x2a, 0xe9, 0xea, 0x48, 0x68, 0x0a, 0x5e, 0x06, 0xf9, 0x8b, 0x88, 0xf4, 0xfa, 0x8f, 0x37, 0xaf, 0x26, 0x3d, 0xcf,
+    0xdd, 0xaf, 0xf2, 0x98, 0x16, 0x18, 0x09, 0xcc, 0x9b, 0x34, 0xe3, 0x7e, 0xb1, 0x55, 0x38, 0xa5, 0x05, 0x39, 0x75, 0xf7,
+    0xe0, 0x01, 0x36, 0x47, 0x34, 0xac, 0xd2, 0x21, 0x89, 0xc1, 0x50, 0xaa, 0x06, 0x71, 0x74, 0x74, 0x24, 0x3c, 0x54, 0x0f,
+    0x9e, 0xf8, 0xfd, 0x77, 0xb1, 0xa2, 0x8e, 0x87, 0x70, 0x6a, 0xde, 0x0b, 0x8f, 0xb2, 0x25, 0xbd, 0xc3, 0x0e, 0x26, 0x75,
+    0xa2, 0x80, 0x49, 0x5e, 0xc0, 0x57, 0x7f, 0x0a, 0x27, 0x85, 0x78, 0x15, 0xd4, 0xbb, 0x15, 0x41, 0x94, 0x05, 0xab, 0x20,
+    0x12, 0x4e, 0x95, 0x00, 0xcb, 0xa2, 0x85, 0x00, 0xe9, 0x3f, 0x3d, 0x11, 0xee, 0xe6, 0x14, 0x58, 0x55, 0x74, 0xee, 0x71,
+    0x04, 0x9a, 0x92, 0x7f, 0x5b, 0x06, 0xe9, 0xcd, 0x29, 0x85, 0x3d, 0x12, 0x0c, 0x48, 0xf7, 0x3c, 0x2b, 0x1f, 0xd4, 0xeb,
+    0x63, 0xc2, 0xd4, 0x0b, 0x7f, 0x3c, 0xc3, 0xb6, 0xcc, 0x48, 0x98, 0x26, 0x4a, 0xd2, 0x8a, 0x4c, 0x3f, 0x4c, 0x83, 0x39,
+    0xa8, 0xc6, 0x9e, 0xc7, 0x9b, 0x55, 0x9e, 0x64, 0x84, 0x55, 0xd0, 0xe5, 0x0e, 0x9a, 0x05, 0x9a, 0xe6, 0x16, 0x41, 0xe3,
+    0x20, 0xd7, 0x81, 0x66, 0x76, 0x00, 0x1b, 0x0d, 0x2c, 0x70, 0x86, 0x38, 0xad, 0x65, 0x0a, 0x4f, 0xfc, 0xab, 0x50, 0x23,
+    0x67, 0xc6, 0x30, 0xad, 0x81, 0x35, 0x02, 0x14, 0x60, 0xfd, 0x63, 0xc8, 0xef, 0xfa, 0x34, 0x50, 0x59, 0xcb, 0xc2, 0x09,
+    0x04, 0xde, 0x46, 0xc8, 0x6e, 0x52, 0x5f, 0x0b, 0x67, 0xc4, 0xcf, 0x6e, 0xe2, 0xb1, 0x56, 0x05, 0xc2, 0xde, 0x47, 0xd0,
+    0xe2, 0x41, 0xab, 0xbb, 0x15, 0xe3, 0xb1, 0x76, 0xe0, 0xbc, 0xfe, 0x53, 0xde, 0x3a, 0x1e, 0xe6, 0x69, 0x38, 0xef, 0x69,
+    0xba, 0x5c, 0x2e, 0xc0, 0x5f, 0x3c, 0x02, 0x73, 0x9a, 0x66, 0xc1, 0xab, 0x38, 0xef, 0xad, 0x83, 0x85, 0xdb, 0x67, 0x1a,
+    0x96, 0xa1, 0x2e, 0xf8, 0x0c, 0x0d, 0x10, 0xc1, 0x1d, 0x2f, 0xdd, 0x58, 0x63, 0x80, 0xba, 0xa1, 0x41, 0x63, 0xd2, 0x21,
+    0xe5, 0x61, 0xe0, 0xf4, 0xdc, 0x23, 0x42, 0x80, 0x18, 0xde, 0x63, 0x60, 0xf4, 0x0b, 0x10, 0x45, 0x4a, 0x2d, 0xc9, 0x49,
+    0x92, 0x4a, 0xd3, 0xa3, 0xbc, 0x79, 0x50, 0xb1, 0xde, 0x7b, 0x70, 0xd3, 0x41, 0x8e, 0xc0, 0xcd, 0x89, 0x04, 0xae, 0xae,
+    0x51, 0x5b, 0xc3, 0x53, 0x10, 0x4d, 0x32, 0x9c, 0x81, 0x14, 0x74, 0x64, 0x1a, 0xe3, 0x4c, 0xe4, 0xe9, 0x8d, 0xa6, 0x37,
+    0x98, 0x4f, 0xdc, 0xfe, 0xc1, 0xa1, 0xfa, 0xd7, 0x7e, 0x98, 0x8b, 0x69, 0x90, 0x03, 0x3b, 0x7a, 0xdb, 0xfe, 0x22, 0xdc,
+    0xe6, 0xbd, 0xea, 0x2d, 0xcc, 0xef, 0x0b, 0xf2, 0x59, 0x02, 0x46, 0xdc, 0x7b, 0xff, 0xee, 0xf4, 0xcc, 0xdb, 0xea, 0x60,
+    0x6a, 0x5e, 0x90, 0x82, 0x63, 0xf0, 0x45, 0x78, 0x52, 0x1c, 0x07, 0x44, 0x0a, 0xa8, 0x82, 0x51, 0xe6, 0x70, 0x4c, 0xc2,
+    0xb8, 0xfd, 0xd7, 0x0c, 0x24, 0x52, 0xdc, 0x6e, 0xd1, 0x69, 0x9a, 0x03, 0xf1, 0x6f, 0xa7, 0xef, 0xde, 0x82, 0x78, 0xa7,
+    0x60, 0xb1, 0xc2, 0xe9, 0x4d, 0xef, 0x4b, 0x87, 0x23, 0x2d, 0xf8, 0xef, 0x56, 0x07, 0x87, 0x77, 0x40, 0xb3, 0xb7, 0xd5,
+    0x41, 0xea, 0x1f, 0xd0, 0x1c, 0x40, 0x39, 0x12, 0x80, 0x22, 0x12, 0x4c, 0x58, 0x00, 0xa6, 0x95, 0x3f, 0x78, 0x11, 0xfb,
+    0xfb, 0x5b, 0x60, 0x9c, 0x78, 0xcf, 0xed, 0x40, 0x4e, 0x1b, 0x2a, 0x29, 0xb9, 0x7d, 0xe8, 0x89, 0xa7, 0xcd, 0x58, 0x41,
+    0xed, 0xdb, 0x19, 0x56, 0x40, 0xa2, 0xef, 0x0b, 0x70, 0xa0, 0xb6, 0x3a, 0x81, 0x5c, 0x7e, 0x80, 0x8f, 0xb2, 0x0c, 0x40,
+    0x06, 0x2d, 0x31, 0x04, 0x0a, 0x2e, 0xa3, 0x5c, 0xd3, 0x4f, 0x11, 0x74, 0x88, 0x43, 0x57, 0xb3, 0xa9, 0x0b, 0x93, 0x4f,
+    0xe5, 0x09, 0x94, 0x4e, 0x21, 0x4e, 0x21, 0xed, 0x70, 0x83, 0x5c, 0xe0, 0x72, 0x85, 0x4b, 0x31, 0x02, 0x79, 0x63, 0x4c,
+    0x00, 0x52, 0xea, 0x25, 0x4e, 0x69, 0x63, 0x19, 0x71, 0x78, 0xb2, 0x69, 0x53, 0xc9, 0x98, 0x8c, 0xbc, 0xee, 0xb3, 0x6f,
+    0xba, 0x67, 0x0a, 0xa1, 0x06, 0xf6, 0xb8, 0x92, 0x01, 0xdf, 0xb7, 0xba, 0x32, 0xd5, 0xe4, 0xb6, 0xa2, 0x77, 0xe8, 0x5a,
+    0x7f, 0xad, 0xfb, 0xab, 0x79, 0x9a, 0x69, 0x2b, 0x8f, 0x86, 0xc0, 0x6c, 0x78, 0x2f, 0xc1, 0xfa, 0x02, 0x71, 0xf2, 0x04,
+    0xa9, 0x44, 0x1c, 0x2e, 0x95, 0x8b, 0x00, 0x86, 0x1b, 0xcf, 0x44, 0x8f, 0xaa, 0xae, 0x10, 0x92, 0x32, 0x00, 0xe0, 0x58,
+    0x50, 0x8e, 0x54, 0x61, 0x38, 0x07, 0x8a, 0xc3, 0x12, 0xab, 0x56, 0x5f, 0xd9, 0x3b, 0x3d, 0x5a, 0x84, 0x70, 0x5d, 0xc1,
+    0x3b, 0x64, 0x8d, 0xb4, 0x8e, 0xb5, 0xa3, 0x56, 0xd6, 0x3a, 0xd6, 0x66, 0xd7, 0xaa, 0x69, 0x2a, 0x6e, 0x9c, 0xd5, 0xa9,
+    0xc2, 0x30, 0xc3, 0xcd, 0xab, 0xb5, 0x90, 0xb0, 0x12, 0x82, 0x90, 0x4b, 0x65, 0xa9, 0x81, 0x2c, 0x5c, 0xd6, 0x6b, 0x1d,
+    0x72, 0x9e, 0x39, 0x54, 0x6e, 0x0f, 0x62, 0x43, 0xc5, 0x43, 0x2b, 0xf8, 0x6d, 0xde, 0x14, 0xfb, 0xa6, 0xfa, 0xc7, 0xcc,
+    0xdd, 0x81, 0x35, 0x8f, 0x5b, 0x1d, 0x6b, 0x08, 0x07, 0xf6, 0x78, 0xb6, 0x3a, 0x4c, 0xd2, 0x03, 0x49, 0x5a, 0xa8, 0x29,
+    0xfd, 0x0e, 0x58, 0xc2, 0x7c, 0x3b, 0xbd, 0xc0, 0x31, 0x10, 0xa6, 0x2e, 0xa9, 0x07, 0xcf, 0xe1, 0x98, 0xb5, 0x62, 0x5d,
+    0xe6, 0x17, 0xee, 0x5f, 0x37, 0xee, 0x1b, 0x38, 0x8e, 0x68, 0x57, 0x78, 0xcc, 0x77, 0x13, 0x59, 0xdf, 0x8c, 0xe4, 0x4e,
+    0x92, 0x6b, 0xc1, 0x69, 0x2c, 0xc0, 0xa5, 0xc1, 0xa0, 0x83, 0xb3, 0x11, 0x4b, 0x2a, 0x23, 0xed, 0xcc, 0x9f, 0xe2, 0x73,
+    0x39, 0x2f, 0x7e, 0xee, 0xd7, 0x4f, 0x3e, 0xd7, 0x31, 0x87, 0x3f, 0x57, 0xcc, 0x5d, 0x69, 0x83, 0x58, 0xf7, 0xae, 0x9b,
+    0xeb, 0xbe, 0xc5, 0xf6, 0xb6, 0x90, 0x8d, 0x01, 0x60, 0x90, 0xc5, 0x5e, 0x2e, 0x82, 0xcf, 0xd0, 0x46, 0xdc, 0x04, 0xb9,
+    0x94, 0x6a, 0xc0, 0x6b, 0xc8, 0xd0, 0x70, 0x7a, 0xac, 0xc7, 0x21, 0x07, 0x65, 0xc9, 0x7a, 0x8e, 0xa4, 0x7a, 0x63, 0xf8,
+    0xc3, 0x10, 0x96, 0x62, 0xe9, 0x9f, 0xce, 0xde, 0xbc, 0x46, 0xb6, 0x78, 0xb2, 0xc0, 0x6d, 0x4b, 0x6b, 0x02, 0xdc, 0xdd,
+    0xcb, 0xc5, 0xb1, 0x67, 0xcb, 0x7c, 0x35, 0x10, 0xbb, 0xdb, 0xb9, 0xbf, 0xe8, 0x31, 0x6b, 0x1f, 0x1d, 0x77, 0xce, 0xed,
+    0xe5, 0xb9, 0x1b, 0x11, 0x11, 0xa5, 0x73, 0x4b, 0xc2, 0x3a, 0x22, 0x04, 0x4b, 0x75, 0x51, 0x71, 0x70, 0xa9, 0x6e, 0xc3,
+    0x97, 0x96, 0xd7, 0x79, 0x9a, 0xc4, 0x97, 0x32, 0xe5, 0xf5, 0xfe, 0x17, 0xc2, 0x61, 0x68, 0xb4, 0xc0, 0xed, 0x81, 0x2e,
+    0xb4, 0x34, 0xc0, 0x2d, 0x1e, 0x50, 0xa0, 0x76, 0xfa, 0xad, 0xd4, 0xb2, 0x4f, 0x85, 0xd7, 0xc3, 0x1f, 0x7d, 0x0f, 0x7c,
+    0x06, 0xaf, 0xf7, 0x2e, 0x0e, 0x06, 0xb0, 0xf4, 0xc8, 0xfb, 0xde, 0x6d, 0x6d, 0x9c, 0x6a, 0xbf, 0x26, 0x14, 0x9c, 0x07,
+    0x59, 0x6e, 0xd9, 0x9a, 0x0a, 0xdc, 0xea, 0xc3, 0x77, 0x25, 0xe2, 0x21, 0x71, 0x98, 0x80, 0xe5, 0x03, 0x78, 0xdd, 0xe3,
+    0x33, 0xe8, 0x6a, 0x45, 0x88, 0x8f, 0x17, 0x20, 0x6d, 0x71, 0x29, 0x24, 0xb0, 0x97, 0x51, 0xc1, 0x20, 0x23, 0x02, 0xae,
+    0xd9, 0xd2, 0x3a, 0xef, 0xf4, 0x87, 0x7f, 0x4d, 0xc2, 0xb8, 0xe7, 0x79, 0xf6, 0xda, 0x1b, 0xb1, 0xe0, 0x85, 0x54, 0xd6,
+    0xb3, 0x38, 0x88, 0x94, 0x52, 0x51, 0x8b, 0xa0, 0x84, 0x25, 0xb0, 0x8c, 0xa4, 0x82, 0x9e, 0xf7, 0x82, 0xf4, 0x91, 0x3a,
+    0x80, 0x6a, 0x33, 0xef, 0x01, 0x28, 0x17, 0x6e, 0x55, 0xa9, 0x34, 0x0a, 0x53, 0x61, 0x86, 0x6d, 0xb4, 0x87, 0xab, 0xb0,
+    0x64, 0x1f, 0xa8, 0xb2, 0x90, 0xb6, 0x85, 0xee, 0x86, 0xc3, 0xa1, 0x67, 0x9b, 0x88, 0x75, 0x0a, 0x07, 0x97, 0xc0, 0xdf,
+    0xd4, 0x02, 0x5a, 0xee, 0x88, 0x6b, 0x02, 0x23, 0x32, 0x73, 0x53, 0x1f, 0x94, 0xfd, 0xb7, 0x33, 0x6c, 0x98, 0xed, 0x5c,
+    0xa0, 0x90, 0x77, 0x27, 0x1b, 0x43, 0x21, 0x83, 0x06, 0x46, 0xa6, 0x92, 0x3d, 0xf2, 0xf2, 0x7c, 0xd9, 0xdc, 0xb1, 0xd6,
+    0x30, 0x61, 0xfb, 0x66, 0x96, 0x49, 0xb3, 0x57, 0x25, 0x6f, 0x4b, 0xb6, 0xb6, 0x62, 0x46, 0x94, 0xc9, 0xb1, 0xc2, 0x48,
+    0xa8, 0x64, 0x0a, 0x6d, 0x1b, 0xb8, 0x89, 0x31, 0x4a, 0xfc, 0x5c, 0x50, 0xe4, 0xab, 0x53, 0x41, 0x00, 0xf7, 0x4e, 0xb5,
+    0x8a, 0x76, 0xdb, 0x55, 0x68, 0x84, 0x6e, 0x7b, 0xa5, 0x2a, 0x3b, 0x75, 0x25, 0xbf, 0x8a, 0x50, 0xc5, 0x00, 0x9c, 0xa6,
+    0x52, 0x23, 0x6b, 0xaa, 0x33, 0x88, 0x56, 0x58, 0x51, 0x09, 0x6f, 0x19, 0x87, 0x7f, 0x5b, 0xca, 0x6e, 0x30, 0xe8, 0x09,
+    0xa2, 0x8b, 0x1b, 0x11, 0xa7, 0x41, 0xde, 0xa3, 0x85, 0x31, 0x51, 0x85, 0x16, 0xd9, 0x47, 0xc7, 0xb4, 0x92, 0x18, 0xea,
+    0x95, 0x6a, 0x1f, 0x47, 0x0c, 0x0e, 0x71, 0x4f, 0x46, 0x02, 0x8e, 0x65, 0x48, 0xe0, 0xc1, 0x03, 0xfe, 0x21, 0xdd, 0x74,
+    0x71, 0x8f, 0xa3, 0x69, 0xfd, 0xdf, 0x18, 0x17, 0xbb, 0xc7, 0xc6, 0xd6, 0xf8, 0xeb, 0xe4, 0x1b, 0x35, 0xb0, 0xd9, 0x0e,
+    0x76, 0x38, 0x76, 0x3d, 0xb8, 0xf3, 0xca, 0xad, 0xa8, 0x3d, 0x36, 0xca, 0xee, 0xe9, 0x4d, 0x51, 0x75, 0x7a, 0x53, 0xe0,
+    0xf9, 0x42, 0x93, 0x5c, 0x35, 0xdc, 0x5d, 0x73, 0x22, 0x84, 0x3a, 0x1e, 0xdc, 0xff, 0x42, 0x7f, 0x6f, 0xbb, 0x86, 0x11,
+    0x65, 0x41, 0xa7, 0x80, 0xc9, 0x08, 0x2f, 0x60, 0x80, 0x7f, 0x47, 0x72, 0x8f, 0x01, 0xf7, 0x1d, 0x0f, 0x04, 0xdd, 0x0c,
+    0xd2, 0xdb, 0x19, 0xee, 0xf4, 0x0f, 0x69, 0x0f, 0x08, 0xc8, 0x55, 0x38, 0xa1, 0x58, 0x3c, 0xa3, 0x62, 0x9f, 0x67, 0x2b,
+    0xa0, 0x50, 0x98, 0x01, 0x3c, 0x1d, 0x2a, 0x8a, 0x27, 0x9a, 0x45, 0xf1, 0x10, 0xb3, 0x30, 0x97, 0x87, 0x98, 0xdd, 0x9f,
+    0x62, 0xb7, 0xaa, 0x8f, 0xe2, 0x3e, 0xf3, 0xb9, 0x2b, 0x28, 0xe5, 0xc5, 0xaa, 0x93, 0x76, 0xa4, 0xa5, 0x44, 0x26, 0xe5,
+    0xad, 0x91, 0x11, 0x27, 0xbe, 0xa6, 0x04, 0x82, 0x34, 0x1b, 0xa5, 0x8f, 0x36, 0xd2, 0x44, 0x55, 0xad, 0x55, 0xa2, 0x58,
+    0x03, 0x00, 0xb2, 0x6a, 0x09, 0x0e, 0x6b, 0xb2, 0x60, 0x62, 0x04, 0xf3, 0x37, 0xed, 0x4f, 0x4b, 0x2e, 0xa1, 0x4d, 0x8a,
+    0x15, 0xf1, 0xd7, 0x3f, 0x68, 0x2d, 0xc0, 0x27, 0x63, 0x7f, 0x2d, 0x30, 0xd9, 0x6f, 0x07, 0x72, 0x25, 0x4c, 0xa6, 0x5a,
+    0x03, 0xd5, 0xc1, 0x5a, 0x55, 0xc4, 0x11, 0x5b, 0x17, 0xa1, 0xe1, 0x62, 0x99, 0x99, 0x1a, 0x7a, 0x79, 0x7f, 0xab, 0xd4,
+    0x8d, 0xa2, 0x3f, 0x45, 0xd8, 0x9d, 0x86, 0x45, 0x81, 0x5f, 0xbd, 0xe0, 0x96, 0x36, 0x81, 0xd2, 0x3a, 0x63, 0x58, 0x0f,
+    0xe5, 0x02, 0xcb, 0x73, 0x81, 0xfa, 0xe8, 0x52, 0x85, 0x6f, 0x8a, 0x4b, 0xef, 0x5a, 0x4f, 0x45, 0x85, 0xd0, 0xd1, 0xfa,
+    0xe9, 0xcc, 0xd2, 0xe6, 0xbe, 0x0a, 0xa7, 0x2d, 0x6f, 0xb3, 0x52, 0xf9, 0x0e, 0x01, 0x43, 0x49, 0x44, 0x19, 0x1b, 0x04,
+    0xa8, 0x2e, 0x29, 0xb7, 0x3a, 0x9a, 0x55, 0x0f, 0x4c, 0x44, 0x46, 0x97, 0x51, 0x60, 0x6f, 0x24, 0x2b, 0x49, 0x36, 0x3b,
+    0x10, 0x3d, 0xb7, 0xa2, 0x2c, 0xe7, 0xba, 0x7d, 0xf1, 0x2f, 0xb4, 0xc7, 0xf3, 0xed, 0x1c, 0x21, 0x93, 0xce, 0x6b, 0x1d,
+    0x0e, 0x2e, 0xc6, 0x00, 0xbf, 0x0e, 0x4b, 0xd7, 0xb0, 0xb1, 0x66, 0x59, 0x95, 0x30, 0x71, 0xc4, 0xce, 0x1f, 0xf3, 0x6e,
+    0xd5, 0x3e, 0xd9, 0xe6, 0x5e, 0x9a, 0x1e, 0xa3, 0x61, 0xb6, 0x56, 0x8e, 0xda, 0xb8, 0x8a, 0x5d, 0x5b, 0xb9, 0x6a, 0x15,
+    0x18, 0xb4, 0x8a, 0x23, 0xb8, 0xb4, 0x68, 0x13, 0x48, 0x70, 0x65, 0xe5, 0x7b, 0x46, 0x12, 0xca, 0x39, 0xa4, 0xab, 0x9c,
+    0x20, 0x13, 0x2d, 0x90, 0x2d, 0x74, 0xb8, 0x40, 0x3e, 0xb7, 0x8b, 0x17, 0x64, 0x0e, 0x73, 0x73, 0x76, 0x79, 0x9b, 0x60,
+    0x81, 0xea, 0x14, 0x1d, 0x0f, 0xfe, 0xfd, 0x0f, 0x0a, 0x17, 0xdc, 0xff, 0xc2, 0xdd, 0x0f, 0x51, 0x15, 0x59, 0xd1, 0x80,
+    0xff, 0xf9, 0xaf, 0xff, 0x16, 0xea, 0xc8, 0xaf, 0xae, 0x23, 0xf7, 0x0d, 0x30, 0x36, 0x20, 0x13, 0x92, 0x28, 0x38, 0x70,
+    0x22, 0x6f, 0x24, 0xf1, 0x6e, 0x3b, 0xba, 0x2a, 0xef, 0xa0, 0x49, 0x19, 0x86, 0xfa, 0xe2, 0x77, 0x21, 0xf3, 0xe0, 0x89,
+    0x2f, 0x7b, 0xcf, 0xd2, 0xd4, 0xbf, 0x19, 0x86, 0x19, 0xfd, 0xed, 0x55, 0x34, 0xea, 0x43, 0xab, 0x8a, 0x62, 0xe9, 0x25,
+    0x00, 0xf7, 0xf7, 0xa1, 0xeb, 0xca, 0x76, 0xd0, 0x83, 0x8d, 0x89, 0xb1, 0xf3, 0x8c, 0x06, 0x99, 0xe3, 0x03, 0xce, 0x2f,
+    0x27, 0x5c, 0x4a, 0xf5, 0xaa, 0x00, 0x28, 0x53, 0xcf, 0x30, 0xb4, 0x9a, 0xc5, 0xf6, 0x6f, 0xfc, 0x7c, 0x36, 0xa4, 0x99,
+    0xe9, 0x55, 0xb4, 0xd8, 0xa6, 0xdd, 0x74, 0xa8, 0xe6, 0x65, 0x9e, 0x84, 0xdc, 0x36, 0x7e, 0xc2, 0x51, 0x0b, 0xdb, 0x01,
+    0xf2, 0xdc, 0x69, 0xf3, 0xbe, 0x75, 0xcc, 0xa2, 0x65, 0x40, 0xc2, 0x96, 0x8e, 0x75, 0x11, 0x89, 0xf2, 0xe0, 0xa8, 0xb5,
+    0xda, 0xd5, 0xde, 0x50, 0x11, 0x39, 0x46, 0xfb, 0xe4, 0xc5, 0xeb, 0x17, 0x67, 0x2f, 0xbe, 0x9e, 0xd9, 0x16, 0x6c, 0xb6,
+    0x35, 0x9e, 0x42, 0xda, 0xd1, 0xbb, 0x59, 0x48, 0xdf, 0x22, 0x07, 0xb9, 0x6a, 0x1b, 0x18, 0x29, 0xcb, 0x24, 0x30, 0x20,
+    0x51, 0xd3, 0xcf, 0xc6, 0xd1, 0xea, 0xd5, 0x60, 0xdb, 0x05, 0xaf, 0x9d, 0xa4, 0x94, 0x36, 0x73, 0x0d, 0xde, 0xc1, 0xd7,
+    0x32, 0x35, 0x8d, 0x82, 0x11, 0x6a, 0xef, 0xb1, 0x69, 0x2c, 0x82, 0xc3, 0x79, 0xd0, 0x10, 0x8d, 0xcc, 0xaf, 0xbf, 0xf5,
+    0x49, 0xcd, 0xe3, 0x63, 0x65, 0xbc, 0x01, 0x5e, 0xb0, 0x18, 0xe3, 0xea, 0x48, 0x3f, 0xd4, 0xc5, 0x10, 0x5a, 0x86, 0x06,
+    0x15, 0x8d, 0x71, 0xc6, 0x1a, 0x49, 0xe2, 0x9a, 0xe8, 0xe0, 0xca, 0xd9, 0x39, 0x2f, 0xed, 0x2d, 0x3c, 0x35, 0x30, 0x8e,
+    0xee, 0x7f, 0xb1, 0x02, 0x27, 0xe7, 0x55, 0x12, 0xda, 0x5a, 0x8a, 0xec, 0x9d, 0xa4, 0x82, 0xe4, 0xb4, 0xdb, 0xe7, 0x29,
+    0x73, 0xf8, 0xd7, 0xd8, 0xda, 0x29, 0x83, 0x6a, 0x25, 0x20, 0x72, 0x5f, 0xb9, 0x8d, 0x64, 0xc8, 0xf3, 0xf8, 0x55, 0xb2,
+    0x91, 0xcf, 0xf0, 0x92, 0x24, 0x8c, 0xf9, 0xbc, 0x60, 0x4e, 0x31, 0x78, 0x52, 0x62, 0xa6, 0x6e, 0xda, 0x44, 0x78, 0x54,
+    0xee, 0x1c, 0x31, 0x3a, 0x3f, 0x10, 0xab, 0xa3, 0xfb, 0x13, 0x83, 0x8e, 0xd5, 0x5b, 0xe2, 0xfc, 0x68, 0x8e, 0xab, 0xea,
+    0x17, 0x2b, 0x52, 0xd0, 0xea, 0xa6, 0xfb, 0x9c, 0x13, 0xf0, 0xc0, 0x1f, 0xe1, 0x88, 0x15, 0x7b, 0x6c, 0xb7, 0x8c, 0xf9,
+    0x79, 0x7b, 0xe1, 0xa0, 0x76, 0xad, 0xfc, 0x6c, 0x43, 0xa8, 0x06, 0xc1, 0xd0, 0x9a, 0xa1, 0xb7, 0x8b, 0xf0, 0x95, 0x4e,
+    0xf2, 0xae, 0x73, 0x72, 0x6d, 0xd2, 0x34, 0x74, 0x66, 0xcb, 0x31, 0xb4, 0x46, 0x8e, 0x6c, 0x39, 0x6c, 0xe8, 0x46, 0xce,
+    0xbe, 0x97, 0x03, 0x4b, 0xc1, 0xca, 0x82, 0xfb, 0x3a, 0x10, 0x74, 0xf1, 0x80, 0x7c, 0x89, 0x59, 0x38, 0xb7, 0xa2, 0x27,
+    0x9f, 0x70, 0x2d, 0x09, 0x16, 0x1b, 0x53, 0x4b, 0xf9, 0xe4, 0x8e, 0x3c, 0x85, 0xae, 0x6b, 0xab, 0xb8, 0xe7, 0x2d, 0x78,
+    0x7a, 0x6f, 0xfc, 0xcf, 0xd6, 0x9d, 0x4e, 0xba, 0x8e, 0xc9, 0xd9, 0xb9, 0x35, 0x87, 0x74, 0x56, 0x1d, 0x91, 0x68, 0x14,
+    0x38, 0x34, 0x37, 0xbc, 0x99, 0xf8, 0x9c, 0x02, 0x68, 0x2e, 0x6e, 0x79, 0xcc, 0x15, 0x2c, 0xac, 0x56, 0xde, 0x6a, 0x52,
+    0x7b, 0x95, 0x94, 0x1c, 0x8a, 0xbc, 0x96, 0xc7, 0xba, 0xb8, 0x0a, 0x24, 0xb9, 0x38, 0xc8, 0x6e, 0xc7, 0xbe, 0xee, 0xc4,
+    0x4a, 0x57, 0x95, 0x40, 0xc2, 0xc9, 0xed, 0x96, 0xb0, 0xae, 0x3f, 0x39, 0xe4, 0x87, 0x38, 0xf8, 0xac, 0xd8, 0xf9, 0x34,
+    0xbc, 0x88, 0x30, 0xb5, 0xd7, 0x4d, 0x79, 0x34, 0x4d, 0x74, 0x98, 0x53, 0x9f, 0x81, 0xb5, 0xaf, 0x9b, 0xad, 0x66, 0x8e,
+    0x62, 0x9e, 0xb7, 0xce, 0x32, 0x2e, 0x13, 0x8d, 0xee, 0x71, 0x13, 0xe5, 0x8b, 0x65, 0x45, 0xf9, 0xda, 0xb6, 0xee, 0x71,
+    0x1b, 0xca, 0x34, 0x3c, 0x35, 0xb7, 0xda, 0xb7, 0xa7, 0xb4, 0x41, 0x43, 0xca, 0xaf, 0xef, 0xce, 0xaf, 0x89, 0xaf, 0x5a,
+    0x58, 0x20, 0x0e, 0xaf, 0x26, 0xad, 0x0c, 0x3e, 0x29, 0x82, 0xa7, 0xdc, 0xf0, 0x88, 0x47, 0xf1, 0x6a, 0xf2, 0x95, 0x2c,
+    0x3c, 0xe5, 0x90, 0x15, 0x4c, 0xbb, 0x93, 0x6d, 0xcd, 0x19, 0xcd, 0x98, 0x2a, 0x80, 0x3e, 0xe9, 0xdc, 0xbf, 0x11, 0x33,
+    0x3c, 0xb4, 0x32, 0x9e, 0x21, 0xc5, 0x26, 0xed, 0xed, 0xfe, 0x9d, 0xb2, 0xb0, 0x2c, 0x18, 0xed, 0xe2, 0x2f, 0x32, 0x65,
+    0xbc, 0xd5, 0x82, 0x87, 0xda, 0x6c, 0x66, 0xeb, 0x4d, 0xdb, 0x26, 0xc6, 0xbe, 0xd6, 0x38, 0x39, 0x89, 0xfc, 0x5e, 0xdf,
+    0x95, 0xed, 0xce, 0xb9, 0x95, 0xd8, 0x7f, 0xff, 0x0b, 0x79, 0x0a, 0xaa, 0xc1, 0x47, 0x58, 0x85, 0xe1, 0x46, 0xd9, 0xf9,
+    0x0a, 0xe0, 0x56, 0xae, 0x7f, 0x19, 0xb4, 0x84, 0x67, 0x0e, 0x6d, 0xa2, 0xae, 0x96, 0x85, 0xe1, 0x02, 0x1f, 0x7e, 0x5e,
+    0xe0, 0xe9, 0x67, 0x54, 0xd8, 0x7c, 0x22, 0x98, 0x9f, 0xd9, 0x33, 0x5f, 0xd2, 0xef, 0x3e, 0x76, 0xdf, 0x76, 0x65, 0xcb,
+    0x21, 0x91, 0x82, 0x23, 0x5d, 0x30, 0xf9, 0xc6, 0xd0, 0x97, 0x26, 0xbb, 0xea, 0xc2, 0x3e, 0xa3, 0x4c, 0x9c, 0x34, 0xee,
+    0x22, 0x3d, 0x6a, 0xee, 0xef, 0x2b, 0xd2, 0x46, 0x98, 0x0a, 0x87, 0xcd, 0x99, 0x89, 0x81, 0x6f, 0x9b, 0xb6, 0xdf, 0x32,
+    0xec, 0x2d, 0xec, 0x8c, 0x57, 0x1d, 0xa7, 0xb6, 0xc9, 0x70, 0xd7, 0xc0, 0xb4, 0xa3, 0x25, 0x6a, 0xdd, 0x49, 0x79, 0x65,
+    0xa3, 0xe9, 0x18, 0xa7, 0x07, 0x65, 0xe4, 0xfe, 0x17, 0x4b, 0xc1, 0x9f, 0xdf, 0x29, 0x36, 0x8c, 0x10, 0x2f, 0x8b, 0xfd,
+    0xb4, 0x8a, 0x0e, 0x67, 0x7c, 0xee, 0xae, 0x0c, 0xa5, 0x95, 0xe7, 0x5a, 0x89, 0x47, 0x2b, 0x1d, 0x55, 0x3e, 0xa9, 0xd2,
+    0x46, 0x5b, 0x95, 0x19, 0xec, 0x2b, 0x2d, 0xe0, 0x19, 0xf0, 0x29, 0x5f, 0x56, 0xbf, 0xc2, 0x91, 0x2e, 0x89, 0x8f, 0x57,
+    0x00, 0xf1, 0x51, 0x26, 0x0a, 0xb6, 0x17, 0x40, 0x99, 0x33, 0x6c, 0x23, 0xf2, 0xe0, 0x01, 0x2f, 0x8d, 0x2c, 0xde, 0xc2,
+    0xdd, 0x71, 0x70, 0x55, 0x82, 0x29, 0x38, 0xd2, 0x64, 0x5f, 0xed, 0x06, 0x3a, 0x4d, 0xb1, 0xd0, 0x0a, 0x67, 0xc3, 0x00,
+    0x67, 0x14, 0x9b, 0xc3, 0xfe, 0xc8, 0x49, 0xb4, 0x8e, 0x7a, 0xa8, 0xe8, 0xa0, 0xa5, 0x0e, 0x5c, 0xc9, 0x88, 0xb7, 0x95,
+    0x3a, 0xaf, 0xe2, 0xee, 0x4c, 0x57, 0xeb, 0x31, 0x1f, 0xf1, 0x44, 0xaf, 0xd1, 0x91, 0x87, 0x6d, 0x05, 0x47, 0x9d, 0x1e,
+    0xc8, 0x5a, 0xa0, 0x6c, 0xdd, 0x67, 0xba, 0x3e, 0x31, 0x0a, 0x6f, 0x28, 0x5c, 0xa8, 0x9e, 0xa0, 0x4d, 0xf3, 0x9d, 0xc6,
+    0xab, 0xe9, 0xe7, 0x6d, 0xec, 0x0b, 0xef, 0xea, 0xfe, 0x1a, 0x1a, 0xf7, 0x5b, 0x25, 0xec, 0xf2, 0xb8, 0x88, 0x2c, 0x0b,
+    0xf6, 0xc3, 0xe4, 0x65, 0x0f, 0xaf, 0x7d, 0xcc, 0x0b, 0x91, 0x7e, 0xd8, 0x96, 0xd8, 0xe7, 0x83, 0x63, 0x9b, 0x6b, 0x4b,
+    0xbc, 0x06, 0x16, 0x20, 0xb5, 0x53, 0x90, 0x8a, 0xfc, 0x85, 0x10, 0xd7, 0x7a, 0x9d, 0x28, 0x7b, 0x6b, 0xb0, 0x96, 0x67,
+    0x58, 0x86, 0x21, 0x4f, 0x78, 0x35, 0x27, 0xbd, 0xe5, 0x2d, 0x21, 0x8f, 0x58, 0xd4, 0x9b, 0xef, 0x73, 0x4b, 0x6d, 0x18,
+    0x17, 0xb9, 0x68, 0xbb, 0x65, 0x6a, 0x40, 0x95, 0x08, 0x59, 0xc2, 0xa0, 0x3a, 0xad, 0x12, 0xa1, 0x06, 0x4c, 0xf7, 0x9d,
+    0x8c, 0x7c, 0x19, 0xcb, 0xd5, 0xc6, 0xbe, 0x95, 0x17, 0x8b, 0xe6, 0xac, 0x4a, 0x95, 0x73, 0x24, 0x42, 0x86, 0x26, 0x40,
+    0x1b, 0x4e, 0x7a, 0x7f, 0xa7, 0x7c, 0x26, 0x58, 0x55, 0x51, 0x30, 0x44, 0xae, 0x6e, 0x4c, 0xa8, 0xa4, 0x2f, 0x6a, 0x96,
+    0x7a, 0x47, 0x95, 0xc8, 0xae, 0xf0, 0x26, 0x68, 0xa5, 0xa2, 0xa7, 0xb6, 0x99, 0x57, 0xd1, 0x4a, 0x8f, 0xdd, 0xc1, 0xf2,
+    0xaf, 0x33, 0xf9, 0xb6, 0xbf, 0x84, 0x4b, 0xa9, 0x0f, 0x01, 0x2d, 0x13, 0x68, 0x45, 0x83, 0xed, 0x7f, 0x7e, 0x55, 0x25,
+    0x0e, 0xb2, 0x53, 0x3a, 0xd7, 0x24, 0x14, 0x30, 0x93, 0xe6, 0x47, 0x6f, 0x5f, 0x44, 0x2b, 0xf7, 0x70, 0xf5, 0x3a, 0x44,
+    0xd5, 0xe6, 0x33, 0x77, 0x32, 0xa7, 0xe7, 0x5c, 0xde, 0x6b, 0x7e, 0xff, 0x0b, 0xc5, 0x6c, 0xce, 0xad, 0x6a, 0xae, 0xdc,
+    0xc8, 0xce, 0xe5, 0x59, 0x40, 0x7d, 0x68, 0x4a, 0xcd, 0x0e, 0x1f, 0xf0, 0x2c, 0x1d, 0xa0, 0xad, 0xec, 0x53, 0xe1, 0x54,
+    0xdb, 0x97, 0xf7, 0x01, 0x04, 0xe4, 0xc6, 0xa3, 0x93, 0xb2, 0x7b, 0xf2, 0xa4, 0xac, 0x4d, 0x1b, 0x67, 0xb9, 0x31, 0x77,
+    0xf2, 0x1e, 0xe9, 0x36, 0x29, 0x00, 0x41, 0x3b, 0x86, 0xd3, 0x28, 0x81, 0x39, 0x9e, 0x67, 0x62, 0x5b, 0x1d, 0xb8, 0xe5,
+    0x6a, 0xf3, 0x30, 0x5e, 0xe6, 0x41, 0xa1, 0x9a, 0x6a, 0xbb, 0x2d, 0x1e, 0x99, 0x9a, 0xb3, 0x64, 0x99, 0x16, 0xc1, 0xc9,
+    0xc6, 0xb2, 0x1e, 0x92, 0x83, 0x6b, 0x1d, 0x63, 0x1c, 0x90, 0xbd, 0x2b, 0x01, 0xab, 0x27, 0x2a, 0xbc, 0x9d, 0x01, 0x65,
+    0x55, 0x8b, 0x3f, 0x42, 0x8b, 0xdb, 0xf9, 0x39, 0xb7, 0x51, 0x85, 0x85, 0x56, 0xb2, 0xf8, 0x76, 0x0e, 0xed, 0x14, 0x46,
+    0xd4, 0x2e, 0x3b, 0x57, 0xe1, 0x42, 0xac, 0x26, 0x5f, 0x51, 0x69, 0x49, 0x95, 0x15, 0x6f, 0x15, 0x70, 0x0e, 0x1e, 0xbd,
+    0xa2, 0xf0, 0xd5, 0x0a, 0x86, 0xb1, 0xef, 0x3a, 0x30, 0x52, 0x3f, 0xe5, 0x2c, 0x2e, 0x0d, 0x81, 0x32, 0x34, 0xb3, 0x5f,
+    0x47, 0x32, 0x11, 0xf1, 0xde, 0x94, 0xd2, 0x64, 0x1a, 0xe6, 0x20, 0xf9, 0xe6, 0x72, 0x86, 0xa9, 0xec, 0xc5, 0x44, 0x42,
+    0x35, 0x38, 0x0a, 0x38, 0x0e, 0x61, 0xb9, 0x97, 0xfd, 0x12, 0xe6, 0xa0, 0x59, 0xf1, 0xba, 0x05, 0xaf, 0xdf, 0xa2, 0x13,
+    0x6c, 0x50, 0xd1, 0x01, 0x0f, 0x48, 0x5d, 0x05, 0x70, 0x12, 0x5e, 0xad, 0xa2, 0x46, 0xe1, 0xbe, 0x04, 0x43, 0x10, 0x55,
+    0xf2, 0xa3, 0xbf, 0xd2, 0x27, 0xb6, 0x6f, 0x39, 0x28, 0x37, 0x3e, 0x03, 0xb6, 0x6f, 0xd4, 0x1a, 0xe5, 0x03, 0x9b, 0xaf,
+    0x75, 0x93, 0xfc, 0x94, 0x14, 0x99, 0xa6, 0x2f, 0xe3, 0x2f, 0xdd, 0x25, 0x6b, 0xcc, 0xf5, 0xa7, 0xb0, 0xe5, 0x7c, 0x83,
+    0x88, 0x9d, 0xf0, 0xda, 0x00, 0xad, 0xc3, 0x4b, 0xf9, 0x88, 0x6e, 0x8d, 0x7a, 0x35, 0x04, 0x53, 0x05, 0xb3, 0x63, 0x38,
+    0x06, 0x8f, 0xed, 0x23, 0x1b, 0xac, 0xf5, 0xcb, 0x18, 0xff, 0x4a, 0xd3, 0xc8, 0x96, 0x4e, 0x75, 0xd1, 0xd0, 0x6a, 0x9d,
+    0xcb, 0x8b, 0x2f, 0xa6, 0xa4, 0x91, 0x31, 0x20, 0xa1, 0xab, 0xb3, 0x86, 0x41, 0x3a, 0x93, 0x3d, 0xa8, 0xf5, 0xbf, 0x5e,
+    0xba, 0x04, 0x2b, 0xe4, 0x52, 0xdd, 0x53, 0x37, 0xb4, 0x5c, 0xe3, 0x59, 0x59, 0x79, 0x2f, 0x4a, 0x81, 0xa8, 0xc0, 0x08,
+    0x92, 0xa8, 0x7c, 0x15, 0x05, 0x90, 0x14, 0xaf, 0xe9, 0xf0, 0x4c, 0x0d, 0xc4, 0xa2, 0xa8, 0xe9, 0x64, 0x95, 0x0a, 0xd5,
+    0x69, 0x44, 0xcd, 0x3e, 0x5f, 0xb5, 0x72, 0x0a, 0xe5, 0xb1, 0xf7, 0x15, 0x18, 0xad, 0xc5, 0x87, 0x2a, 0x58, 0x6a, 0x77,
+    0x9d, 0xfd, 0x94, 0x94, 0xa7, 0xa7, 0x06, 0x36, 0xb3, 0x30, 0x51, 0x55, 0x86, 0xb2, 0xc9, 0x08, 0xdd, 0xe3, 0xfa, 0xa5,
+    0xbb, 0x1c, 0xcc, 0xe1, 0x70, 0x73, 0xe6, 0xfa, 0x74, 0xed, 0x2e, 0xb4, 0x73, 0x40, 0x5b, 0x9e, 0x64, 0x2d, 0xb6, 0x47,
+    0xd0, 0xa5, 0xc2, 0x8a, 0x1b, 0x2d, 0x38, 0x36, 0x5a, 0xbc, 0xc7, 0x82, 0x91, 0x8a, 0xcc, 0xdd, 0xc2, 0x6b, 0xd0, 0xb1,
+    0x6e, 0x21, 0x56, 0x18, 0x59, 0x8d, 0x29, 0x0a, 0x63, 0x1e, 0x4b, 0xc4, 0x32, 0x81, 0xff, 0xd2, 0xf9, 0x66, 0x0f, 0x77,
+    0x00, 0x28, 0x57, 0xc6, 0x10, 0xb4, 0x7a, 0x99, 0x56, 0xb8, 0x72, 0x57, 0x5e, 0x07, 0x71, 0x8f, 0x76, 0xb2, 0x80, 0xd4,
+    0xde, 0x33, 0x10, 0x99, 0x9b, 0x64, 0x09, 0xd2, 0x22, 0x7f, 0x5c, 0xfb, 0x71, 0x6e, 0x6f, 0xcc, 0xaa, 0x95, 0xe1, 0x53,
+    0x71, 0x06, 0xf8, 0x00, 0x3b, 0xc5, 0x71, 0x42, 0x77, 0xd4, 0xc2, 0x62, 0x1a, 0xdd, 0x42, 0xd6, 0xe8, 0xcd, 0xf3, 0x4e,
+    0x11, 0x1f, 0x67, 0xc9, 0xd9, 0x7c, 0x29, 0x48, 0xd5, 0xb7, 0x69, 0x44, 0xff, 0xbc, 0x2b, 0x41, 0xb9, 0x74, 0x5b, 0xeb,
+    0x38, 0xd2, 0x60, 0x0a, 0xe1, 0x79, 0xf9, 0x0a, 0x0a, 0xee, 0x92, 0x6a, 0x49, 0x97, 0x77, 0xe9, 0xad, 0xea, 0xe6, 0x29,
+    0x96, 0x6a, 0x66, 0xda, 0xef, 0xf9, 0x5a, 0x5d, 0xb6, 0x8a, 0x97, 0x7d, 0xbd, 0xac, 0x96, 0x75, 0xd1, 0x7c, 0xb9, 0x60,
+    0x6e, 0x12, 0x33, 0xe3, 0x00, 0x35, 0xa2, 0x56, 0x48, 0x51, 0x69, 0x1d, 0x09, 0xaf, 0xc8, 0x27, 0x29, 0x84, 0xc1, 0xb1,
+    0x17, 0xe8, 0x00, 0xf5, 0x4e, 0xfb, 0x63, 0x2d, 0xe6, 0x9b, 0x41, 0x8a, 0x26, 0x12, 0x54, 0xab, 0x93, 0x24, 0xce, 0xe7,
+    0x91, 0xe8, 0xbc, 0x08, 0x65, 0x98, 0xab, 0x94, 0x83, 0xc6, 0x87, 0x45, 0x54, 0xdf, 0x26, 0x8f, 0x47, 0xed, 0x75, 0x37,
+    0xff, 0xe6, 0x8a, 0x93, 0xdb, 0xd3, 0xe8, 0x53, 0x2b, 0xdc, 0xc2, 0x4a, 0xba, 0xfc, 0xb0, 0x8c, 0xf1, 0x50, 0x24, 0xe9,
+    0xc6, 0x53, 0x19, 0x8b, 0xb9, 0xad, 0xbd, 0xe8, 0x4d, 0x7e, 0xab, 0x09, 0xa7, 0xc1, 0xb3, 0x3a, 0x87, 0x49, 0x2b, 0x7c,
+    0x30, 0xe7, 0xb8, 0x53, 0xee, 0x89, 0xbd, 0x08, 0xd9, 0x13, 0xfe, 0xba, 0xa5, 0xef, 0xc4, 0xc0, 0x02, 0x20, 0x59, 0x66,
+    0x9d, 0x15, 0x47, 0x2c, 0xeb, 0x7b, 0xdd, 0x45, 0xab, 0x5d, 0xe8, 0xf8, 0x4c, 0x7e, 0x4f, 0x6a, 0x77, 0x43, 0x98, 0xfb,
+    0x2b, 0x60, 0xee, 0x3b, 0x30, 0x9b, 0x6c, 0x83, 0x5a, 0xfd, 0xa8, 0x9c, 0x7c, 0xa1, 0x4e, 0xc4, 0xaf, 0x8f, 0x03, 0x9e,
+    0xcb, 0x8e, 0x51, 0x3a, 0x08, 0x4b, 0xda, 0x97, 0x02, 0x0b, 0x70, 0xde, 0x3c, 0x18, 0x28, 0x31, 0xf8, 0xa6, 0x81, 0x19,
+    0x89, 0x99, 0x39, 0x77, 0xa0, 0xc7, 0x28, 0xbe, 0xd5, 0x81, 0x80, 0x92, 0xdd, 0x58, 0x11, 0x3e, 0x74, 0x6d, 0x85, 0xf0,
+    0xa7, 0x78, 0x15, 0xc3, 0x24, 0x00, 0xb7, 0xe1, 0x0e, 0x76, 0xc3, 0xfa, 0x6e, 0x59, 0xbb, 0x33, 0x94, 0x66, 0x4a, 0xdb,
+    0x46, 0x17, 0xad, 0x2e, 0x1b, 0xdb, 0x0d, 0xeb, 0x73, 0x3b, 0x5a, 0x63, 0x5a, 0x47, 0x5a, 0x9b, 0xdf, 0xc8, 0x21, 0xbf,
+    0x62, 0xe4, 0xf5, 0x0b, 0x37, 0x72, 0x44, 0x6b, 0x2e, 0xd0, 0x30, 0x1f, 0x14, 0x82, 0xa6, 0xfa, 0x02, 0x8d, 0x35, 0x7c,
+    0xaf, 0x8e, 0xbd, 0xe6, 0xf6, 0x29, 0x49, 0x99, 0xe7, 0xd7, 0x9c, 0xfd, 0xbf, 0xcf, 0x09, 0x61, 0x9b, 0x9c, 0x5b, 0x4c,
+    0x8e, 0x7f, 0x0c, 0xd3, 0xcb, 0x07, 0x3e, 0x29, 0x4b, 0x6d, 0xef, 0x1e, 0x3e, 0x37, 0xc7, 0x85, 0x5b, 0x31, 0xf9, 0xc2,
+    0x3e, 0xb6, 0xdc, 0x8a, 0xc7, 0x4d, 0x87, 0x8d, 0x59, 0xdc, 0xfa, 0xe4, 0x53, 0x9b, 0x9d, 0x15, 0x6c, 0xd1, 0xf6, 0xb4,
+    0x39, 0x76, 0xf5, 0x7f, 0xc8, 0x97, 0xfe, 0xe6, 0xec, 0x41, 0xfb, 0x1d, 0xed, 0xd9, 0x23, 0x73, 0x26, 0xa1, 0xfd, 0x0e,
+    0x4b, 0x4b, 0xfe, 0xd0, 0x5f, 0xd3, 0xe2, 0xaf, 0x66, 0xad, 0xcc, 0x89, 0xb0, 0x3f, 0xac, 0x55, 0x4a, 0x84, 0xe0, 0x97,
+    0x87, 0x6d, 0x2f, 0x45, 0xe1, 0x66, 0xdf, 0xd6, 0x02, 0xf3, 0xc7, 0xc8, 0x8c, 0x32, 0x57, 0x43, 0xbd, 0xab, 0x2a, 0x52,
+    0xf3, 0x17, 0x25, 0x97, 0x3d, 0x8f, 0xc9, 0x28, 0x77, 0x1f, 0x60, 0x3c, 0xb2, 0x13, 0x8b, 0x83, 0x0a, 0xd3, 0xed, 0xee,
+    0x19, 0x48, 0x24, 0x0b, 0x2c, 0x55, 0x3b, 0xeb, 0x6b, 0x72, 0x20, 0x24, 0x55, 0x37, 0x49, 0x7c, 0x30, 0x88, 0xb4, 0xda,
+    0xf3, 0x50, 0x44, 0x6e, 0xc8, 0x77, 0x65, 0x81, 0xdb, 0xe4, 0x46, 0x9d, 0x0d, 0x93, 0xb2, 0x80, 0xaf, 0x65, 0x96, 0x78,
+    0xbb, 0xcc, 0xac, 0xe6, 0x3b, 0x2d, 0xf6, 0xc7, 0x1a, 0x0d, 0x74, 0x32, 0x86, 0xab, 0x1b, 0x3a, 0x5f, 0x6d, 0x34, 0x2d,
+    0xf5, 0x1a, 0xaa, 0x49, 0xb7, 0xba, 0xb2, 0x69, 0xcf, 0xb3, 0xb3, 0x3e, 0x6d, 0xc3, 0xfe, 0x1e, 0x5f, 0xb1, 0xf5, 0xda,
+    0x8c, 0x0d, 0x57, 0x3d, 0xc8, 0x2b, 0x44, 0x25, 0xb1, 0xfa, 0xa2, 0x66, 0x7f, 0x87, 0x16, 0xc6, 0x72, 0xe3, 0x09, 0xf9,
+    0x58, 0x7e, 0x1d, 0x41, 0xde, 0x0c, 0x27, 0x29, 0xd6, 0x57, 0xa4, 0xab, 0x6a, 0x2c, 0x49, 0xc6, 0x27, 0xcc, 0x8e, 0xc5,
+    0x08, 0x16, 0x54, 0xe5, 0x72, 0x60, 0xcc, 0xb7, 0x1c, 0xde, 0x42, 0xb0, 0x16, 0x39, 0xfb, 0x36, 0x6d, 0xab, 0xc0, 0x9b,
+    0x33, 0x1d, 0xb0, 0x50, 0xfb, 0x73, 0xc0, 0xc7, 0xca, 0xde, 0x26, 0x12, 0x92, 0x4d, 0xd8, 0xbe, 0x43, 0x66, 0x37, 0xc7,
+    0x84, 0xdf, 0xe0, 0x08, 0x77, 0xf6, 0xed, 0x96, 0x1f, 0x79, 0x27, 0xdb, 0x7a, 0xa8, 0xc2, 0xc1, 0x6d, 0xdd, 0x50, 0xa0,
+    0x2f, 0x55, 0x42, 0x86, 0xc5, 0xe9, 0xb6, 0x58, 0xdf, 0x95, 0x9b, 0x37, 0xe7, 0xc9, 0x46, 0x8c, 0xc1, 0xa3, 0x68, 0x37,
+    0x61, 0xba, 0x4d, 0xa5, 0xc6, 0x01, 0xe5, 0xd2, 0xd8, 0x15, 0xfa, 0x80, 0xb5, 0x0d, 0xf5, 0xe4, 0x7d, 0xc2, 0x78, 0xc1,
+    0x6c, 0x4b, 0xaf, 0x88, 0xba, 0xfd, 0xff, 0xe4, 0x16, 0xed, 0x8e, 0xee, 0xe8, 0x17, 0x11, 0x45, 0x4a, 0x74, 0x6d, 0x65,
+    0xab, 0xd2, 0xba, 0xd9, 0x69, 0x65, 0xb6, 0xaa, 0x11, 0xa9, 0x37, 0x61, 0x77, 0xb8, 0xb5, 0xfa, 0x6e, 0x5a, 0xb8, 0xac,
+    0x68, 0xbe, 0x74, 0x1c, 0x55, 0x53, 0x46, 0x88, 0x4e, 0x0f, 0x14, 0xb1, 0xd8, 0xcc, 0xb1, 0x33, 0x7b, 0x07, 0x87, 0x72,
+    0x67, 0xa0, 0xca, 0x78, 0x6b, 0xce, 0xb1, 0x3f, 0x48, 0xa3, 0x95, 0x8c, 0xf5, 0x79, 0x8c, 0xe7, 0xfa, 0xe2, 0x80, 0x15,
+    0x89, 0x0a, 0x56, 0x7d, 0x6b, 0xa7, 0x54, 0x96, 0xac, 0xdd, 0xb6, 0xb6, 0xbf, 0x2e, 0xa2, 0xf5, 0x4d, 0x15, 0x0a, 0x0f,
+    0x1e, 0xb8, 0x40, 0x29, 0x73, 0xa1, 0xa2, 0x62, 0xe3, 0x5d, 0x1d, 0x07, 0xda, 0x50, 0x5e, 0x03, 0x4c, 0x04, 0x54, 0x17,
+    0x23, 0x80, 0x11, 0xa1, 0x0d, 0x5c, 0xb4, 0x22, 0xaa, 0xb6, 0xa7, 0x08, 0x4b, 0x97, 0x25, 0x80, 0x73, 0x12, 0x85, 0x57,
+    0x81, 0xfc, 0x08, 0x87, 0x7d, 0x97, 0x02, 0xbe, 0x92, 0x51, 0x24, 0xf7, 0xee, 0x92, 0x48, 0xdd, 0x73, 0x0e, 0xa5, 0x5f,
+    0x6e, 0xad, 0x7b, 0xc4, 0xcb, 0xf7, 0xa0, 0xab, 0x5d, 0x9b, 0xeb, 0x30, 0x9e, 0x24, 0xd7, 0x43, 0x1a, 0xd5, 0x69, 0xb2,
+    0x4c, 0xc7, 0x41, 0x31, 0x1d, 0x34, 0xa3, 0x52, 0xb9, 0xe9, 0x6b, 0xd5, 0x93, 0xea, 0x8d, 0xae, 0x6e, 0xe6, 0x64, 0x12,
+    0x2a, 0x1e, 0x26, 0x71, 0xb2, 0x08, 0xf0, 0xe6, 0x51, 0xb9, 0x6b, 0x59, 0x1a, 0x05, 0x5e, 0x7f, 0x7b, 0x28, 0x6e, 0xad,
+    0x06, 0xac, 0x1e, 0xea, 0x5b, 0xf0, 0xb8, 0xa1, 0x09, 0xdd, 0x4d, 0x68, 0x50, 0x00, 0x4c, 0xe5, 0xc8, 0x32, 0x71, 0x71,
+    0x23, 0xc2, 0x3c, 0x0b, 0xa2, 0xa9, 0x02, 0x5b, 0x9e, 0x2b, 0x0c, 0x5f, 0xa2, 0xb2, 0x0b, 0xb8, 0x17, 0x8b, 0x84, 0xb4,
+    0x56, 0xa0, 0x75, 0x41, 0x2f, 0x18, 0xa2, 0xa9, 0xed, 0x43, 0x6f, 0x66, 0x48, 0x65, 0x50, 0x68, 0xac, 0x02, 0x05, 0x8a,
+    0x3e, 0x89, 0x67, 0x68, 0x5b, 0x06, 0xd6, 0x77, 0xaf, 0xa1, 0x2a, 0xd4, 0x9f, 0x04, 0x11, 0xd4, 0x81, 0x09, 0x79, 0x77,
+    0xf1, 0x57, 0xda, 0x3a, 0xcc, 0xb2, 0xf0, 0x32, 0xee, 0xe9, 0xc9, 0xdc, 0x12, 0x5c, 0x83, 0x19, 0xd8, 0x43, 0x2b, 0x10,
+    0xc6, 0x42, 0xb7, 0x72, 0xc2, 0xfe, 0x34, 0x20, 0x0a, 0x98, 0xd3, 0x95, 0xbb, 0x5b, 0x22, 0x24, 0x92, 0xca, 0xd3, 0xd3,
+    0x80, 0xaf, 0xba, 0x83, 0xb8, 0x67, 0xe0, 0xc3, 0x04, 0x88, 0xe3, 0xe3, 0x63, 0xac, 0xfa, 0x40, 0xec, 0xf4, 0x29, 0xc6,
+    0xbf, 0x03, 0xc3, 0x67, 0xac, 0xa9, 0x4f, 0x5e, 0xbe, 0x5a, 0xdd, 0xe2, 0xe6, 0x34, 0xb0, 0x6f, 0xc1, 0x27, 0xd8, 0x32,
+    0x1c, 0xc8, 0xa7, 0xf1, 0x15, 0xce, 0xec, 0xc6, 0x56, 0xb5, 0x77, 0x1d, 0x5d, 0x1b, 0x40, 0x6e, 0x39, 0x72, 0xc5, 0x52,
+    0xe5, 0xc6, 0x29, 0xf8, 0xa0, 0xb8, 0x5c, 0xa2, 0x00, 0x7c, 0xd6, 0x89, 0x05, 0x2d, 0x6a, 0x77, 0x00, 0x45, 0xf2, 0x8a,
+    0x7f, 0xc2, 0xc4, 0x51, 0x7e, 0xe5, 0x7a, 0x92, 0x12, 0x17, 0x69, 0x58, 0xdb, 0x53, 0x39, 0xd9, 0xd9, 0x06, 0x03, 0xc5,
+    0x76, 0x77, 0x75, 0x79, 0xcd, 0xe5, 0x26, 0xb2, 0x67, 0xfc, 0xcc, 0x42, 0x25, 0x09, 0xf5, 0xf7, 0x17, 0x30, 0x2a, 0xf8,
+    0xbb, 0x78, 0x99, 0x06, 0x81, 0xc0, 0x32, 0xdc, 0xca, 0x30, 0xb0, 0xb0, 0xe4, 0x56, 0xfc, 0xfb, 0x8f, 0xe7, 0x2e, 0x2f,
+    0x96, 0x42, 0xc2, 0x5b, 0x1c, 0xf5, 0xd5, 0x0a, 0xc2, 0x91, 0x45, 0xee, 0x55, 0x66, 0x25, 0xd8, 0xb5, 0x0f, 0x0b, 0xbb,
+    0xef, 0x84, 0x59, 0x08, 0xaf, 0x51, 0xc9, 0x19, 0xcb, 0x17, 0xac, 0x72, 0x11, 0x43, 0x95, 0x21, 0x18, 0x80, 0x73, 0x17,
+    0x14, 0x7d, 0x3a, 0x7c, 0x2a, 0xf6, 0x22, 0x09, 0x1f, 0xda, 0xa9, 0xa0, 0xed, 0x3a, 0xa2, 0xb4, 0x6e, 0x6d, 0xcf, 0xe9,
+    0xa6, 0x79, 0x75, 0xf7, 0x29, 0x66, 0x77, 0x4b, 0x4c, 0x94, 0x0b, 0x5f, 0x9b, 0x28, 0x5a, 0xf8, 0xea, 0x92, 0x46, 0xc3,
+    0x9c, 0x94, 0x59, 0x65, 0xa7, 0x4c, 0x2d, 0x15, 0x39, 0x2e, 0x5c, 0xc1, 0x8c, 0xdf, 0xa2, 0x5b, 0x67, 0xe8, 0xe4, 0xd7,
+    0xc3, 0x6a, 0x20, 0x28, 0x13, 0xd3, 0xdc, 0x5c, 0x2a, 0x53, 0x2f, 0xaf, 0x71, 0x56, 0x18, 0x36, 0xbd, 0xc5, 0xd9, 0x97,
+    0x63, 0x27, 0xbd, 0x53, 0x91, 0xcd, 0x85, 0x43, 0x6a, 0x0e, 0x2b, 0x96, 0x9f, 0x54, 0x8b, 0xcd, 0x27, 0xd5, 0x5a, 0x5d,
+    0x4d, 0x75, 0xea, 0x5f, 0xa1, 0x9b, 0x48, 0xdf, 0x10, 0x73, 0x6f, 0x7e, 0xc0, 0x7b, 0xaf, 0x94, 0xd3, 0x47, 0x9f, 0x40,
+    0x69, 0xe8, 0xd5, 0x23, 0xb1, 0xbe, 0xc3, 0x5d, 0x55, 0x16, 0x07, 0x6d, 0x11, 0x1b, 0x6c, 0x99, 0xa9, 0xfc, 0x6e, 0x11,
+    0xf4, 0x56, 0x1c, 0x23, 0x93, 0x92, 0x4a, 0xd9, 0x4b, 0x15, 0x6e, 0xa1, 0xdc, 0x48, 0xbc, 0x53, 0x70, 0x15, 0x4f, 0x1d,
+    0x96, 0xa7, 0xb5, 0x5d, 0xc4, 0xab, 0xc4, 0x1c, 0xed, 0xa2, 0x5e, 0xd5, 0x28, 0x34, 0x0e, 0x81, 0x95, 0xbe, 0xa1, 0x56,
+    0x4a, 0xa8, 0x31, 0xdf, 0x4e, 0x73, 0xbb, 0xc0, 0xfc, 0x99, 0x40, 0xc9, 0x19, 0xa5, 0xa1, 0x65, 0xd7, 0x21, 0x0e, 0x18,
+    0xb0, 0x7a, 0xf6, 0x5e, 0xcc, 0x93, 0xc9, 0xe6, 0xb9, 0x34, 0xe5, 0xde, 0xda, 0xca, 0xc6, 0xff, 0xb1, 0x9c, 0x9a, 0x36,
+    0xca, 0x55, 0xf2, 0xf8, 0xb7, 0x93, 0x8b, 0xbd, 0xbb, 0xca, 0xc5, 0xb8, 0x86, 0x65, 0x36, 0x4b, 0xdf, 0xd9, 0x54, 0x34,
+    0xea, 0xb0, 0x68, 0x1b, 0x1e, 0xb6, 0x89, 0xf3, 0x1d, 0x0e, 0xeb, 0x62, 0x5c, 0x78, 0x93, 0x88, 0x30, 0x4e, 0xbb, 0xbd,
+    0x6c, 0xa1, 0x98, 0x9d, 0x5b, 0x08, 0xb3, 0x24, 0x17, 0x71, 0xa6, 0xc9, 0x1b, 0x90, 0x53, 0xa8, 0xed, 0x56, 0x7c, 0x4a,
+    0x19, 0x20, 0x44, 0x04, 0x7c, 0x4f, 0xeb, 0xc4, 0x67, 0xc4, 0xbc, 0xe2, 0x3d, 0x5e, 0x05, 0xca, 0xa5, 0x45, 0x07, 0x41,
+    0x75, 0x88, 0x16, 0x92, 0x38, 0xc2, 0x1c, 0x06, 0xa6, 0xcf, 0xf7, 0x58, 0xc7, 0x77, 0x5f, 0x4d, 0xf4, 0x07, 0x1e, 0x16,
+    0xaa, 0x69, 0xb8, 0x28, 0xc4, 0x5e, 0x55, 0xc6, 0xbb, 0xfc, 0x62, 0xaa, 0xba, 0x63, 0x47, 0x17, 0x60, 0x6d, 0xfe, 0x7e,
+    0xaa, 0x0f, 0x5d, 0x78, 0x74, 0xe1, 0x16, 0x7f, 0x45, 0x75, 0x9d, 0x78, 0xe8, 0x30, 0x62, 0xc1, 0xcd, 0x53, 0x04, 0x59,
+    0xdb, 0x1c, 0x46, 0x5c, 0x6a, 0x8c, 0x85, 0xeb, 0x1a, 0x86, 0x8b, 0x52, 0xb3, 0x70, 0xb1, 0xfe, 0x40, 0xb4, 0x1a, 0x72,
+    0xa9, 0xb1, 0x7a, 0x21, 0x3f, 0x86, 0xe0, 0x9e, 0x8f, 0x5e, 0x19, 0x6d, 0x29, 0xbb, 0x7d, 0x6a, 0x1e, 0xcc, 0x1b, 0xe5,
+    0x2f, 0xb9, 0xcc, 0xa1, 0xce, 0x22, 0xea, 0xa9, 0x2e, 0x15, 0xdc, 0xd3, 0x9f, 0xd8, 0x6a, 0xa9, 0xd7, 0x1c, 0x30, 0x2d,
+    0x74, 0x85, 0x8a, 0x32, 0x93, 0xb0, 0x97, 0x83, 0xcc, 0x1b, 0xf1, 0x82, 0x0e, 0xe3, 0x6e, 0xc0, 0x0a, 0x0d, 0xdb, 0x56,
+    0x70, 0xc3, 0xfa, 0x96, 0xeb, 0x58, 0x62, 0x55, 0xf8, 0xb9, 0xfc, 0x1d, 0xd0, 0xaf, 0xbd, 0x58, 0xb0, 0xbf, 0x5c, 0xba,
+    0x36, 0xba, 0xa8, 0x2e, 0x14, 0xec, 0x97, 0xbe, 0xdb, 0xf2, 0x15, 0x1d, 0xfe, 0x66, 0xce, 0xb9, 0x6c, 0xbe, 0xa1, 0xcf,
+    0xc1, 0xad, 0xbf, 0xb7, 0x47, 0xee, 0xd0, 0xfa, 0xfb, 0xf8, 0xe3, 0xa4, 0x73, 0x4f, 0x2a, 0x68, 0x45, 0xac, 0x35, 0xf1,
+    0xee, 0xee, 0x4e, 0x57, 0x4d, 0xc4, 0x26, 0x0e, 0xb5, 0x03, 0xa7, 0xbd, 0x4b, 0x5d, 0x85, 0x46, 0x0b, 0xc7, 0xc1, 0xf9,
+    0x4e, 0x6d, 0xc9, 0xa5, 0x56, 0x9f, 0xa7, 0xcd, 0xb5, 0x03, 0x2d, 0x93, 0xd1, 0xc9, 0x8d, 0x9e, 0x84, 0x99, 0x5c, 0x13,
+    0x52, 0x05, 0x19, 0xa3, 0x12, 0x19, 0xf4, 0x88, 0x4c, 0xd9, 0xd2, 0xa7, 0x96, 0x7d, 0x19, 0x92, 0xb4, 0xb8, 0x13, 0x99,
+    0x3e, 0xda, 0xbb, 0x2d, 0x47, 0xf3, 0xd5, 0xbc, 0xe9, 0x36, 0xa7, 0x90, 0x25, 0xab, 0x01, 0x69, 0x52, 0x3d, 0x0e, 0x39,
+    0x80, 0x36, 0xb7, 0xbc, 0x30, 0xb9, 0x79, 0xfc, 0x2d, 0xf7, 0x78, 0x0a, 0xd4, 0x6b, 0xb9, 0xb7, 0x63, 0x77, 0xdc, 0x98,
+    0x7d, 0xdc, 0x8f, 0x12, 0x97, 0xb8, 0x47, 0x7d, 0x8c, 0x98, 0x8f, 0x69, 0x12, 0xcb, 0x04, 0x29, 0xaa, 0xc2, 0x67, 0xaf,
+    0x5f, 0x57, 0xc4, 0x17, 0xd2, 0x12, 0xb3, 0x0d, 0x6b, 0x4e, 0x3e, 0x08, 0xfb, 0xec, 0xc4, 0xd3, 0x96, 0x7c, 0xf6, 0x3e,
+    0x48, 0xf1, 0x90, 0x14, 0x9d, 0xf5, 0xb2, 0x11, 0x6c, 0xcd, 0x6e, 0xb2, 0xf5, 0x80, 0x5a, 0xff, 0x13, 0x1f, 0x90, 0x77,
+    0xa7, 0x41, 0x7d, 0xfe, 0x7d, 0x28, 0x36, 0x67, 0xd9, 0x55, 0x59, 0x7e, 0x4c, 0x5d, 0x97, 0xb4, 0xed, 0x12, 0xfe, 0x6a,
+    0xe6, 0xa7, 0x5d, 0xee, 0x5f, 0x15, 0x1a, 0xf5, 0x7c, 0xfd, 0x64, 0x5b, 0x7d, 0x7b, 0xf7, 0xc9, 0x36, 0xda, 0x33, 0xfc,
+    0x3b, 0xcb, 0xe7, 0xd1, 0x71, 0xe7, 0x7f, 0x01, 0x98, 0xdd, 0x1f, 0x33, 0x44, 0xa5, 0x00, 0x00,
+};
 
-} // namespace BattleAura
\ No newline at end of file
+} // namespace BattleAura
@@ -1,11 +1,33 @@
 #include "WebServer.h"
 #include "WebInterface.h"
 #include <ArduinoJson.h>
+#include <LittleFS.h>
 
 namespace BattleAura {
 
-WebServer::WebServer(Configuration& config, LedController& ledController, VFXManager& vfxManager, AudioController& audioController) 
-    : config(config), ledController(ledController), vfxManager(vfxManager), audioController(audioController), server(80), 
+namespace {
+
+const uint32_t HEAP_SAMPLE_MS = 1000;       // Free heap churns; report it at most this often
+const size_t MAX_QUEUED_EVENTS = 4;         // Per client, before state updates are held back
+const size_t STATE_MESSAGE_SIZE = 128;
+
+const char* audioStatusName(AudioStatus status) {
+    switch (status) {
+        case AudioStatus::STOPPED: return "stopped";
+        case AudioStatus::PLAYING: return "playing";
+        case AudioStatus::PAUSED:  return "paused";
+        case AudioStatus::ERROR:   return "error";
+    }
+    return "unknown";
+}
+
+} // namespace
+
+WebServer::WebServer(Configuration& config, LedController& ledController, VFXManager& vfxManager, 
+                     AudioController& audioController, FrameScheduler& frameScheduler,
+                     TriggerServer& triggerServer, SyncGroup& syncGroup) 
+    : config(config), ledController(ledController), vfxManager(vfxManager), audioController(audioController), 
+      frameScheduler(frameScheduler), triggerServer(triggerServer), syncGroup(syncGroup), server(80), events("/api/events"), 
       wifiConnected(false), apMode(false) {
 }
 
@@ -46,6 +68,16 @@ bool WebServer::begin() {
 void WebServer::handle() {
     // Handle OTA updates
     ArduinoOTA.handle();
+    
+    // Push state changes to connected UIs
+    publishState();
+    
+    // Configuration changes are applied by the render task or under the
+    // config lock; this is the one place that saves them, so the render task
+    // never waits on flash and writes to /config.json never overlap
+    if (config.takeChanged()) {
+        config.save();
+    }
 }
 
 bool WebServer::connectToWiFi() {
@@ -147,6 +179,12 @@ void WebServer::setupRoutes() {
         handleRoot(request);
     });
     
+    // Live state stream (Server-Sent Events)
+    events.onConnect([this](AsyncEventSourceClient* client) {
+        handleEventsConnect(client);
+    });
+    server.addHandler(&events);
+    
     
     // API routes
     server.on("/api/zones", HTTP_GET, [this](AsyncWebServerRequest* request) {
@@ -251,6 +289,20 @@ void WebServer::setupRoutes() {
         handleOTAUploadFile(request, filename, index, data, len, final);
     });
     
+    // Loudness envelope from tools/audio_envelope.py, named NNNN.env
+    server.on("/api/audio/envelope", HTTP_POST, [this](AsyncWebServerRequest* request) {
+        handleEnvelopeUpload(request);
+    }, [this](AsyncWebServerRequest* request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
+        handleEnvelopeUploadFile(request, filename, index, data, len, final);
+    });
+    
+    // Effect program from tools/effect_compiler.py, named N.bfx for slot N
+    server.on("/api/effects/upload", HTTP_POST, [this](AsyncWebServerRequest* request) {
+        handleEffectUpload(request);
+    }, [this](AsyncWebServerRequest* request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
+        handleEffectUploadFile(request, filename, index, data, len, final);
+    });
+    
     // Handle CORS preflight
     server.on("/api/brightness", HTTP_OPTIONS, [this](AsyncWebServerRequest* request) {
         sendCORSHeaders(request);
@@ -380,6 +432,11 @@ void WebServer::setupmDNS() {
         MDNS.addServiceTxt("battleaura", "tcp", "version", deviceConfig.firmwareVersion.c_str());
         MDNS.addServiceTxt("battleaura", "tcp", "name", deviceConfig.deviceName.c_str());
         
+        // Sync group port; members find each other by multicast beacon, this
+        // is for tools looking for a group
+        MDNS.addService("battleaura-sync", "udp", SyncGroup::PORT);
+        MDNS.addServiceTxt("battleaura-sync", "udp", "id", String(syncGroup.getDeviceId(), HEX).c_str());
+        
         Serial.printf("WebServer: mDNS services registered for discovery\n");
     } else {
         Serial.println("WebServer: Failed to start mDNS responder - check WiFi connection");
@@ -387,13 +444,28 @@ void WebServer::setupmDNS() {
 }
 
 void WebServer::handleRoot(AsyncWebServerRequest* request) {
-    request->send(200, "text/html", MAIN_HTML);
+    // The page only changes with the firmware, so a browser holding the
+    // current ETag gets an empty 304 instead of the whole UI again
+    const AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
+    if (ifNoneMatch && ifNoneMatch->value().indexOf(MAIN_HTML_ETAG) >= 0) {
+        AsyncWebServerResponse* response = request->beginResponse(304);
+        response->addHeader("ETag", MAIN_HTML_ETAG);
+        request->send(response);
+        return;
+    }
+    
+    AsyncWebServerResponse* response = request->beginResponse(200, "text/html", MAIN_HTML_GZ, MAIN_HTML_GZ_SIZE);
+    response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("ETag", MAIN_HTML_ETAG);
+    response->addHeader("Cache-Control", "no-cache");    // Revalidate, don't re-download
+    request->send(response);
 }
 
 void WebServer::handleGetZones(AsyncWebServerRequest* request) {
     JsonDocument doc;
     JsonArray zonesArray = doc["zones"].to<JsonArray>();
     
+    auto lock = config.lock();
     auto zones = config.getAllZones();
     for (Zone* zone : zones) {
         if (!zone->enabled) continue;
@@ -407,6 +479,7 @@ void WebServer::handleGetZones(AsyncWebServerRequest* request) {
         zoneObj["brightness"] = zone->brightness;
         zoneObj["currentBrightness"] = ledController.getUserBrightness(zone->id);
     }
+    lock.unlock();
     
     String response;
     serializeJson(doc, response);
@@ -417,56 +490,41 @@ void WebServer::handleSetBrightness(AsyncWebServerRequest* request) {
     // This method is no longer used - body handler does the work
 }
 
-static String setBrightnessBody = "";
-
 void WebServer::handleSetBrightnessBody(AsyncWebServerRequest* request, uint8_t *data, size_t len, size_t index, size_t total) {
-    // Accumulate body data
-    if (index == 0) {
-        setBrightnessBody = "";
+    parseJSONBody(request, data, len, index, total, &WebServer::processSetBrightness);
+}
+
+void WebServer::processSetBrightness(AsyncWebServerRequest* request, JsonDocument& doc) {
+    if (!doc["zoneId"] || !doc["brightness"]) {
+        Serial.println("WebServer: Missing zoneId or brightness in request");
+        sendJSONResponse(request, 400, R"({"error":"Missing zoneId or brightness"})");
+        return;
     }
     
-    for (size_t i = 0; i < len; i++) {
-        setBrightnessBody += (char)data[i];
+    uint8_t zoneId = doc["zoneId"];
+    uint8_t brightness = doc["brightness"];
+    
+    Serial.printf("WebServer: Setting zone %d brightness to %d\n", zoneId, brightness);
+    
+    if (!ledController.isZoneConfigured(zoneId)) {
+        Serial.printf("WebServer: Zone %d not configured\n", zoneId);
+        sendJSONResponse(request, 404, R"({"error":"Zone not found"})");
+        return;
     }
     
-    // Process when complete
-    if (index + len == total) {
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, setBrightnessBody);
-        
-        if (error) {
-            Serial.printf("WebServer: Brightness JSON error: %s\n", error.c_str());
-            sendJSONResponse(request, 400, R"({"error":"Invalid JSON"})");
-            return;
-        }
-        
-        if (!doc["zoneId"] || !doc["brightness"]) {
-            Serial.println("WebServer: Missing zoneId or brightness in request");
-            sendJSONResponse(request, 400, R"({"error":"Missing zoneId or brightness"})");
-            return;
-        }
-        
-        uint8_t zoneId = doc["zoneId"];
-        uint8_t brightness = doc["brightness"];
-        
-        Serial.printf("WebServer: Setting zone %d brightness to %d\n", zoneId, brightness);
-        
-        if (!ledController.isZoneConfigured(zoneId)) {
-            Serial.printf("WebServer: Zone %d not configured\n", zoneId);
-            sendJSONResponse(request, 404, R"({"error":"Zone not found"})");
-            return;
-        }
-        
-        ledController.setUserBrightness(zoneId, brightness);
-        ledController.update();
-        
-        sendJSONResponse(request, 200, R"({"success":true})");
-        
-        Serial.printf("WebServer: Successfully set zone %d brightness to %d\n", zoneId, brightness);
+    // Applied by the render loop on the next frame
+    if (!vfxManager.requestBrightness(zoneId, brightness)) {
+        sendJSONResponse(request, 503, R"({"error":"VFX command queue full"})");
+        return;
     }
+    
+    sendJSONResponse(request, 200, R"({"success":true})");
+    
+    Serial.printf("WebServer: Queued zone %d brightness %d\n", zoneId, brightness);
 }
 
 void WebServer::handleGetStatus(AsyncWebServerRequest* request) {
+    auto lock = config.lock();
     const auto& deviceConfig = config.getDeviceConfig();
     
     JsonDocument doc;
@@ -482,11 +540,185 @@ void WebServer::handleGetStatus(AsyncWebServerRequest* request) {
     doc["freeHeap"] = ESP.getFreeHeap();
     doc["totalHeap"] = ESP.getHeapSize();
     
+    // Render loop timing
+    const FrameStats& frameStats = frameScheduler.getStats();
+    JsonObject frameObj = doc["frame"].to<JsonObject>();
+    frameObj["targetFps"] = frameScheduler.getTargetFps();
+    frameObj["load"] = frameScheduler.getLoadPercent();
+    frameObj["frames"] = frameStats.frameCount;
+    frameObj["overruns"] = frameStats.overrunCount;
+    frameObj["dropped"] = frameStats.droppedFrames;
+    frameObj["avgWorkUs"] = frameStats.avgWorkUs;
+    frameObj["maxWorkUs"] = frameStats.maxWorkUs;
+    frameObj["avgJitterUs"] = frameStats.avgJitterUs;
+    frameObj["maxJitterUs"] = frameStats.maxJitterUs;
+    frameObj["allocTracking"] = AllocCounter::isEnabled();
+    frameObj["lastRenderAllocs"] = frameStats.lastRenderAllocs;
+    frameObj["maxRenderAllocs"] = frameStats.maxRenderAllocs;
+    frameObj["allocatingFrames"] = frameStats.allocatingFrames;
+    
+    const LedStats& ledStats = ledController.getStats();
+    JsonObject ledObj = doc["led"].to<JsonObject>();
+    ledObj["showsPerformed"] = ledStats.showsPerformed;
+    ledObj["showsSkipped"] = ledStats.showsSkipped;
+    ledObj["lastShowUs"] = ledStats.lastShowUs;
+    ledObj["maxShowUs"] = ledStats.maxShowUs;
+    
+    const CommandStats& commandStats = vfxManager.getCommandStats();
+    JsonObject commandsObj = doc["commands"].to<JsonObject>();
+    commandsObj["applied"] = commandStats.applied;
+    commandsObj["overflows"] = vfxManager.getCommandOverflows();
+    commandsObj["pending"] = vfxManager.getPendingCommands();
+    commandsObj["lastLatencyUs"] = commandStats.lastLatencyUs;
+    commandsObj["avgLatencyUs"] = commandStats.avgLatencyUs;
+    commandsObj["maxLatencyUs"] = commandStats.maxLatencyUs;
+    
+    // UDP triggers, with receipt to render-loop apply times
+    const TriggerStats& triggerStats = triggerServer.getStats();
+    JsonObject udpObj = doc["udp"].to<JsonObject>();
+    udpObj["port"] = TriggerServer::PORT;
+    udpObj["received"] = triggerStats.received;
+    udpObj["applied"] = triggerStats.applied;
+    udpObj["duplicates"] = triggerStats.duplicates;
+    udpObj["rejected"] = triggerStats.rejected;
+    udpObj["malformed"] = triggerStats.malformed;
+    udpObj["acksSent"] = triggerStats.acksSent;
+    const LatencyHistogram& latency = vfxManager.getTriggerLatency();
+    JsonArray latencyArray = udpObj["latency"].to<JsonArray>();
+    for (uint8_t i = 0; i < LatencyHistogram::BUCKET_COUNT; i++) {
+        JsonObject bucketObj = latencyArray.add<JsonObject>();
+        bucketObj["belowUs"] = LatencyHistogram::bucketLimitUs(i);    // 0 = no limit
+        bucketObj["count"] = latency.buckets[i];
+    }
+    
+    // Sync group membership, clock and the measured cross-device skew
+    const SyncStats& syncStats = syncGroup.getStats();
+    JsonObject syncObj = doc["sync"].to<JsonObject>();
+    syncObj["deviceId"] = String(syncGroup.getDeviceId(), HEX);
+    syncObj["masterId"] = String(syncGroup.getMasterId(), HEX);
+    syncObj["members"] = syncGroup.getMemberCount();
+    syncObj["synced"] = syncGroup.isSynced();
+    syncObj["offsetUs"] = syncGroup.getOffsetUs();
+    syncObj["rttUs"] = syncStats.bestRttUs;
+    syncObj["received"] = syncStats.received;
+    syncObj["dropped"] = syncStats.dropped + syncGroup.getReceiveDropped();
+    syncObj["triggersSent"] = syncStats.triggersSent;
+    syncObj["triggersRun"] = syncStats.triggersRun;
+    JsonObject skewObj = syncObj["skew"].to<JsonObject>();
+    skewObj["samples"] = syncStats.skewSamples;
+    skewObj["lastUs"] = syncStats.lastSkewUs;
+    skewObj["avgUs"] = syncStats.avgSkewUs;
+    skewObj["maxUs"] = syncStats.maxSkewUs;
+    
+    JsonObject layersObj = doc["layers"].to<JsonObject>();
+    for (uint8_t i = 0; i < LAYER_COUNT; i++) {
+        const LayerConfig& layerConfig = vfxManager.getCompositor().getLayerConfig(i);
+        JsonObject layerObj = layersObj[layerName(i)].to<JsonObject>();
+        layerObj["blend"] = blendModeName(layerConfig.blend);
+        layerObj["opacity"] = layerConfig.opacity;
+    }
+    
+    JsonObject transitionObj = doc["transition"].to<JsonObject>();
+    transitionObj["ms"] = deviceConfig.transitionMs;
+    transitionObj["easing"] = easingName(deviceConfig.transitionEasing);
+    lock.unlock();
+    
     String response;
     serializeJson(doc, response);
     sendJSONResponse(request, 200, response);
 }
 
+void WebServer::publishState() {
+    if (events.count() == 0) return;
+    
+    // State only changes when a frame renders, so one update per frame
+    // covers everything that happened since the last
+    uint32_t frame = frameScheduler.getStats().frameCount;
+    if (frame == publishedFrame) return;
+    
+    // A slow client is still draining earlier updates. Hold back; the next
+    // delta carries everything that changed meanwhile.
+    if (events.avgPacketsWaiting() > MAX_QUEUED_EVENTS) return;
+    publishedFrame = frame;
+    
+    LiveState state = readLiveState();
+    if (millis() - lastHeapSample < HEAP_SAMPLE_MS) {
+        state.freeHeapKb = sentState.freeHeapKb;
+    } else {
+        lastHeapSample = millis();
+    }
+    
+    char message[STATE_MESSAGE_SIZE];
+    if (formatLiveState(message, sizeof(message), state, &sentState) == 0) return;
+    
+    events.send(message, "state");
+    sentState = state;
+}
+
+WebServer::LiveState WebServer::readLiveState() const {
+    LiveState state;
+    state.enabledTypes = vfxManager.getEnabledTypes();
+    state.track = audioController.getCurrentTrack();
+    state.audioStatus = audioController.getStatus();
+    state.volume = audioController.getVolume();
+    {
+        auto lock = config.lock();
+        state.brightness = config.getDeviceConfig().globalBrightness;
+    }
+    state.freeHeapKb = ESP.getFreeHeap() / 1024;
+    return state;
+}
+
+size_t WebServer::formatLiveState(char* buffer, size_t size, const LiveState& state, const LiveState* previous) {
+    // Short keys: this goes to every client on every change
+    size_t length = 0;
+    const char* separator = "{";
+    if (!previous || state.enabledTypes != previous->enabledTypes) {
+        length += snprintf(buffer + length, size - length, "%s\"on\":%lu", separator, (unsigned long)state.enabledTypes);
+        separator = ",";
+    }
+    if (!previous || state.track != previous->track) {
+        length += snprintf(buffer + length, size - length, "%s\"track\":%u", separator, state.track);
+        separator = ",";
+    }
+    if (!previous || state.audioStatus != previous->audioStatus) {
+        length += snprintf(buffer + length, size - length, "%s\"audio\":\"%s\"", separator, audioStatusName(state.audioStatus));
+        separator = ",";
+    }
+    if (!previous || state.volume != previous->volume) {
+        length += snprintf(buffer + length, size - length, "%s\"vol\":%u", separator, state.volume);
+        separator = ",";
+    }
+    if (!previous || state.brightness != previous->brightness) {
+        length += snprintf(buffer + length, size - length, "%s\"bri\":%u", separator, state.brightness);
+        separator = ",";
+    }
+    if (!previous || state.freeHeapKb != previous->freeHeapKb) {
+        length += snprintf(buffer + length, size - length, "%s\"heap\":%u", separator, state.freeHeapKb);
+    }
+    
+    if (length == 0) return 0;
+    length += snprintf(buffer + length, size - length, "}");
+    return length;
+}
+
+void WebServer::handleEventsConnect(AsyncEventSourceClient* client) {
+    // Names first, since "on" has a bit per name in this order, then the
+    // whole state; after that the client only gets deltas
+    JsonDocument doc;
+    JsonArray names = doc.to<JsonArray>();
+    for (const String& name : vfxManager.getVFXNames()) {
+        names.add(name);
+    }
+    String namesJson;
+    serializeJson(doc, namesJson);
+    client->send(namesJson.c_str(), "names");
+    
+    char message[STATE_MESSAGE_SIZE];
+    formatLiveState(message, sizeof(message), readLiveState(), nullptr);
+    client->send(message, "state");
+}
+
 void WebServer::sendCORSHeaders(AsyncWebServerRequest* request) {
     AsyncWebServerResponse* response = request->beginResponse(200);
     response->addHeader("Access-Control-Allow-Origin", "*");
@@ -540,98 +772,193 @@ void WebServer::handleOTAUploadFile(AsyncWebServerRequest* request, String filen
     }
 }
 
+void WebServer::handleEnvelopeUpload(AsyncWebServerRequest* request) {
+    FileUpload* upload = (FileUpload*)request->_tempObject;
+    if (!upload) {
+        sendJSONError(request, 400, "No envelope file received");
+        return;
+    }
+    if (upload->status) {
+        sendJSONError(request, upload->status, upload->error);
+        return;
+    }
+    
+    // Parsed here, so the render loop only has to swap it in between frames
+    AudioEnvelope envelope;
+    if (!EnvelopeStore::parse(upload->data(), upload->length, envelope)) {
+        Serial.printf("WebServer: Rejected envelope upload for track %d\n", upload->number);
+        sendJSONError(request, 400, "Not a valid envelope file");
+        return;
+    }
+    
+    // Queued before it is stored, so a full queue leaves nothing behind
+    // to load at the next boot
+    if (!vfxManager.requestEnvelope(upload->number, envelope)) {
+        sendJSONError(request, 503, "VFX command queue full");
+        return;
+    }
+    
+    LittleFS.mkdir(EnvelopeStore::DIRECTORY);
+    File file = LittleFS.open(EnvelopeStore::pathFor(upload->number), "w");
+    if (!file) {
+        sendJSONError(request, 500, "Failed to open envelope file");
+        return;
+    }
+    bool written = file.write(upload->data(), upload->length) == upload->length;
+    file.close();
+    if (!written) {
+        sendJSONError(request, 500, "Failed to write envelope file");
+        return;
+    }
+    
+    Serial.printf("WebServer: Stored envelope for track %d (%d samples)\n",
+                 upload->number, envelope.samples.size());
+    
+    sendJSONResponse(request, 200, R"({"success":true,"message":"Envelope saved"})");
+}
+
+void WebServer::handleEnvelopeUploadFile(AsyncWebServerRequest* request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
+    FileUpload* upload = collectUpload(request, filename, index, data, len,
+                                       EnvelopeStore::HEADER_SIZE + EnvelopeStore::MAX_SAMPLES, "Envelope file too large");
+    if (upload && upload->number == 0) {
+        rejectUpload(upload, 400, "File name must be the track number, e.g. 0003.env");
+    }
+}
+
+void WebServer::handleEffectUpload(AsyncWebServerRequest* request) {
+    FileUpload* upload = (FileUpload*)request->_tempObject;
+    if (!upload) {
+        sendJSONError(request, 400, "No effect program received");
+        return;
+    }
+    if (upload->status) {
+        sendJSONError(request, upload->status, upload->error);
+        return;
+    }
+    
+    // Checked here so a bad upload never replaces a working program, and
+    // parsed here so the render loop only has to swap it in
+    EffectProgram program;
+    String error;
+    if (!program.parse(upload->data(), upload->length, error)) {
+        Serial.printf("WebServer: Rejected effect upload for slot %d: %s\n", upload->number, error.c_str());
+        sendJSONError(request, 400, error);
+        return;
+    }
+    
+    // Queued before it is stored, like envelopes
+    if (!vfxManager.requestScript(upload->number, program)) {
+        sendJSONError(request, 503, "VFX command queue full");
+        return;
+    }
+    
+    LittleFS.mkdir(ScriptVFX::DIRECTORY);
+    File file = LittleFS.open(ScriptVFX::pathFor(upload->number), "w");
+    if (!file) {
+        sendJSONError(request, 500, "Failed to open file");
+        return;
+    }
+    bool written = file.write(upload->data(), upload->length) == upload->length;
+    file.close();
+    if (!written) {
+        sendJSONError(request, 500, "Failed to write file");
+        return;
+    }
+    
+    Serial.printf("WebServer: Stored effect '%s' in slot %d (%d instructions)\n",
+                 program.getLabel(), upload->number, program.size());
+    
+    JsonDocument responseDoc;
+    responseDoc["success"] = true;
+    responseDoc["vfxName"] = ScriptVFX::nameFor(upload->number);
+    responseDoc["message"] = "Effect saved";
+    
+    String response;
+    serializeJson(responseDoc, response);
+    sendJSONResponse(request, 200, response);
+}
+
+void WebServer::handleEffectUploadFile(AsyncWebServerRequest* request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
+    static_assert(ScriptVFX::SLOT_COUNT == 4, "The slot error below names the slot range");
+    FileUpload* upload = collectUpload(request, filename, index, data, len, EffectProgram::MAX_FILE_SIZE, "Program too large");
+    if (upload && (upload->number < 1 || upload->number > ScriptVFX::SLOT_COUNT)) {
+        rejectUpload(upload, 400, "Slot must be 1-4, e.g. 2.bfx");
+    }
+}
+
 // Zone management handlers
 void WebServer::handleAddZone(AsyncWebServerRequest* request) {
     // This method is no longer used - body handler does the work
 }
 
-static String addZoneBody = "";
-
 void WebServer::handleAddZoneBody(AsyncWebServerRequest* request, uint8_t *data, size_t len, size_t index, size_t total) {
-    // Accumulate body data
-    if (index == 0) {
-        addZoneBody = "";
+    parseJSONBody(request, data, len, index, total, &WebServer::processAddZone);
+}
+
+void WebServer::processAddZone(AsyncWebServerRequest* request, JsonDocument& doc) {
+    // Validate required fields
+    if (!doc["name"] || !doc["gpio"] || !doc["type"]) {
+        sendJSONResponse(request, 400, R"({"success":false,"error":"Missing required fields: name, gpio, type"})");
+        return;
     }
     
-    for (size_t i = 0; i < len; i++) {
-        addZoneBody += (char)data[i];
+    // Parse zone data
+    String name = doc["name"];
+    uint8_t gpio = doc["gpio"];
+    String typeStr = doc["type"];
+    uint8_t ledCount = doc["ledCount"] | 1;
+    String groupName = doc["groupName"] | "Default";
+    uint8_t brightness = doc["brightness"] | 255;
+    
+    // Validate GPIO
+    if (!config.isValidGPIO(gpio)) {
+        sendJSONResponse(request, 400, R"({"success":false,"error":"Invalid GPIO pin"})");
+        return;
     }
     
-    // Process when complete
-    if (index + len == total) {
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, addZoneBody);
-        
-        if (error) {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Invalid JSON"})");
-            return;
-        }
-        
-        // Validate required fields
-        if (!doc["name"] || !doc["gpio"] || !doc["type"]) {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Missing required fields: name, gpio, type"})");
-            return;
-        }
-        
-        // Parse zone data
-        String name = doc["name"];
-        uint8_t gpio = doc["gpio"];
-        String typeStr = doc["type"];
-        uint8_t ledCount = doc["ledCount"] | 1;
-        String groupName = doc["groupName"] | "Default";
-        uint8_t brightness = doc["brightness"] | 255;
-        
-        // Validate GPIO
-        if (!config.isValidGPIO(gpio)) {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Invalid GPIO pin"})");
-            return;
-        }
-        
-        if (config.isGPIOInUse(gpio)) {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"GPIO pin already in use"})");
-            return;
-        }
-        
-        // Parse zone type
-        ZoneType zoneType;
-        if (typeStr == "PWM") {
-            zoneType = ZoneType::PWM;
-            ledCount = 1; // PWM zones always have 1 LED
-        } else if (typeStr == "WS2812B") {
-            zoneType = ZoneType::WS2812B;
-            if (ledCount < 1 || ledCount > 100) {
-                sendJSONResponse(request, 400, R"({"success":false,"error":"LED count must be 1-100 for RGB zones"})");
-                return;
-            }
-        } else {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Invalid zone type. Use PWM or WS2812B"})");
+    auto lock = config.lock();
+    bool gpioInUse = config.isGPIOInUse(gpio);
+    uint8_t zoneId = config.getNextZoneId();
+    lock.unlock();
+    
+    if (gpioInUse) {
+        sendJSONResponse(request, 400, R"({"success":false,"error":"GPIO pin already in use"})");
+        return;
+    }
+    
+    // Parse zone type
+    ZoneType zoneType;
+    if (typeStr == "PWM") {
+        zoneType = ZoneType::PWM;
+        ledCount = 1; // PWM zones always have 1 LED
+    } else if (typeStr == "WS2812B") {
+        zoneType = ZoneType::WS2812B;
+        if (ledCount < 1 || ledCount > 100) {
+            sendJSONResponse(request, 400, R"({"success":false,"error":"LED count must be 1-100 for RGB zones"})");
             return;
         }
+    } else {
+        sendJSONResponse(request, 400, R"({"success":false,"error":"Invalid zone type. Use PWM or WS2812B"})");
+        return;
+    }
+    
+    // Create zone; the render task adds it to the configuration and the LED
+    // controller, and handle() saves it
+    Zone zone(zoneId, name, gpio, zoneType, ledCount, groupName, brightness);
+    
+    if (vfxManager.requestAddZone(zone)) {
+        Serial.printf("WebServer: Adding zone %d '%s' on GPIO %d\n", zoneId, name.c_str(), gpio);
         
-        // Create zone
-        uint8_t zoneId = config.getNextZoneId();
-        Zone zone(zoneId, name, gpio, zoneType, ledCount, groupName, brightness);
+        JsonDocument responseDoc;
+        responseDoc["success"] = true;
+        responseDoc["zoneId"] = zoneId;
+        responseDoc["message"] = "Zone added successfully";
         
-        if (config.addZone(zone)) {
-            // Add zone to LED controller
-            ledController.addZone(zone);
-            
-            // Save configuration
-            config.save();
-            
-            Serial.printf("WebServer: Added zone %d '%s' on GPIO %d\n", zoneId, name.c_str(), gpio);
-            
-            JsonDocument responseDoc;
-            responseDoc["success"] = true;
-            responseDoc["zoneId"] = zoneId;
-            responseDoc["message"] = "Zone added successfully";
-            
-            String response;
-            serializeJson(responseDoc, response);
-            sendJSONResponse(request, 201, response);
-        } else {
-            sendJSONResponse(request, 500, R"({"success":false,"error":"Failed to add zone"})");
-        }
+        String response;
+        serializeJson(responseDoc, response);
+        sendJSONResponse(request, 201, response);
+    } else {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
     }
 }
 
@@ -643,36 +970,41 @@ void WebServer::handleDeleteZone(AsyncWebServerRequest* request) {
     
     uint8_t zoneId = request->getParam("zoneId")->value().toInt();
     
-    if (config.removeZone(zoneId)) {
-        // Remove from LED controller
-        ledController.removeZone(zoneId);
-        
-        // Save configuration
-        config.save();
-        
-        Serial.printf("WebServer: Removed zone %d\n", zoneId);
-        sendJSONResponse(request, 200, R"({"success":true,"message":"Zone removed successfully"})");
-    } else {
+    auto lock = config.lock();
+    bool found = config.getZone(zoneId) != nullptr;
+    lock.unlock();
+    
+    if (!found) {
         sendJSONResponse(request, 404, R"({"success":false,"error":"Zone not found"})");
+        return;
+    }
+    
+    // Removed from the configuration and LED controller by the render task
+    if (!vfxManager.requestRemoveZone(zoneId)) {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
+        return;
     }
+    
+    Serial.printf("WebServer: Removing zone %d\n", zoneId);
+    sendJSONResponse(request, 200, R"({"success":true,"message":"Zone removed successfully"})");
 }
 
 void WebServer::handleClearZones(AsyncWebServerRequest* request) {
-    // Get all zones and remove them
-    auto zones = config.getAllZones();
-    for (Zone* zone : zones) {
-        ledController.removeZone(zone->id);
-        config.removeZone(zone->id);
-    }
+    // Removed by the render task, which walks these zones every frame
+    auto lock = config.lock();
+    size_t zoneCount = config.getAllZones().size();
+    lock.unlock();
     
-    // Save configuration
-    config.save();
+    if (!vfxManager.requestClearZones()) {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
+        return;
+    }
     
-    Serial.printf("WebServer: Cleared all zones (%d removed)\n", zones.size());
+    Serial.printf("WebServer: Clearing all zones (%d to remove)\n", zoneCount);
     
     JsonDocument responseDoc;
     responseDoc["success"] = true;
-    responseDoc["message"] = String("Cleared ") + String(zones.size()) + String(" zones");
+    responseDoc["message"] = String("Cleared ") + String(zoneCount) + String(" zones");
     
     String response;
     serializeJson(responseDoc, response);
@@ -685,8 +1017,10 @@ void WebServer::handleGetVFX(AsyncWebServerRequest* request) {
     JsonArray vfxArray = doc["vfx"].to<JsonArray>();
     
     auto vfxNames = vfxManager.getVFXNames();
-    for (const String& name : vfxNames) {
+    for (size_t i = 0; i < vfxNames.size(); i++) {
+        const String& name = vfxNames[i];
         JsonObject vfxObj = vfxArray.add<JsonObject>();
+        vfxObj["id"] = i;       // Scene ID for UDP triggers
         vfxObj["name"] = name;
         vfxObj["enabled"] = vfxManager.isVFXEnabled(name);
     }
@@ -700,49 +1034,60 @@ void WebServer::handleTriggerVFX(AsyncWebServerRequest* request) {
     // This method is no longer used - body handler does the work
 }
 
-static String triggerVFXBody = "";
-
 void WebServer::handleTriggerVFXBody(AsyncWebServerRequest* request, uint8_t *data, size_t len, size_t index, size_t total) {
-    // Accumulate body data
-    if (index == 0) {
-        triggerVFXBody = "";
+    parseJSONBody(request, data, len, index, total, &WebServer::processTriggerVFX);
+}
+
+void WebServer::processTriggerVFX(AsyncWebServerRequest* request, JsonDocument& doc) {
+    if (!doc["vfxName"]) {
+        sendJSONResponse(request, 400, R"({"success":false,"error":"Missing vfxName"})");
+        return;
     }
     
-    for (size_t i = 0; i < len; i++) {
-        triggerVFXBody += (char)data[i];
+    String vfxName = doc["vfxName"];
+    uint32_t duration = doc["duration"] | 0; // Default to continuous
+    String groupName = doc["group"] | "";    // Default to the scene's target groups
+    bool sync = doc["sync"] | false;         // On every device in the sync group
+    
+    if (!vfxManager.hasVFX(vfxName)) {
+        sendJSONResponse(request, 404, R"({"success":false,"error":"VFX not found"})");
+        return;
     }
     
-    // Process when complete
-    if (index + len == total) {
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, triggerVFXBody);
-        
-        if (error) {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Invalid JSON"})");
-            return;
-        }
-        
-        if (!doc["vfxName"]) {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Missing vfxName"})");
-            return;
+    if (sync) {
+        if (!groupName.isEmpty()) {
+            sendJSONResponse(request, 400, R"({"success":false,"error":"group can't be combined with sync"})");
+        } else if (syncGroup.requestTrigger(vfxName, duration)) {
+            Serial.printf("WebServer: Queued VFX '%s' for %dms on the sync group\n", vfxName.c_str(), duration);
+            sendJSONResponse(request, 200, R"({"success":true,"message":"Triggered on the sync group"})");
+        } else {
+            sendJSONResponse(request, 503, R"({"success":false,"error":"Sync trigger queue full"})");
         }
+        return;
+    }
+    
+    auto lock = config.lock();
+    bool groupEmpty = !groupName.isEmpty() && config.getZonesByGroup(groupName).empty();
+    lock.unlock();
+    
+    if (groupEmpty) {
+        sendJSONResponse(request, 404, R"({"success":false,"error":"Group not found or has no zones"})");
+        return;
+    }
+    
+    // Applied by the render loop at the start of the next frame
+    if (vfxManager.requestTrigger(vfxName, duration, groupName)) {
+        Serial.printf("WebServer: Queued VFX '%s' for %dms\n", vfxName.c_str(), duration);
         
-        String vfxName = doc["vfxName"];
-        uint32_t duration = doc["duration"] | 0; // Default to continuous
+        JsonDocument responseDoc;
+        responseDoc["success"] = true;
+        responseDoc["message"] = String("Triggered VFX: ") + vfxName;
         
-        if (vfxManager.triggerVFX(vfxName, duration)) {
-            Serial.printf("WebServer: Triggered VFX '%s' for %dms\n", vfxName.c_str(), duration);
-            
-            JsonDocument responseDoc;
-            responseDoc["success"] = true;
-            responseDoc["message"] = String("Triggered VFX: ") + vfxName;
-            
-            String response;
-            serializeJson(responseDoc, response);
-            sendJSONResponse(request, 200, response);
-        } else {
-            sendJSONResponse(request, 404, R"({"success":false,"error":"VFX not found"})");
-        }
+        String response;
+        serializeJson(responseDoc, response);
+        sendJSONResponse(request, 200, response);
+    } else {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
     }
 }
 
@@ -753,54 +1098,46 @@ void WebServer::handlePlayAudio(AsyncWebServerRequest* request) {
 }
 
 void WebServer::handlePlayAudioBody(AsyncWebServerRequest* request, uint8_t *data, size_t len, size_t index, size_t total) {
-    // Only process when we have the complete body
-    if (index + len == total) {
-        String body = String((char*)data, len);
-        JsonDocument doc;
-        
-        DeserializationError error = deserializeJson(doc, body);
-        if (error) {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Invalid JSON"})");
-            return;
-        }
-        
-        if (!doc["trackNumber"]) {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Missing trackNumber"})");
-            return;
-        }
-        
-        uint16_t trackNumber = doc["trackNumber"];
-        bool loop = doc["loop"] | false;
-        
-        if (audioController.isAvailable()) {
-            if (audioController.play(trackNumber, loop)) {
-                Serial.printf("WebServer: Playing audio track %d (loop: %s)\n", trackNumber, loop ? "yes" : "no");
-                
-                JsonDocument responseDoc;
-                responseDoc["success"] = true;
-                responseDoc["message"] = String("Playing track ") + trackNumber;
-                responseDoc["track"] = trackNumber;
-                responseDoc["loop"] = loop;
-                
-                String response;
-                serializeJson(responseDoc, response);
-                sendJSONResponse(request, 200, response);
-            } else {
-                sendJSONResponse(request, 400, R"({"success":false,"error":"Failed to play audio track"})");
-            }
+    parseJSONBody(request, data, len, index, total, &WebServer::processPlayAudio);
+}
+
+void WebServer::processPlayAudio(AsyncWebServerRequest* request, JsonDocument& doc) {
+    if (!doc["trackNumber"]) {
+        sendJSONResponse(request, 400, R"({"success":false,"error":"Missing trackNumber"})");
+        return;
+    }
+    
+    uint16_t trackNumber = doc["trackNumber"];
+    bool loop = doc["loop"] | false;
+    
+    if (audioController.isAvailable()) {
+        if (audioController.requestPlay(AudioSource::WEB, trackNumber, loop)) {
+            Serial.printf("WebServer: Playing audio track %d (loop: %s)\n", trackNumber, loop ? "yes" : "no");
+            
+            JsonDocument responseDoc;
+            responseDoc["success"] = true;
+            responseDoc["message"] = String("Playing track ") + trackNumber;
+            responseDoc["track"] = trackNumber;
+            responseDoc["loop"] = loop;
+            
+            String response;
+            serializeJson(responseDoc, response);
+            sendJSONResponse(request, 200, response);
         } else {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Audio hardware not available"})");
+            sendJSONResponse(request, 503, R"({"success":false,"error":"Audio command queue full"})");
         }
+    } else {
+        sendJSONResponse(request, 400, R"({"success":false,"error":"Audio hardware not available"})");
     }
 }
 
 void WebServer::handleStopAudio(AsyncWebServerRequest* request) {
     if (audioController.isAvailable()) {
-        if (audioController.stop()) {
+        if (audioController.requestStop(AudioSource::WEB)) {
             Serial.println("WebServer: Stopped audio playback");
             sendJSONResponse(request, 200, R"({"success":true,"message":"Audio stopped"})");
         } else {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Failed to stop audio"})");
+            sendJSONResponse(request, 503, R"({"success":false,"error":"Audio command queue full"})");
         }
     } else {
         sendJSONResponse(request, 400, R"({"success":false,"error":"Audio hardware not available"})");
@@ -826,23 +1163,27 @@ void WebServer::handleGetAudioStatus(AsyncWebServerRequest* request) {
     doc["volume"] = audioController.getVolume();
     
     // Status string for UI
-    switch (audioController.getStatus()) {
-        case AudioStatus::STOPPED:
-            doc["status"] = "stopped";
-            break;
-        case AudioStatus::PLAYING:
-            doc["status"] = "playing";
-            break;
-        case AudioStatus::PAUSED:
-            doc["status"] = "paused";
-            break;
-        case AudioStatus::ERROR:
-            doc["status"] = "error";
-            break;
-        default:
-            doc["status"] = "unknown";
-            break;
-    }
+    doc["status"] = audioStatusName(audioController.getStatus());
+    
+    // Arbitration between the ambient loop and one-shot cues
+    const ArbiterStats& arbiterStats = audioController.getArbiterStats();
+    doc["ambientTrack"] = audioController.getAmbientTrack();
+    doc["startLatencyMs"] = audioController.getStartLatency();
+    doc["envelopes"] = vfxManager.getEnvelopeCount();
+    JsonObject policyObj = doc["policy"].to<JsonObject>();
+    auto lock = config.lock();
+    const auto& deviceConfig = config.getDeviceConfig();
+    policyObj["active"] = audioPolicyName(deviceConfig.audioPolicies[(uint8_t)AudioPriority::ACTIVE]);
+    policyObj["global"] = audioPolicyName(deviceConfig.audioPolicies[(uint8_t)AudioPriority::GLOBAL]);
+    policyObj["retriggerMs"] = deviceConfig.audioRetriggerMs;
+    lock.unlock();
+    
+    JsonObject cuesObj = doc["cues"].to<JsonObject>();
+    cuesObj["played"] = arbiterStats.played;
+    cuesObj["queued"] = arbiterStats.queued;
+    cuesObj["dropped"] = arbiterStats.dropped;
+    cuesObj["throttled"] = arbiterStats.throttled;
+    cuesObj["resumed"] = arbiterStats.resumed;
     
     String response;
     serializeJson(doc, response);
@@ -852,12 +1193,12 @@ void WebServer::handleGetAudioStatus(AsyncWebServerRequest* request) {
 void WebServer::handleRetryAudio(AsyncWebServerRequest* request) {
     Serial.println("WebServer: Manual audio retry requested");
     
-    if (audioController.retryInitialization()) {
-        Serial.println("WebServer: Audio retry successful");
-        sendJSONResponse(request, 200, R"({"success":true,"message":"Audio hardware initialized successfully"})");
+    // Initialization takes over a second; the audio task runs it and
+    // /api/audio/status reports the outcome
+    if (audioController.requestRetry(AudioSource::WEB)) {
+        sendJSONResponse(request, 202, R"({"success":true,"message":"Audio hardware initialization started"})");
     } else {
-        Serial.println("WebServer: Audio retry failed");
-        sendJSONResponse(request, 400, R"({"success":false,"error":"Audio hardware initialization failed - check connections"})");
+        sendJSONResponse(request, 503, R"({"success":false,"error":"Audio command queue full"})");
     }
 }
 
@@ -873,16 +1214,13 @@ void WebServer::handleWiFiConfigBody(AsyncWebServerRequest* request, uint8_t *da
 void WebServer::handleClearWiFi(AsyncWebServerRequest* request) {
     Serial.println("WebServer: Clearing WiFi configuration");
     
-    // Clear WiFi configuration
+    // Clear WiFi configuration; handle() saves it
+    auto lock = config.lock();
     auto& deviceConfig = config.getDeviceConfig();
     deviceConfig.wifiSSID = "";
     deviceConfig.wifiPassword = "";
-    
-    // Save configuration
-    if (!config.save()) {
-        sendJSONResponse(request, 500, R"({"success":false,"error":"Failed to save configuration"})");
-        return;
-    }
+    config.markChanged();
+    lock.unlock();
     
     Serial.println("WebServer: WiFi configuration cleared");
     sendJSONResponse(request, 200, R"({"success":true,"message":"WiFi configuration cleared. Device will remain in AP mode until reboot."})");
@@ -908,21 +1246,91 @@ String WebServer::generateHostname(const String& deviceName) {
     return cleanHostname;
 }
 
+void WebServer::sendJSONError(AsyncWebServerRequest* request, int code, const String& error) {
+    JsonDocument errorDoc;
+    errorDoc["success"] = false;
+    errorDoc["error"] = error;
+    
+    String response;
+    serializeJson(errorDoc, response);
+    sendJSONResponse(request, code, response);
+}
+
+WebServer::FileUpload* WebServer::collectUpload(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t *data, size_t len,
+                                                size_t capacity, const char* tooLargeError) {
+    // Collected on _tempObject like a JSON body, so concurrent uploads each
+    // have their own. Returns nullptr once the upload is rejected, so the
+    // rest of the file is dropped rather than appended.
+    FileUpload* upload = (FileUpload*)request->_tempObject;
+    if (index == 0) {
+        if (upload) {
+            rejectUpload(upload, 400, "Only one file per upload");
+            return nullptr;
+        }
+        upload = (FileUpload*)malloc(sizeof(FileUpload) + capacity);
+        request->_tempObject = upload;
+        if (!upload) {
+            Serial.printf("WebServer: Out of memory for upload '%s'\n", filename.c_str());
+            return nullptr;
+        }
+        upload->number = (uint16_t)filename.toInt();
+        upload->status = 0;
+        upload->error = nullptr;
+        upload->capacity = capacity;
+        upload->length = 0;
+    }
+    
+    if (!upload || upload->status) return nullptr;
+    
+    if (upload->length + len > upload->capacity) {
+        rejectUpload(upload, 413, tooLargeError);
+        return nullptr;
+    }
+    memcpy(upload->data() + upload->length, data, len);
+    upload->length += len;
+    return upload;
+}
+
+void WebServer::rejectUpload(FileUpload* upload, uint16_t status, const char* error) {
+    // The first reason sticks
+    if (upload->status) return;
+    upload->status = status;
+    upload->error = error;
+}
+
 void WebServer::parseJSONBody(AsyncWebServerRequest* request, uint8_t *data, size_t len, size_t index, size_t total, void (WebServer::*handler)(AsyncWebServerRequest*, JsonDocument&)) {
-    // Only process when we have the complete body
-    if (index + len == total) {
-        String body = String((char*)data, len);
-        JsonDocument doc;
-        
-        DeserializationError error = deserializeJson(doc, body);
-        if (error) {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Invalid JSON"})");
+    // A body can arrive in several chunks, and requests can interleave, so
+    // each request collects its own in one buffer sized from the first chunk.
+    // It hangs off _tempObject, which the server frees with the request.
+    if (index == 0) {
+        if (total > MAX_JSON_BODY_SIZE) {
+            sendJSONResponse(request, 413, R"({"success":false,"error":"Request body too large"})");
             return;
         }
-        
-        // Call the specific handler with parsed JSON
-        (this->*handler)(request, doc);
+        request->_tempObject = malloc(total);
+        if (!request->_tempObject) {
+            sendJSONResponse(request, 503, R"({"success":false,"error":"Out of memory"})");
+            return;
+        }
+    }
+    
+    // Already answered above, or a chunk past the announced length
+    char* body = (char*)request->_tempObject;
+    if (!body || index + len > total) return;
+    
+    memcpy(body + index, data, len);
+    if (index + len < total) return;
+    
+    // Parse straight from the buffer; only the strings are copied, into the document
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, (const char*)body, total);
+    if (error) {
+        sendJSONResponse(request, 400, R"({"success":false,"error":"Invalid JSON"})");
+        return;
     }
+    
+    // Call the specific handler with parsed JSON
+    (this->*handler)(request, doc);
 }
 
 void WebServer::processWiFiConfig(AsyncWebServerRequest* request, JsonDocument& doc) {
@@ -945,19 +1353,27 @@ void WebServer::processWiFiConfig(AsyncWebServerRequest* request, JsonDocument&
         return;
     }
     
-    // Update configuration
+    if (deviceName.length() > 32) {
+        sendJSONResponse(request, 400, R"({"success":false,"error":"Device name must be 32 characters or less"})");
+        return;
+    }
+    
+    // Update configuration. The render task never reads these, so they are
+    // set here under the config lock; handle() saves them.
+    auto lock = config.lock();
     auto& deviceConfig = config.getDeviceConfig();
     deviceConfig.wifiSSID = ssid;
     deviceConfig.wifiPassword = password;
+    if (deviceName.length() > 0) {
+        deviceConfig.deviceName = deviceName;
+    }
+    String savedName = deviceConfig.deviceName;
+    String firmwareVersion = deviceConfig.firmwareVersion;
+    config.markChanged();
+    lock.unlock();
     
     // Update device name if provided
     if (deviceName.length() > 0) {
-        if (deviceName.length() > 32) {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Device name must be 32 characters or less"})");
-            return;
-        }
-        deviceConfig.deviceName = deviceName;
-        
         // Update hostname and mDNS with new device name (only works in Station mode)
         if (wifiConnected && !apMode) {
             String cleanHostname = generateHostname(deviceName);
@@ -972,12 +1388,12 @@ void WebServer::processWiFiConfig(AsyncWebServerRequest* request, JsonDocument&
                 // Re-register services with new hostname
                 MDNS.addService("http", "tcp", 80);
                 MDNS.addServiceTxt("http", "tcp", "device", "BattleAura");
-                MDNS.addServiceTxt("http", "tcp", "version", config.getDeviceConfig().firmwareVersion.c_str());
+                MDNS.addServiceTxt("http", "tcp", "version", firmwareVersion.c_str());
                 MDNS.addServiceTxt("http", "tcp", "model", "ESP32-S3");
                 MDNS.addServiceTxt("http", "tcp", "path", "/");
                 
                 MDNS.addService("battleaura", "tcp", 80);
-                MDNS.addServiceTxt("battleaura", "tcp", "version", config.getDeviceConfig().firmwareVersion.c_str());
+                MDNS.addServiceTxt("battleaura", "tcp", "version", firmwareVersion.c_str());
                 MDNS.addServiceTxt("battleaura", "tcp", "name", deviceName.c_str());
             } else {
                 Serial.println("WebServer: Failed to restart mDNS with new hostname");
@@ -987,14 +1403,8 @@ void WebServer::processWiFiConfig(AsyncWebServerRequest* request, JsonDocument&
         }
     }
     
-    // Save configuration
-    if (!config.save()) {
-        sendJSONResponse(request, 500, R"({"success":false,"error":"Failed to save configuration"})");
-        return;
-    }
-    
     Serial.printf("WebServer: Configuration updated - Device: %s, SSID: %s\n", 
-                 deviceConfig.deviceName.c_str(), ssid.c_str());
+                 savedName.c_str(), ssid.c_str());
     
     // Send success response first
     JsonDocument responseDoc;
@@ -1024,7 +1434,7 @@ void WebServer::processSetVolume(AsyncWebServerRequest* request, JsonDocument& d
     }
     
     if (audioController.isAvailable()) {
-        if (audioController.setVolume(volume)) {
+        if (audioController.requestVolume(AudioSource::WEB, volume)) {
             Serial.printf("WebServer: Set audio volume to %d\n", volume);
             
             JsonDocument responseDoc;
@@ -1036,7 +1446,7 @@ void WebServer::processSetVolume(AsyncWebServerRequest* request, JsonDocument& d
             serializeJson(responseDoc, response);
             sendJSONResponse(request, 200, response);
         } else {
-            sendJSONResponse(request, 400, R"({"success":false,"error":"Failed to set volume"})");
+            sendJSONResponse(request, 503, R"({"success":false,"error":"Audio command queue full"})");
         }
     } else {
         sendJSONResponse(request, 400, R"({"success":false,"error":"Audio hardware not available"})");
@@ -1047,6 +1457,7 @@ void WebServer::handleGetAudioTracks(AsyncWebServerRequest* request) {
     JsonDocument doc;
     JsonArray tracksArray = doc["tracks"].to<JsonArray>();
     
+    auto lock = config.lock();
     auto tracks = config.getAllAudioTracks();
     for (AudioTrack* track : tracks) {
         JsonObject trackObj = tracksArray.add<JsonObject>();
@@ -1055,6 +1466,7 @@ void WebServer::handleGetAudioTracks(AsyncWebServerRequest* request) {
         trackObj["isLoop"] = track->isLoop;
         trackObj["duration"] = track->duration;
     }
+    lock.unlock();
     
     String response;
     serializeJson(doc, response);
@@ -1065,8 +1477,6 @@ void WebServer::handleAddAudioTrack(AsyncWebServerRequest* request) {
     // This method is no longer used - body handler does the work
 }
 
-static String addAudioTrackBody = "";
-
 void WebServer::handleAddAudioTrackBody(AsyncWebServerRequest* request, uint8_t *data, size_t len, size_t index, size_t total) {
     parseJSONBody(request, data, len, index, total, &WebServer::processAddAudioTrack);
 }
@@ -1083,23 +1493,21 @@ void WebServer::processAddAudioTrack(AsyncWebServerRequest* request, JsonDocumen
     track.isLoop = doc["isLoop"] | false;
     track.duration = doc["duration"] | 0;
     
-    if (config.addAudioTrack(track)) {
-        if (config.save()) {
-            Serial.printf("WebServer: Added audio track %d: %s\n", track.fileNumber, track.description.c_str());
-            
-            JsonDocument responseDoc;
-            responseDoc["success"] = true;
-            responseDoc["message"] = "Audio track added successfully";
-            
-            String response;
-            serializeJson(responseDoc, response);
-            sendJSONResponse(request, 200, response);
-        } else {
-            sendJSONResponse(request, 500, R"({"success":false,"error":"Failed to save configuration"})");
-        }
-    } else {
-        sendJSONResponse(request, 400, R"({"success":false,"error":"Failed to add audio track"})");
+    // Scenes look their track up when triggered, so the render task adds it
+    if (!vfxManager.requestAddAudioTrack(track)) {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
+        return;
     }
+    
+    Serial.printf("WebServer: Adding audio track %d: %s\n", track.fileNumber, track.description.c_str());
+    
+    JsonDocument responseDoc;
+    responseDoc["success"] = true;
+    responseDoc["message"] = "Audio track added successfully";
+    
+    String response;
+    serializeJson(responseDoc, response);
+    sendJSONResponse(request, 200, response);
 }
 
 void WebServer::handleDeleteAudioTrack(AsyncWebServerRequest* request) {
@@ -1114,29 +1522,37 @@ void WebServer::handleDeleteAudioTrack(AsyncWebServerRequest* request) {
         return;
     }
     
-    if (config.removeAudioTrack(fileNumber)) {
-        if (config.save()) {
-            Serial.printf("WebServer: Removed audio track %d\n", fileNumber);
-            
-            JsonDocument responseDoc;
-            responseDoc["success"] = true;
-            responseDoc["message"] = "Audio track removed successfully";
-            
-            String response;
-            serializeJson(responseDoc, response);
-            sendJSONResponse(request, 200, response);
-        } else {
-            sendJSONResponse(request, 500, R"({"success":false,"error":"Failed to save configuration"})");
-        }
-    } else {
+    auto lock = config.lock();
+    bool found = config.getAudioTrack(fileNumber) != nullptr;
+    lock.unlock();
+    
+    if (!found) {
         sendJSONResponse(request, 404, R"({"success":false,"error":"Audio track not found"})");
+        return;
     }
+    
+    // Removed by the render task, like adding one
+    if (!vfxManager.requestRemoveAudioTrack(fileNumber)) {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
+        return;
+    }
+    
+    Serial.printf("WebServer: Removing audio track %d\n", fileNumber);
+    
+    JsonDocument responseDoc;
+    responseDoc["success"] = true;
+    responseDoc["message"] = "Audio track removed successfully";
+    
+    String response;
+    serializeJson(responseDoc, response);
+    sendJSONResponse(request, 200, response);
 }
 
 void WebServer::handleGetSceneConfigs(AsyncWebServerRequest* request) {
     JsonDocument doc;
     JsonArray configsArray = doc["configs"].to<JsonArray>();
     
+    auto lock = config.lock();
     auto sceneConfigs = config.getAllSceneConfigs();
     for (const SceneConfig* sceneConfig : sceneConfigs) {
         if (sceneConfig) {
@@ -1145,6 +1561,7 @@ void WebServer::handleGetSceneConfigs(AsyncWebServerRequest* request) {
             configObj["audioFile"] = sceneConfig->audioFile;
             configObj["duration"] = sceneConfig->duration;
             configObj["audioTimeout"] = sceneConfig->audioTimeout;
+            configObj["audioReactive"] = sceneConfig->audioReactive;
             configObj["enabled"] = sceneConfig->enabled;
             
             // Convert type enum to string
@@ -1166,8 +1583,27 @@ void WebServer::handleGetSceneConfigs(AsyncWebServerRequest* request) {
             for (const String& group : sceneConfig->targetGroups) {
                 groupsArray.add(group);
             }
+            
+            JsonArray timelineArray = configObj["timeline"].to<JsonArray>();
+            for (const TimelineCue& cue : sceneConfig->timeline) {
+                writeTimelineCue(cue, timelineArray.add<JsonObject>());
+            }
+            
+            // Stored parameters, and the values the effect runs with
+            configObj["parameters"] = sceneConfig->parameters;
+            if (vfxManager.hasVFX(sceneConfig->name)) {
+                vfxManager.writeParameterValues(sceneConfig->name, sceneConfig->parameters.as<JsonVariantConst>(),
+                                                configObj["values"].to<JsonObject>());
+            }
         }
     }
+    lock.unlock();
+    
+    // Tunables of every effect, for editing parameters
+    JsonObject schemasObj = doc["schemas"].to<JsonObject>();
+    for (const String& vfxName : vfxManager.getVFXNames()) {
+        vfxManager.getParamSchema(vfxName)->writeSpecs(schemasObj[vfxName].to<JsonArray>());
+    }
     
     String response;
     serializeJson(doc, response);
@@ -1185,6 +1621,7 @@ void WebServer::processAddSceneConfig(AsyncWebServerRequest* request, JsonDocume
     uint16_t audioFile = doc["audioFile"] | 0;
     uint32_t duration = doc["duration"] | 0;
     uint32_t audioTimeout = doc["audioTimeout"] | 0;
+    bool audioReactive = doc["audioReactive"] | false;
     bool enabled = doc["enabled"] | true;
     
     if (sceneName.isEmpty()) {
@@ -1197,6 +1634,7 @@ void WebServer::processAddSceneConfig(AsyncWebServerRequest* request, JsonDocume
     sceneConfig.audioFile = audioFile;
     sceneConfig.duration = duration;
     sceneConfig.audioTimeout = audioTimeout;
+    sceneConfig.audioReactive = audioReactive;
     sceneConfig.enabled = enabled;
     
     // Set scene type
@@ -1218,24 +1656,51 @@ void WebServer::processAddSceneConfig(AsyncWebServerRequest* request, JsonDocume
         }
     }
     
-    if (config.addSceneConfig(sceneConfig)) {
-        if (config.save()) {
-            Serial.printf("WebServer: Added scene config '%s' with %d groups\n", 
-                         sceneName.c_str(), sceneConfig.targetGroups.size());
-            
-            JsonDocument responseDoc;
-            responseDoc["success"] = true;
-            responseDoc["message"] = "Scene configuration saved successfully";
+    // Timeline cues
+    for (JsonVariant cueObj : doc["timeline"].as<JsonArray>()) {
+        TimelineCue cue;
+        if (!parseTimelineCue(cueObj, cue)) {
+            sendJSONResponse(request, 400, R"({"success":false,"error":"Invalid timeline cue"})");
+            return;
+        }
+        sceneConfig.timeline.push_back(cue);
+    }
+    sortTimeline(sceneConfig.timeline);
+    
+    // Effect parameters, checked against the effect's schema
+    JsonVariantConst parameters = doc["parameters"];
+    if (!parameters.isNull()) {
+        String error;
+        if (!vfxManager.validateParameters(sceneName, parameters, error)) {
+            JsonDocument errorDoc;
+            errorDoc["success"] = false;
+            errorDoc["error"] = error;
             
             String response;
-            serializeJson(responseDoc, response);
-            sendJSONResponse(request, 200, response);
-        } else {
-            sendJSONResponse(request, 500, R"({"success":false,"error":"Failed to save configuration"})");
+            serializeJson(errorDoc, response);
+            sendJSONResponse(request, 400, response);
+            return;
         }
-    } else {
-        sendJSONResponse(request, 500, R"({"success":false,"error":"Failed to add scene configuration"})");
+        sceneConfig.parameters.set(parameters);
     }
+    
+    // The render task reads scenes every frame, so it swaps this one in
+    // (and re-applies its parameters); handle() saves it afterwards
+    if (!vfxManager.requestSetScene(sceneConfig)) {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
+        return;
+    }
+    
+    Serial.printf("WebServer: Adding scene config '%s' with %d groups\n", 
+                 sceneName.c_str(), sceneConfig.targetGroups.size());
+    
+    JsonDocument responseDoc;
+    responseDoc["success"] = true;
+    responseDoc["message"] = "Scene configuration saved successfully";
+    
+    String response;
+    serializeJson(responseDoc, response);
+    sendJSONResponse(request, 200, response);
 }
 
 void WebServer::handleDeleteSceneConfigBody(AsyncWebServerRequest* request, uint8_t *data, size_t len, size_t index, size_t total) {
@@ -1250,23 +1715,30 @@ void WebServer::processDeleteSceneConfig(AsyncWebServerRequest* request, JsonDoc
         return;
     }
     
-    if (config.removeSceneConfig(sceneName)) {
-        if (config.save()) {
-            Serial.printf("WebServer: Removed scene config '%s'\n", sceneName.c_str());
-            
-            JsonDocument responseDoc;
-            responseDoc["success"] = true;
-            responseDoc["message"] = "Scene configuration removed successfully";
-            
-            String response;
-            serializeJson(responseDoc, response);
-            sendJSONResponse(request, 200, response);
-        } else {
-            sendJSONResponse(request, 500, R"({"success":false,"error":"Failed to save configuration"})");
-        }
-    } else {
+    auto lock = config.lock();
+    bool found = config.getSceneConfig(sceneName) != nullptr;
+    lock.unlock();
+    
+    if (!found) {
         sendJSONResponse(request, 404, R"({"success":false,"error":"Scene configuration not found"})");
+        return;
     }
+    
+    // Removed by the render task, like adding one
+    if (!vfxManager.requestRemoveScene(sceneName)) {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
+        return;
+    }
+    
+    Serial.printf("WebServer: Removing scene config '%s'\n", sceneName.c_str());
+    
+    JsonDocument responseDoc;
+    responseDoc["success"] = true;
+    responseDoc["message"] = "Scene configuration removed successfully";
+    
+    String response;
+    serializeJson(responseDoc, response);
+    sendJSONResponse(request, 200, response);
 }
 
 void WebServer::handleDeviceConfigBody(AsyncWebServerRequest* request, uint8_t *data, size_t len, size_t index, size_t total) {
@@ -1277,25 +1749,99 @@ void WebServer::processDeviceConfig(AsyncWebServerRequest* request, JsonDocument
     String deviceName = doc["deviceName"] | "";
     bool audioEnabled = doc["audioEnabled"] | true;
     
+    // Current settings, for whatever the request leaves out
+    auto lock = config.lock();
+    const DeviceConfig& current = config.getDeviceConfig();
+    LayerConfig layers[LAYER_COUNT];
+    memcpy(layers, current.layers, sizeof(layers));
+    uint16_t transitionMs = current.transitionMs;
+    Easing transitionEasing = current.transitionEasing;
+    AudioPolicy audioPolicies[AUDIO_PRIORITY_COUNT];
+    memcpy(audioPolicies, current.audioPolicies, sizeof(audioPolicies));
+    uint16_t audioRetriggerMs = current.audioRetriggerMs;
+    lock.unlock();
+    
+    // Layer blending, e.g. {"layers": {"global": {"blend": "max", "opacity": 200}}}
+    JsonObject layersObj = doc["layers"];
+    for (uint8_t i = 0; layersObj && i < LAYER_COUNT; i++) {
+        JsonObject layerObj = layersObj[layerName(i)];
+        if (!layerObj) continue;
+        
+        if (layerObj["blend"].is<const char*>() &&
+            !parseBlendMode(layerObj["blend"].as<const char*>(), layers[i].blend)) {
+            sendJSONResponse(request, 400, R"({"success":false,"error":"Unknown blend mode"})");
+            return;
+        }
+        if (layerObj["opacity"].is<uint8_t>()) {
+            layers[i].opacity = layerObj["opacity"];
+        }
+    }
+    
+    // Cross-fade when an effect ends, e.g. {"transitionMs": 300, "transitionEasing": "gamma"}
+    bool transitionChanged = doc["transitionMs"].is<uint16_t>() || doc["transitionEasing"].is<const char*>();
+    if (doc["transitionEasing"].is<const char*>() &&
+        !parseEasing(doc["transitionEasing"].as<const char*>(), transitionEasing)) {
+        sendJSONResponse(request, 400, R"({"success":false,"error":"Unknown easing"})");
+        return;
+    }
+    if (doc["transitionMs"].is<uint16_t>()) {
+        transitionMs = doc["transitionMs"];
+    }
+    
+    // Audio cue collisions, e.g. {"audioPolicy": {"active": "queue"}, "audioRetriggerMs": 200}
+    JsonObject policyObj = doc["audioPolicy"];
+    bool audioPolicyChanged = policyObj || doc["audioRetriggerMs"].is<uint16_t>();
+    for (uint8_t i = 1; policyObj && i < AUDIO_PRIORITY_COUNT; i++) {
+        JsonVariant policy = policyObj[audioPriorityName((AudioPriority)i)];
+        if (policy.is<const char*>() && !parseAudioPolicy(policy.as<const char*>(), audioPolicies[i])) {
+            sendJSONResponse(request, 400, R"({"success":false,"error":"Unknown audio policy"})");
+            return;
+        }
+    }
+    if (doc["audioRetriggerMs"].is<uint16_t>()) {
+        audioRetriggerMs = doc["audioRetriggerMs"];
+    }
+    
+    // Frame pacing, layers and the cross-fade are read by the render task and
+    // the cue policies by the audio task, so the render task applies them all;
+    // handle() saves them once it has
+    bool queued = true;
+    if (doc["frameRate"].is<uint8_t>()) {
+        queued = vfxManager.requestFrameRate(FrameScheduler::clampFps(doc["frameRate"]));
+    }
+    for (uint8_t i = 0; queued && layersObj && i < LAYER_COUNT; i++) {
+        if (layersObj[layerName(i)]) queued = vfxManager.requestLayerConfig(i, layers[i]);
+    }
+    if (queued && transitionChanged) {
+        queued = vfxManager.requestTransition(transitionMs, transitionEasing);
+    }
+    if (queued && audioPolicyChanged) {
+        queued = vfxManager.requestAudioPolicy(audioPolicies, audioRetriggerMs);
+    }
+    if (!queued) {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
+        return;
+    }
+    
+    // Only read at startup, so set here
+    lock.lock();
     if (!deviceName.isEmpty()) {
         config.getDeviceConfig().deviceName = deviceName;
     }
     config.getDeviceConfig().audioEnabled = audioEnabled;
+    config.markChanged();
+    lock.unlock();
     
-    if (config.save()) {
-        Serial.printf("WebServer: Updated device config - Name: %s, Audio: %s\n", 
-                     deviceName.c_str(), audioEnabled ? "enabled" : "disabled");
-        
-        JsonDocument responseDoc;
-        responseDoc["success"] = true;
-        responseDoc["message"] = "Device configuration saved successfully";
-        
-        String response;
-        serializeJson(responseDoc, response);
-        sendJSONResponse(request, 200, response);
-    } else {
-        sendJSONResponse(request, 500, R"({"success":false,"error":"Failed to save device configuration"})");
-    }
+    Serial.printf("WebServer: Updated device config - Name: %s, Audio: %s\n", 
+                 deviceName.c_str(), audioEnabled ? "enabled" : "disabled");
+    
+    JsonDocument responseDoc;
+    responseDoc["success"] = true;
+    responseDoc["message"] = "Device configuration saved successfully";
+    
+    String response;
+    serializeJson(responseDoc, response);
+    sendJSONResponse(request, 200, response);
 }
 
 void WebServer::handleSystemRestart(AsyncWebServerRequest* request) {
@@ -1315,30 +1861,36 @@ void WebServer::handleSystemRestart(AsyncWebServerRequest* request) {
 }
 
 void WebServer::handleFactoryReset(AsyncWebServerRequest* request) {
-    if (config.factoryReset()) {
-        Serial.println("WebServer: Factory reset completed");
-        
-        JsonDocument responseDoc;
-        responseDoc["success"] = true;
-        responseDoc["message"] = "Factory reset completed. Device is restarting...";
-        
-        String response;
-        serializeJson(responseDoc, response);
-        sendJSONResponse(request, 200, response);
-        
-        // Delay restart to allow response to be sent
-        delay(1000);
-        ESP.restart();
-    } else {
-        sendJSONResponse(request, 500, R"({"success":false,"error":"Failed to perform factory reset"})");
+    // The render task drops the zones and scenes it walks, then handle()
+    // saves the defaults well within the restart delay
+    if (!vfxManager.requestFactoryReset()) {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
+        return;
     }
+    
+    Serial.println("WebServer: Factory reset requested");
+    
+    JsonDocument responseDoc;
+    responseDoc["success"] = true;
+    responseDoc["message"] = "Factory reset completed. Device is restarting...";
+    
+    String response;
+    serializeJson(responseDoc, response);
+    sendJSONResponse(request, 200, response);
+    
+    // Delay restart to allow response to be sent
+    delay(1000);
+    ESP.restart();
 }
 
 void WebServer::handleStopAllVFX(AsyncWebServerRequest* request) {
     Serial.println("WebServer: Stopping all VFX");
     
     // Stop all VFX via the VFX manager
-    vfxManager.stopAllVFX();
+    if (!vfxManager.requestStopAll()) {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
+        return;
+    }
     
     JsonDocument responseDoc;
     responseDoc["success"] = true;
@@ -1350,8 +1902,10 @@ void WebServer::handleStopAllVFX(AsyncWebServerRequest* request) {
 }
 
 void WebServer::handleGetGlobalBrightness(AsyncWebServerRequest* request) {
+    auto lock = config.lock();
     JsonDocument responseDoc;
     responseDoc["brightness"] = config.getDeviceConfig().globalBrightness;
+    lock.unlock();
     
     String response;
     serializeJson(responseDoc, response);
@@ -1367,19 +1921,10 @@ void WebServer::processSetGlobalBrightness(AsyncWebServerRequest* request, JsonD
     
     Serial.printf("WebServer: Setting global brightness to %d\n", brightness);
     
-    // Store global brightness in configuration
-    auto& deviceConfig = config.getDeviceConfig();
-    deviceConfig.globalBrightness = brightness;
-    config.save();
-    
-    // Apply global brightness to all zones
-    auto zones = config.getAllZones();
-    for (Zone* zone : zones) {
-        if (zone) {
-            // Calculate proportional brightness based on zone's max brightness
-            uint8_t zoneBrightness = (brightness * zone->brightness) / 255;
-            ledController.setZoneBrightness(zone->id, zoneBrightness);
-        }
+    // Applied to all zones on the next frame and stored by the render task
+    if (!vfxManager.requestGlobalBrightness(brightness)) {
+        sendJSONResponse(request, 503, R"({"success":false,"error":"VFX command queue full"})");
+        return;
     }
     
     JsonDocument responseDoc;
@@ -10,12 +10,18 @@
 #include "../hardware/LedController.h"
 #include "../vfx/VFXManager.h"
 #include "../audio/AudioController.h"
+#include "../core/FrameScheduler.h"
+#include "../core/AllocCounter.h"
+#include "TriggerServer.h"
+#include "../sync/SyncGroup.h"
 
 namespace BattleAura {
 
 class WebServer {
 public:
-    WebServer(Configuration& config, LedController& ledController, VFXManager& vfxManager, AudioController& audioController);
+    WebServer(Configuration& config, LedController& ledController, VFXManager& vfxManager, 
+              AudioController& audioController, FrameScheduler& frameScheduler,
+              TriggerServer& triggerServer, SyncGroup& syncGroup);
     ~WebServer();
     
     // Initialization
@@ -36,11 +42,46 @@ private:
     LedController& ledController;
     VFXManager& vfxManager;
     AudioController& audioController;
+    FrameScheduler& frameScheduler;
+    TriggerServer& triggerServer;
+    SyncGroup& syncGroup;
     AsyncWebServer server;
+    AsyncEventSource events;
     bool wifiConnected;
     bool apMode;
     String currentIP;
     
+    // Largest JSON body accepted; each request buffers its own whole
+    static const size_t MAX_JSON_BODY_SIZE = 8192;
+    
+    // File upload, collected whole and checked once complete. Like a JSON
+    // body, each request keeps its own on _tempObject, which the server
+    // frees with the request, so it holds only plain data.
+    struct FileUpload {
+        uint16_t number;        // From the file name: track or slot number
+        uint16_t status;        // HTTP status once rejected, 0 while accepted
+        const char* error;      // Why it was rejected (a string literal)
+        size_t capacity;
+        size_t length;
+        uint8_t* data() { return (uint8_t*)(this + 1); }   // capacity bytes follow
+    };
+    
+    // Live state pushed to the UI over /api/events, so it needn't poll.
+    // handle() compares against what was last sent and sends only the
+    // fields that changed, at most once per rendered frame.
+    struct LiveState {
+        uint32_t enabledTypes;      // VFXManager::getEnabledTypes()
+        uint16_t track;
+        AudioStatus audioStatus;
+        uint8_t volume;
+        uint8_t brightness;
+        uint16_t freeHeapKb;
+    };
+    LiveState sentState = {};
+    uint32_t publishedFrame = 0;
+    uint32_t lastHeapSample = 0;
+    uint16_t freeHeapKb = 0;
+    
     // Setup methods
     void setupRoutes();
     void setupOTA();
@@ -84,14 +125,32 @@ private:
     void handleClearWiFi(AsyncWebServerRequest* request);
     void handleOTAUpload(AsyncWebServerRequest* request);
     void handleOTAUploadFile(AsyncWebServerRequest* request, String filename, size_t index, uint8_t *data, size_t len, bool final);
+    void handleEnvelopeUpload(AsyncWebServerRequest* request);
+    void handleEnvelopeUploadFile(AsyncWebServerRequest* request, String filename, size_t index, uint8_t *data, size_t len, bool final);
+    void handleEffectUpload(AsyncWebServerRequest* request);
+    void handleEffectUploadFile(AsyncWebServerRequest* request, String filename, size_t index, uint8_t *data, size_t len, bool final);
+    
+    // Live state
+    void publishState();
+    LiveState readLiveState() const;
+    static size_t formatLiveState(char* buffer, size_t size, const LiveState& state, const LiveState* previous);
+    void handleEventsConnect(AsyncEventSourceClient* client);
     
     // Utility
     void sendCORSHeaders(AsyncWebServerRequest* request);
     void sendJSONResponse(AsyncWebServerRequest* request, int code, const String& json);
     String generateHostname(const String& deviceName);
+    void sendJSONError(AsyncWebServerRequest* request, int code, const String& error);
     void parseJSONBody(AsyncWebServerRequest* request, uint8_t *data, size_t len, size_t index, size_t total, void (WebServer::*handler)(AsyncWebServerRequest*, JsonDocument&));
+    FileUpload* collectUpload(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t *data, size_t len,
+                              size_t capacity, const char* tooLargeError);
+    static void rejectUpload(FileUpload* upload, uint16_t status, const char* error);
     
     // JSON processing handlers
+    void processSetBrightness(AsyncWebServerRequest* request, JsonDocument& doc);
+    void processAddZone(AsyncWebServerRequest* request, JsonDocument& doc);
+    void processTriggerVFX(AsyncWebServerRequest* request, JsonDocument& doc);
+    void processPlayAudio(AsyncWebServerRequest* request, JsonDocument& doc);
     void processAddAudioTrack(AsyncWebServerRequest* request, JsonDocument& doc);
     void processAddSceneConfig(AsyncWebServerRequest* request, JsonDocument& doc);
     void processDeleteSceneConfig(AsyncWebServerRequest* request, JsonDocument& doc);
@@ -0,0 +1,68 @@
+// Host tests for SequenceWindow, the duplicate check behind TriggerServer.
+// Run with `pio test -e test`.
+
+#include <unity.h>
+#include "core/SequenceWindow.h"
+
+using namespace BattleAura;
+
+void setUp() {}
+void tearDown() {}
+
+// A resent datagram that was already applied is a duplicate
+static void test_retransmit_is_settled() {
+    SequenceWindow window;
+    TEST_ASSERT_FALSE(window.isSettled(10));
+    window.settle(10);
+    TEST_ASSERT_TRUE(window.isSettled(10));
+    TEST_ASSERT_FALSE(window.isSettled(11));
+}
+
+// BUSY(N) isn't settled, OK(N+1) is, and the resent N must still run
+static void test_busy_then_newer_then_resend() {
+    SequenceWindow window;
+    window.settle(9);
+    
+    // N = 10 came back BUSY, so it was never settled
+    window.settle(11);
+    TEST_ASSERT_FALSE(window.isSettled(10));
+    TEST_ASSERT_TRUE(window.isSettled(11));
+    
+    window.settle(10);
+    TEST_ASSERT_TRUE(window.isSettled(10));
+    TEST_ASSERT_TRUE(window.isSettled(9));
+}
+
+static void test_wraps_at_16_bits() {
+    SequenceWindow window;
+    window.settle(65534);
+    window.settle(1);
+    TEST_ASSERT_TRUE(window.isSettled(65534));
+    TEST_ASSERT_FALSE(window.isSettled(65535));
+    TEST_ASSERT_FALSE(window.isSettled(0));
+    TEST_ASSERT_TRUE(window.isSettled(1));
+}
+
+// Far behind the newest is a restarted sender, not a retransmit
+static void test_outside_window_is_new() {
+    SequenceWindow window;
+    window.settle(100);
+    window.settle(100 + SequenceWindow::WINDOW - 1);
+    TEST_ASSERT_TRUE(window.isSettled(100));
+    
+    window.settle(100 + SequenceWindow::WINDOW);
+    TEST_ASSERT_FALSE(window.isSettled(100));
+    
+    window.settle(5);
+    TEST_ASSERT_TRUE(window.isSettled(5));
+    TEST_ASSERT_FALSE(window.isSettled(100 + SequenceWindow::WINDOW));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_retransmit_is_settled);
+    RUN_TEST(test_busy_then_newer_then_resend);
+    RUN_TEST(test_wraps_at_16_bits);
+    RUN_TEST(test_outside_window_is_new);
+    return UNITY_END();
+}
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""Build loudness envelopes for the DFPlayer tracks.
+
+Decodes each mp3 with ffmpeg and writes one envelope file per track: the
+RMS level of every 1/rate seconds, in dB below the file's loudest window,
+mapped onto 0-255. The firmware loads them from LittleFS and scales
+audio-reactive scenes with them while the track plays.
+
+    tools/audio_envelope.py                        # audio_files/normalized -> data/envelopes
+    tools/audio_envelope.py --upload battleaura.local
+
+Files are numbered like the SD card (0003machine_gun.mp3 -> 0003.env).
+Writing into data/ is for `pio run -t uploadfs`, which replaces the whole
+filesystem including /config.json; --upload sends them to a running
+controller instead.
+
+Envelope format (little endian):
+    0  "BAE1"
+    4  uint8   sample rate, Hz
+    5  uint8   reserved (0)
+    6  uint16  sample count
+    8  uint8   samples[count]
+"""
+
+import argparse
+import array
+import math
+import os
+import re
+import subprocess
+import sys
+import urllib.error
+import urllib.request
+import uuid
+
+MAGIC = b"BAE1"
+DECODE_RATE = 8000          # Plenty for a loudness envelope
+MAX_SAMPLES = 3000          # Firmware limit: 60 s at 50 Hz
+
+
+def decode(path):
+    """Mono signed 16-bit PCM at DECODE_RATE."""
+    result = subprocess.run(
+        ["ffmpeg", "-v", "error", "-i", path, "-ac", "1", "-ar", str(DECODE_RATE), "-f", "s16le", "-"],
+        check=True, stdout=subprocess.PIPE)
+    pcm = array.array("h")
+    pcm.frombytes(result.stdout[:len(result.stdout) // 2 * 2])
+    if sys.byteorder == "big":
+        pcm.byteswap()
+    return pcm
+
+
+def envelope(pcm, rate, floor_db):
+    window = DECODE_RATE // rate
+    levels = []
+    for start in range(0, len(pcm), window):
+        chunk = pcm[start:start + window]
+        levels.append(math.sqrt(sum(s * s for s in chunk) / len(chunk)))
+
+    peak = max(levels, default=0)
+    if peak == 0:
+        return bytes(len(levels))
+
+    samples = bytearray()
+    for level in levels:
+        db = 20 * math.log10(level / peak) if level > 0 else -floor_db
+        samples.append(round(255 * max(0.0, 1 + db / floor_db)))
+    return bytes(samples)
+
+
+def encode(samples, rate):
+    return MAGIC + bytes([rate, 0]) + len(samples).to_bytes(2, "little") + samples
+
+
+def upload(host, name, data):
+    boundary = uuid.uuid4().hex
+    body = (f"--{boundary}\r\n"
+            f'Content-Disposition: form-data; name="envelope"; filename="{name}"\r\n'
+            f"Content-Type: application/octet-stream\r\n\r\n").encode() + data + f"\r\n--{boundary}--\r\n".encode()
+    request = urllib.request.Request(f"http://{host}/api/audio/envelope", data=body, method="POST",
+                                     headers={"Content-Type": f"multipart/form-data; boundary={boundary}"})
+    try:
+        with urllib.request.urlopen(request, timeout=10) as response:
+            return response.status == 200
+    except urllib.error.URLError as error:
+        print(f"{name}: {error}")
+        return False
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("inputs", nargs="*", default=["audio_files/normalized"],
+                        help="mp3 files or directories (default: audio_files/normalized)")
+    parser.add_argument("--out", default="data/envelopes", help="output directory (default: data/envelopes)")
+    parser.add_argument("--rate", type=int, default=50, help="envelope samples per second (default: 50)")
+    parser.add_argument("--floor-db", type=float, default=40.0,
+                        help="level below the peak that maps to 0 (default: 40)")
+    parser.add_argument("--upload", metavar="HOST", help="send envelopes to a running controller")
+    args = parser.parse_args()
+
+    if not 1 <= args.rate <= 255 or DECODE_RATE % args.rate:
+        parser.error(f"--rate must divide {DECODE_RATE} and fit in a byte")
+
+    paths = []
+    for item in args.inputs:
+        if os.path.isdir(item):
+            paths += sorted(os.path.join(item, f) for f in os.listdir(item) if f.lower().endswith(".mp3"))
+        else:
+            paths.append(item)
+
+    os.makedirs(args.out, exist_ok=True)
+    failed = False
+    for path in paths:
+        match = re.match(r"(\d{4})", os.path.basename(path))
+        if not match:
+            print(f"{path}: skipped, name must start with the 4-digit track number")
+            continue
+
+        samples = envelope(decode(path), args.rate, args.floor_db)
+        if len(samples) > MAX_SAMPLES:
+            print(f"{path}: truncated to {MAX_SAMPLES / args.rate:.0f} s")
+            samples = samples[:MAX_SAMPLES]
+
+        name = f"{match.group(1)}.env"
+        data = encode(samples, args.rate)
+        with open(os.path.join(args.out, name), "wb") as file:
+            file.write(data)
+
+        status = ""
+        if args.upload:
+            ok = upload(args.upload, name, data)
+            failed |= not ok
+            status = ", uploaded" if ok else ", upload FAILED"
+        print(f"{path} -> {name}: {len(samples) / args.rate:.2f} s, {len(data)} bytes{status}")
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""Pack the web UI into the firmware as gzipped PROGMEM bytes.
+
+Minifies src/web/index.html, gzips it and writes src/web/WebInterface.h with
+the bytes, their length and a strong ETag (a hash of the gzipped bytes).
+WebServer serves them with Content-Encoding: gzip and answers a matching
+If-None-Match with 304, so a reload costs one small request.
+
+    tools/build_web.py              # regenerate src/web/WebInterface.h
+    tools/build_web.py --check      # exit 1 if it is out of date
+
+PlatformIO runs this before every firmware build (extra_scripts in
+platformio.ini). The header is only rewritten when its contents change, so
+an unchanged UI does not trigger a rebuild. Edit index.html, never the header.
+
+Minification is deliberately conservative: it drops indentation, blank
+lines, HTML comments and whole-line // comments, and leaves everything else
+alone. The UI has no <pre> blocks or whitespace-sensitive text, so this is
+safe; gzip does the rest.
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+SOURCE = os.path.join("src", "web", "index.html")
+OUTPUT = os.path.join("src", "web", "WebInterface.h")
+BYTES_PER_LINE = 20
+
+
+def minify(html):
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    lines = []
+    for line in html.splitlines():
+        line = line.strip()
+        if line and not line.startswith("//"):
+            lines.append(line)
+    return "\n".join(lines) + "\n"
+
+
+def compress(data):
+    # mtime=0 keeps the output, and so the ETag, identical across builds
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def render(packed, source_size, minified_size):
+    digest = hashlib.sha256(packed).hexdigest()[:16]
+    rows = []
+    for start in range(0, len(packed), BYTES_PER_LINE):
+        chunk = packed[start:start + BYTES_PER_LINE]
+        rows.append("    " + ", ".join(f"0x{b:02x}" for b in chunk) + ",")
+
+    return "\n".join([
+        "#pragma once",
+        "",
+        "// Generated by tools/build_web.py from index.html - do not edit.",
+        f"// {source_size} bytes, {minified_size} minified, {len(packed)} gzipped",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "namespace BattleAura {",
+        "",
+        f'const char MAIN_HTML_ETAG[] = "\\"{digest}\\"";    // Quoted, as sent',
+        f"const size_t MAIN_HTML_GZ_SIZE = {len(packed)};",
+        "const uint8_t MAIN_HTML_GZ[] PROGMEM = {",
+        *rows,
+        "};",
+        "",
+        "} // namespace BattleAura",
+        "",
+    ])
+
+
+def build(root):
+    with open(os.path.join(root, SOURCE), encoding="utf-8") as f:
+        source = f.read()
+    minified = minify(source).encode("utf-8")
+    packed = compress(minified)
+    return render(packed, len(source.encode("utf-8")), len(minified)), len(packed)
+
+
+def generate(root, check=False):
+    header, packed_size = build(root)
+    path = os.path.join(root, OUTPUT)
+    try:
+        with open(path, encoding="utf-8") as f:
+            current = f.read()
+    except FileNotFoundError:
+        current = None
+
+    if current == header:
+        return True
+    if check:
+        print(f"{OUTPUT} is out of date; run tools/build_web.py", file=sys.stderr)
+        return False
+
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(header)
+    print(f"{SOURCE} -> {OUTPUT}: {packed_size} bytes gzipped")
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--check", action="store_true", help="only report whether the header is current")
+    args = parser.parse_args()
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    return 0 if generate(root, args.check) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
+else:
+    # Loaded by PlatformIO as a pre: extra script
+    Import("env")  # noqa: F821
+    generate(env.subst("$PROJECT_DIR"))  # noqa: F821
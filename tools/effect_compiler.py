@@ -0,0 +1,386 @@
+#!/usr/bin/env python3
+"""Compile a text effect into bytecode for the ScriptVFX slots.
+
+An effect is a list of assignments run once per pixel, every frame:
+
+    label Police lights
+    # Alternate red and blue halves, swapping four times a second
+    left = i * 2 < n
+    flip = (t / 250) % 2
+    blue = left != flip
+    r = if(blue, 0, 255)
+    b = if(blue, 255, 0)
+    v = 255 - p
+
+Inputs (read only):
+    t   ms since the effect was triggered
+    i   pixel index in the zone, n pixels in the zone (1 for PWM zones)
+    z   zone index among the effect's targets
+    d   trigger duration in ms (0 = continuous), p progress through it 0-255
+Outputs:
+    r g b   colour, 0-255 (default 0)
+    v       brightness, 0-255 (default 255); PWM zones use only v
+Any other name is a local variable and must be assigned before it is read.
+
+Integers only. Operators: + - * / % < <= > >= == != & | unary - and !.
+Builtins: sin(x) tri(x) (one turn per 256, result 0-255), noise(x) (x in
+8.8 fixed point, result 0-255), rand(n) (0 to n-1), ease(x) clamp(x)
+(0-255), min(a, b) max(a, b) if(cond, a, b).
+
+    tools/effect_compiler.py police.fx --slot 1                # -> data/effects/1.bfx
+    tools/effect_compiler.py police.fx --slot 1 --upload battleaura.local
+
+The effect then runs as the VFX named Script1 (Script2.. for other slots).
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import urllib.error
+import urllib.request
+import uuid
+
+MAGIC = b"BFX1"
+LABEL_SIZE = 16
+REGISTER_COUNT = 32
+MAX_INSTRUCTIONS = 256
+MAX_CONSTANTS = 64
+SLOT_COUNT = 4
+
+# Must match EffectOp in src/vfx/EffectVM.h
+OPS = ["LOADK", "MOV", "ADD", "SUB", "MUL", "DIV", "MOD", "MIN", "MAX", "LT", "LE", "EQ", "NE",
+       "AND", "OR", "NEG", "NOT", "SEL", "SIN", "TRI", "NOISE", "RAND", "EASE", "CLAMP"]
+OP = {name: code for code, name in enumerate(OPS)}
+
+# Must match EffectProgram::Register
+INPUTS = {"t": 0, "i": 1, "n": 2, "z": 3, "d": 4, "p": 5}
+OUTPUTS = {"r": 6, "g": 7, "b": 8, "v": 9}
+FIRST_LOCAL = 10
+
+BINARY = {"+": "ADD", "-": "SUB", "*": "MUL", "/": "DIV", "%": "MOD", "<": "LT", "<=": "LE",
+          "==": "EQ", "!=": "NE", "&": "AND", "|": "OR"}
+UNARY_BUILTINS = {"sin": "SIN", "tri": "TRI", "noise": "NOISE", "rand": "RAND", "ease": "EASE",
+                  "clamp": "CLAMP"}
+# Levels of binary operators, loosest first
+PRECEDENCE = [["&", "|"], ["<", "<=", ">", ">=", "==", "!="], ["+", "-"], ["*", "/", "%"]]
+
+TOKEN = re.compile(r"\s*(?:(0x[0-9a-fA-F]+|\d+)|([A-Za-z_]\w*)|(<=|>=|==|!=|[-+*/%<>&|!(),=]))")
+
+
+class CompileError(Exception):
+    pass
+
+
+def wrap32(value):
+    value &= 0xFFFFFFFF
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def fold(op, a, b):
+    """Constant folding with the VM's int32 semantics."""
+    if op in ("DIV", "MOD"):
+        if b == 0:
+            return 0
+        # C division truncates toward zero
+        q = abs(a) // abs(b)
+        q = q if (a < 0) == (b < 0) else -q
+        return wrap32(q) if op == "DIV" else wrap32(a - b * q)
+    return wrap32({"ADD": a + b, "SUB": a - b, "MUL": a * b, "LT": int(a < b), "LE": int(a <= b),
+                   "EQ": int(a == b), "NE": int(a != b), "AND": a & b, "OR": a | b,
+                   "MIN": min(a, b), "MAX": max(a, b)}[op])
+
+
+def tokenize(text, line):
+    tokens, pos = [], 0
+    text = text.rstrip()
+    while pos < len(text):
+        match = TOKEN.match(text, pos)
+        if not match:
+            raise CompileError(f"line {line}: unexpected '{text[pos:].strip()[:10]}'")
+        number, name, symbol = match.groups()
+        if number is not None:
+            tokens.append(("num", int(number, 0)))
+        elif name is not None:
+            tokens.append(("name", name))
+        else:
+            tokens.append(("sym", symbol))
+        pos = match.end()
+    return tokens
+
+
+class Parser:
+    """Expressions into tuples: ("num", v), ("var", name), (op, a, b), ("call", name, args)."""
+
+    def __init__(self, tokens, line):
+        self.tokens, self.pos, self.line = tokens, 0, line
+
+    def peek(self):
+        return self.tokens[self.pos] if self.pos < len(self.tokens) else (None, None)
+
+    def take(self, symbol=None):
+        token = self.peek()
+        if token[0] is None or (symbol and token != ("sym", symbol)):
+            raise CompileError(f"line {self.line}: expected '{symbol or 'more'}'")
+        self.pos += 1
+        return token
+
+    def expression(self, level=0):
+        if level == len(PRECEDENCE):
+            return self.unary()
+        node = self.expression(level + 1)
+        while self.peek()[0] == "sym" and self.peek()[1] in PRECEDENCE[level]:
+            symbol = self.take()[1]
+            right = self.expression(level + 1)
+            # a > b is b < a
+            if symbol in (">", ">="):
+                node = (BINARY["<" if symbol == ">" else "<="], right, node)
+            else:
+                node = (BINARY[symbol], node, right)
+        return node
+
+    def unary(self):
+        if self.peek() == ("sym", "-"):
+            self.take()
+            return ("NEG", self.unary(), None)
+        if self.peek() == ("sym", "!"):
+            self.take()
+            return ("NOT", self.unary(), None)
+        return self.primary()
+
+    def primary(self):
+        kind, value = self.take()
+        if kind == "num":
+            return ("num", wrap32(value))
+        if kind == "sym" and value == "(":
+            node = self.expression()
+            self.take(")")
+            return node
+        if kind == "name":
+            if self.peek() == ("sym", "("):
+                self.take()
+                args = []
+                if self.peek() != ("sym", ")"):
+                    args.append(self.expression())
+                    while self.peek() == ("sym", ","):
+                        self.take()
+                        args.append(self.expression())
+                self.take(")")
+                return ("call", value, args)
+            return ("var", value)
+        raise CompileError(f"line {self.line}: unexpected '{value}'")
+
+
+class Compiler:
+    def __init__(self):
+        self.code = []
+        self.constants = []
+        self.variables = dict(INPUTS, **OUTPUTS)
+        self.next_free = FIRST_LOCAL
+        self.line = 0
+
+    def emit(self, op, dst, a=0, b=0):
+        if len(self.code) >= MAX_INSTRUCTIONS:
+            raise CompileError(f"line {self.line}: more than {MAX_INSTRUCTIONS} instructions")
+        self.code.append((OP[op], dst, a, b))
+
+    def temp(self):
+        if self.next_free >= REGISTER_COUNT:
+            raise CompileError(f"line {self.line}: expression too complex (out of registers)")
+        self.next_free += 1
+        return self.next_free - 1
+
+    def constant(self, value):
+        if value not in self.constants:
+            if len(self.constants) >= MAX_CONSTANTS:
+                raise CompileError(f"line {self.line}: more than {MAX_CONSTANTS} distinct constants")
+            self.constants.append(value)
+        return self.constants.index(value)
+
+    def simplify(self, node):
+        """Fold operations on constants."""
+        kind = node[0]
+        if kind in ("num", "var"):
+            return node
+        if kind == "call":
+            return ("call", node[1], [self.simplify(arg) for arg in node[2]])
+        a = self.simplify(node[1])
+        b = self.simplify(node[2]) if node[2] is not None else None
+        if a[0] == "num" and (b is None or b[0] == "num"):
+            if kind == "NEG":
+                return ("num", wrap32(-a[1]))
+            if kind == "NOT":
+                return ("num", int(a[1] == 0))
+            return ("num", fold(kind, a[1], b[1]))
+        return (kind, a, b)
+
+    def value(self, node):
+        """Register holding the node's value; variables are used in place."""
+        if node[0] == "var":
+            if node[1] not in self.variables:
+                raise CompileError(f"line {self.line}: '{node[1]}' is used before it is assigned")
+            return self.variables[node[1]]
+        register = self.temp()
+        self.into(node, register)
+        return register
+
+    def into(self, node, dst):
+        kind = node[0]
+        if kind == "num":
+            index = self.constant(node[1])
+            self.emit("LOADK", dst, index & 0xFF, index >> 8)
+        elif kind == "var":
+            source = self.value(node)
+            if source != dst:
+                self.emit("MOV", dst, source)
+        elif kind == "call":
+            self.call(node[1], node[2], dst)
+        elif kind in ("NEG", "NOT"):
+            self.emit(kind, dst, self.value(node[1]))
+        else:
+            a = self.value(node[1])
+            b = self.value(node[2])
+            self.emit(kind, dst, a, b)
+
+    def call(self, name, args, dst):
+        expected = 3 if name == "if" else 2 if name in ("min", "max") else 1 if name in UNARY_BUILTINS else None
+        if expected is None:
+            raise CompileError(f"line {self.line}: unknown function '{name}'")
+        if len(args) != expected:
+            raise CompileError(f"line {self.line}: {name}() takes {expected} argument(s)")
+
+        registers = [self.value(arg) for arg in args]
+        if name == "if":
+            # SEL reads its condition from dst. When a branch is the variable
+            # being assigned, select in a temporary so it is not overwritten.
+            condition, then, otherwise = registers
+            target = self.temp() if condition != dst and dst in (then, otherwise) else dst
+            if condition != target:
+                self.emit("MOV", target, condition)
+            self.emit("SEL", target, then, otherwise)
+            if target != dst:
+                self.emit("MOV", dst, target)
+        elif name in ("min", "max"):
+            self.emit(name.upper(), dst, *registers)
+        else:
+            self.emit(UNARY_BUILTINS[name], dst, registers[0])
+
+    def statement(self, tokens):
+        if len(tokens) < 3 or tokens[0][0] != "name" or tokens[1] != ("sym", "="):
+            raise CompileError(f"line {self.line}: expected '<name> = <expression>'")
+        name = tokens[0][1]
+        if name in INPUTS:
+            raise CompileError(f"line {self.line}: '{name}' is an input and cannot be assigned")
+        if name in UNARY_BUILTINS or name in ("min", "max", "if"):
+            raise CompileError(f"line {self.line}: '{name}' is a function")
+
+        parser = Parser(tokens[2:], self.line)
+        node = self.simplify(parser.expression())
+        if parser.pos != len(parser.tokens):
+            raise CompileError(f"line {self.line}: unexpected '{parser.peek()[1]}'")
+
+        # A new variable's register is only taken once its value is computed,
+        # so 'x = x + 1' on an unassigned x is still an error
+        if name not in self.variables:
+            if self.next_free >= REGISTER_COUNT:
+                raise CompileError(f"line {self.line}: too many variables")
+            dst = self.next_free
+            self.next_free += 1
+            self.into(node, dst)
+            self.variables[name] = dst
+        else:
+            self.into(node, self.variables[name])
+
+    def compile(self, source):
+        label = ""
+        for self.line, text in enumerate(source.splitlines(), 1):
+            text = text.split("#", 1)[0].strip()
+            if not text:
+                continue
+            if text.startswith("label "):
+                label = text[6:].strip()
+                continue
+
+            # Temporaries live for one statement, after the variables
+            locals_end = max([FIRST_LOCAL] + [r + 1 for r in self.variables.values() if r >= FIRST_LOCAL])
+            self.next_free = locals_end
+            self.statement(tokenize(text, self.line))
+
+        if not self.code:
+            raise CompileError("effect has no statements")
+        return label, self.constants, self.code
+
+
+def encode(label, constants, code):
+    data = MAGIC + struct.pack("<HH", len(code), len(constants))
+    data += label.encode("utf-8")[:LABEL_SIZE].ljust(LABEL_SIZE, b"\0")
+    data += b"".join(struct.pack("<i", value) for value in constants)
+    data += b"".join(bytes(instruction) for instruction in code)
+    return data
+
+
+def upload(host, name, data):
+    boundary = uuid.uuid4().hex
+    body = (f"--{boundary}\r\n"
+            f'Content-Disposition: form-data; name="effect"; filename="{name}"\r\n'
+            f"Content-Type: application/octet-stream\r\n\r\n").encode() + data + f"\r\n--{boundary}--\r\n".encode()
+    request = urllib.request.Request(f"http://{host}/api/effects/upload", data=body, method="POST",
+                                     headers={"Content-Type": f"multipart/form-data; boundary={boundary}"})
+    try:
+        with urllib.request.urlopen(request, timeout=10) as response:
+            return response.status == 200
+    except urllib.error.HTTPError as error:
+        print(f"{name}: {error.read().decode(errors='replace')}")
+    except urllib.error.URLError as error:
+        print(f"{name}: {error}")
+    return False
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("source", help="effect source file")
+    parser.add_argument("--slot", type=int, required=True, help=f"slot 1-{SLOT_COUNT} (runs as ScriptN)")
+    parser.add_argument("--out", default="data/effects", help="output directory (default: data/effects)")
+    parser.add_argument("--upload", metavar="HOST", help="send the program to a running controller")
+    parser.add_argument("--list", action="store_true", help="print the compiled instructions")
+    args = parser.parse_args()
+
+    if not 1 <= args.slot <= SLOT_COUNT:
+        parser.error(f"--slot must be 1-{SLOT_COUNT}")
+
+    with open(args.source, encoding="utf-8") as file:
+        source = file.read()
+    try:
+        label, constants, code = Compiler().compile(source)
+    except CompileError as error:
+        print(f"{args.source}: {error}")
+        return 1
+
+    if args.list:
+        for index, (op, dst, a, b) in enumerate(code):
+            if OPS[op] == "LOADK":
+                operands = f"k{a | b << 8} = {constants[a | b << 8]}"
+            elif OPS[op] in ("MOV", "NEG", "NOT") or OPS[op] in UNARY_BUILTINS.values():
+                operands = f"r{a}"
+            else:
+                operands = f"r{a}, r{b}"
+            print(f"{index:3d}  {OPS[op]:<6} r{dst}, {operands}")
+
+    name = f"{args.slot}.bfx"
+    data = encode(label or os.path.splitext(os.path.basename(args.source))[0], constants, code)
+    os.makedirs(args.out, exist_ok=True)
+    with open(os.path.join(args.out, name), "wb") as file:
+        file.write(data)
+
+    status = ""
+    if args.upload:
+        ok = upload(args.upload, name, data)
+        status = ", uploaded" if ok else ", upload FAILED"
+    print(f"{args.source} -> {name}: {len(code)} instructions, {len(constants)} constants, "
+          f"{len(data)} bytes{status}")
+    return 0 if not args.upload or ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
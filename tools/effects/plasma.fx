@@ -0,0 +1,8 @@
+label Plasma
+# Colour drifting along the strip from two layers of noise
+x = noise(t / 2 + i * 48)
+y = noise(t - i * 32 + z * 4096)
+r = sin(x + t / 40)
+g = sin(x + y + 85)
+b = sin(y + 170 - t / 60)
+v = 64 + ease(x) * 3 / 4
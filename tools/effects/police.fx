@@ -0,0 +1,10 @@
+label Police lights
+# Red and blue halves that swap four times a second, fading out over the
+# trigger duration. PWM zones blink.
+left = i * 2 < n
+flip = (t / 250) % 2
+blue = left != flip
+r = if(blue, 0, 255)
+b = if(blue, 255, 0)
+v = if(d, 255 - p, 255)
+v = if(n == 1, v * flip, v)
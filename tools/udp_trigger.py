@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Send UDP triggers to a controller and report the ack round trip.
+
+Speaks the protocol in src/web/TriggerServer.h. Scene IDs are the "id"
+fields of GET /api/vfx.
+
+    tools/udp_trigger.py battleaura.local 2 --duration 1500
+    tools/udp_trigger.py battleaura.local 2 --duration 200 --count 50 --interval 0.5
+
+Each datagram asks for an ack and is resent with the same sequence number
+until one arrives, so retries never fire an effect twice. With --count the
+round-trip times are summarised at the end.
+"""
+
+import argparse
+import random
+import socket
+import statistics
+import struct
+import sys
+import time
+
+PORT = 4210
+TRIGGER, STOP = 1, 2
+ACK_REQUESTED = 0x80
+STATUS = {0: "ok", 1: "duplicate", 2: "unknown scene", 3: "busy", 4: "bad command"}
+
+
+def send(sock, address, command, scene, sequence, duration, timeout, retries):
+    request = b"BT" + struct.pack("<BBHI", command | ACK_REQUESTED, scene, sequence, duration)
+    for _ in range(retries + 1):
+        start = time.perf_counter()
+        sock.sendto(request, address)
+        deadline = start + timeout
+        while True:
+            sock.settimeout(max(0.0, deadline - time.perf_counter()))
+            try:
+                reply = sock.recv(16)
+            except socket.timeout:
+                break
+            if len(reply) == 6 and reply[:2] == b"BA":
+                status, _, acked = struct.unpack("<BBH", reply[2:])
+                if acked == sequence:
+                    return status, (time.perf_counter() - start) * 1000
+    return None, None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("host")
+    parser.add_argument("scene", type=int, help="scene ID from GET /api/vfx")
+    parser.add_argument("--duration", type=int, default=0, help="ms, 0 = continuous")
+    parser.add_argument("--stop", action="store_true", help="stop the scene instead")
+    parser.add_argument("--count", type=int, default=1)
+    parser.add_argument("--interval", type=float, default=1.0, help="seconds between triggers")
+    parser.add_argument("--timeout", type=float, default=0.1, help="seconds to wait for each ack")
+    parser.add_argument("--retries", type=int, default=3)
+    args = parser.parse_args()
+
+    address = (socket.gethostbyname(args.host), PORT)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    command = STOP if args.stop else TRIGGER
+    sequence = random.randrange(65536)
+    times = []
+    lost = 0
+
+    for i in range(args.count):
+        sequence = (sequence + 1) & 0xFFFF
+        status, rtt = send(sock, address, command, args.scene, sequence, args.duration, args.timeout, args.retries)
+        if status is None:
+            lost += 1
+            print(f"#{sequence}: no ack")
+        else:
+            times.append(rtt)
+            print(f"#{sequence}: {STATUS.get(status, status)}, {rtt:.1f} ms")
+        if i + 1 < args.count:
+            time.sleep(args.interval)
+
+    if len(times) > 1:
+        times.sort()
+        p95 = times[min(len(times) - 1, int(len(times) * 0.95))]
+        print(f"rtt ms: min {times[0]:.1f}, median {statistics.median(times):.1f}, p95 {p95:.1f}, "
+              f"max {times[-1]:.1f}; {lost} lost")
+    return 0 if lost == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())